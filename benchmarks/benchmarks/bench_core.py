@@ -172,3 +172,28 @@ class UnpackBits(Benchmark):
 class Indices(Benchmark):
     def time_indices(self):
         np.indices((1000, 500))
+
+
+class AllocPolicy(Benchmark):
+    params = [['default', 'aligned', 'hugepages']]
+    param_names = ['policy']
+    policies = {'default': {},
+                'aligned': {'alignment': 64},
+                'hugepages': {'alignment': 64, 'hugepage_threshold': 2**21}}
+
+    def setup(self, policy):
+        self.old = np.setallocpolicy(**self.policies[policy])
+        self.a = np.ones(2**24)
+        self.idx = np.random.RandomState(0).randint(0, self.a.size, 2**20)
+
+    def teardown(self, policy):
+        np.setallocpolicy(**self.old)
+
+    def time_zeros_fill(self, policy):
+        np.zeros(2**24).fill(1)
+
+    def time_add(self, policy):
+        self.a + self.a
+
+    def time_take_random(self, policy):
+        self.a.take(self.idx)
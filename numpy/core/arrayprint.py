@@ -29,9 +29,11 @@ else:
         from dummy_thread import get_ident
 
 from . import numerictypes as _nt
-from .umath import maximum, minimum, absolute, not_equal, isnan, isinf
+from .umath import (maximum, minimum, absolute, not_equal, isnan, isinf,
+                    isfinite)
 from .multiarray import (array, format_longfloat, datetime_as_string,
-                         datetime_data, dtype)
+                         datetime_data, dtype, _format_floats,
+                         _fraction_digits)
 from .fromnumeric import ravel
 from .numeric import asarray
 
@@ -354,6 +356,11 @@ def _array2string(a, max_line_width, precision, suppress_small, separator=' ',
     format_function = _get_format_function(data, precision,
                                            suppress_small, formatter)
 
+    # format all elements at once where possible
+    if isinstance(format_function, FloatFormat) and not summary_insert:
+        a = format_function.format_array(a)
+        format_function = str
+
     # skip over "["
     next_line_prefix = " "
     # skip over array(
@@ -525,8 +532,9 @@ def array2string(a, max_line_width=None, precision=None,
 
 
 def _extendLine(s, line, word, max_line_len, next_line_prefix):
+    # completed lines are appended to the list s
     if len(line.rstrip()) + len(word.rstrip()) >= max_line_len:
-        s += line.rstrip() + "\n"
+        s.append(line.rstrip() + "\n")
         line = next_line_prefix
     line += word
     return s, line
@@ -553,8 +561,10 @@ def _formatArray(a, format_function, rank, max_line_len,
         trailing_items = len(a)
         summary_insert1 = ""
 
+    # the pieces are joined at the end, adding to a string in the loops
+    # takes quadratic time for large arrays
     if rank == 1:
-        s = ""
+        s = []
         line = next_line_prefix
         for i in range(leading_items):
             word = format_function(a[i]) + separator
@@ -569,34 +579,36 @@ def _formatArray(a, format_function, rank, max_line_len,
 
         word = format_function(a[-1])
         s, line = _extendLine(s, line, word, max_line_len, next_line_prefix)
-        s += line + "]\n"
+        s.append(line + "]\n")
+        s = ''.join(s)
         s = '[' + s[len(next_line_prefix):]
     else:
-        s = '['
+        s = ['[']
         sep = separator.rstrip()
         for i in range(leading_items):
             if i > 0:
-                s += next_line_prefix
-            s += _formatArray(a[i], format_function, rank-1, max_line_len,
-                              " " + next_line_prefix, separator, edge_items,
-                              summary_insert)
-            s = s.rstrip() + sep.rstrip() + '\n'*max(rank-1, 1)
+                s.append(next_line_prefix)
+            s.append(_formatArray(a[i], format_function, rank-1, max_line_len,
+                                  " " + next_line_prefix, separator, edge_items,
+                                  summary_insert).rstrip())
+            s.append(sep + '\n'*max(rank-1, 1))
 
         if summary_insert1:
-            s += next_line_prefix + summary_insert1 + "\n"
+            s.append(next_line_prefix + summary_insert1 + "\n")
 
         for i in range(trailing_items, 1, -1):
             if leading_items or i != trailing_items:
-                s += next_line_prefix
-            s += _formatArray(a[-i], format_function, rank-1, max_line_len,
-                              " " + next_line_prefix, separator, edge_items,
-                              summary_insert)
-            s = s.rstrip() + sep.rstrip() + '\n'*max(rank-1, 1)
+                s.append(next_line_prefix)
+            s.append(_formatArray(a[-i], format_function, rank-1, max_line_len,
+                                  " " + next_line_prefix, separator, edge_items,
+                                  summary_insert).rstrip())
+            s.append(sep + '\n'*max(rank-1, 1))
         if leading_items or trailing_items > 1:
-            s += next_line_prefix
-        s += _formatArray(a[-1], format_function, rank-1, max_line_len,
-                          " " + next_line_prefix, separator, edge_items,
-                          summary_insert).rstrip()+']\n'
+            s.append(next_line_prefix)
+        s.append(_formatArray(a[-1], format_function, rank-1, max_line_len,
+                              " " + next_line_prefix, separator, edge_items,
+                              summary_insert).rstrip()+']\n')
+        s = ''.join(s)
     return s
 
 class FloatFormat(object):
@@ -644,10 +656,8 @@ class FloatFormat(object):
                 format = '%'
             format = format + '%d.%de' % (self.max_str_len, self.precision)
         else:
-            format = '%%.%df' % (self.precision,)
             if len(non_zero):
-                precision = max([_digits(x, self.precision, format)
-                                 for x in non_zero])
+                precision = _fraction_digits(non_zero, self.precision)
             else:
                 precision = 0
             precision = min(self.precision, precision)
@@ -698,14 +708,15 @@ class FloatFormat(object):
             s = z + ' '*(len(s)-len(z))
         return s
 
-
-def _digits(x, precision, format):
-    if precision > 0:
-        s = format % x
-        z = s.rstrip('0')
-        return precision - len(s) + len(z)
-    else:
-        return 0
+    def format_array(self, a):
+        """The elements of `a` formatted, as an object array of str."""
+        strs = _format_floats(a, self.format, exp_format=self.exp_format,
+                              large_exponent=self.large_exponent,
+                              strip_zeros=True)
+        special = ~isfinite(a)
+        if special.any():
+            strs[special] = [self(x) for x in a[special]]
+        return strs
 
 
 class IntegerFormat(object):
@@ -634,14 +634,18 @@ defdict = {
     Ufunc(1, 1, None,
           docstrings.get('numpy.core.umath.cos'),
           None,
-          TD(inexact, f='cos', astype={'e':'f'}),
+          TD('e', f='cos', astype={'e':'f'}),
+          TD(inexactvec),
+          TD('g' + cmplx, f='cos'),
           TD(P, f='cos'),
           ),
 'sin':
     Ufunc(1, 1, None,
           docstrings.get('numpy.core.umath.sin'),
           None,
-          TD(inexact, f='sin', astype={'e':'f'}),
+          TD('e', f='sin', astype={'e':'f'}),
+          TD(inexactvec),
+          TD('g' + cmplx, f='sin'),
           TD(P, f='sin'),
           ),
 'tan':
@@ -669,14 +673,18 @@ defdict = {
     Ufunc(1, 1, None,
           docstrings.get('numpy.core.umath.tanh'),
           None,
-          TD(inexact, f='tanh', astype={'e':'f'}),
+          TD('e', f='tanh', astype={'e':'f'}),
+          TD(inexactvec),
+          TD('g' + cmplx, f='tanh'),
           TD(P, f='tanh'),
           ),
 'exp':
     Ufunc(1, 1, None,
           docstrings.get('numpy.core.umath.exp'),
           None,
-          TD(inexact, f='exp', astype={'e':'f'}),
+          TD('e', f='exp', astype={'e':'f'}),
+          TD(inexactvec),
+          TD('g' + cmplx, f='exp'),
           TD(P, f='exp'),
           ),
 'exp2':
@@ -697,7 +705,9 @@ defdict = {
     Ufunc(1, 1, None,
           docstrings.get('numpy.core.umath.log'),
           None,
-          TD(inexact, f='log', astype={'e':'f'}),
+          TD('e', f='log', astype={'e':'f'}),
+          TD(inexactvec),
+          TD('g' + cmplx, f='log'),
           TD(P, f='log'),
           ),
 'log2':
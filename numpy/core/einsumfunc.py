@@ -750,6 +750,17 @@ def einsum(*operands, **kwargs):
         Also accepts an explicit contraction list from the ``np.einsum_path``
         function. See ``np.einsum_path`` for more details. Default is False.
 
+        .. versionadded:: 1.13.0
+
+        With False, three or more operands of one type supported by
+        `matmul` other than ``float16``, without ellipses, repeated
+        subscripts within an operand or ``out``, are contracted pairwise in
+        the order of a greedy path computed and cached in C, when that takes
+        fewer multiplications. Each pairwise contraction is a stacked matrix
+        product, so floating point results may differ in rounding from a
+        single pass. The result has the memory layout given by ``order``
+        either way.
+
     Returns
     -------
     output : ndarray
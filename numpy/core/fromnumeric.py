@@ -717,8 +717,9 @@ def sort(a, axis=-1, kind='quicksort', order=None):
     axis : int or None, optional
         Axis along which to sort. If None, the array is flattened before
         sorting. The default is -1, which sorts along the last axis.
-    kind : {'quicksort', 'mergesort', 'heapsort'}, optional
-        Sorting algorithm. Default is 'quicksort'.
+    kind : {'quicksort', 'mergesort', 'heapsort', 'stable'}, optional
+        Sorting algorithm. Default is 'quicksort'. 'stable' is an alias
+        for 'mergesort'.
     order : str or list of str, optional
         When `a` is an array with fields defined, this argument specifies
         which fields to compare first, second, etc.  A single field can
@@ -782,6 +783,12 @@ def sort(a, axis=-1, kind='quicksort', order=None):
     heapsort when it does not make enough progress. This makes its
     worst case O(n*log(n)).
 
+    .. versionadded:: 1.13.0
+
+    'stable' selects the stable sort. For integer and float types up to
+    64 bits, 'mergesort' and 'stable' are implemented with radix sort,
+    which is O(n) and uses ~n work space.
+
     Examples
     --------
     >>> a = np.array([[1,4],[3,1]])
@@ -838,8 +845,8 @@ def argsort(a, axis=-1, kind='quicksort', order=None):
     axis : int or None, optional
         Axis along which to sort.  The default is -1 (the last axis). If None,
         the flattened array is used.
-    kind : {'quicksort', 'mergesort', 'heapsort'}, optional
-        Sorting algorithm.
+    kind : {'quicksort', 'mergesort', 'heapsort', 'stable'}, optional
+        Sorting algorithm. 'stable' is an alias for 'mergesort'.
     order : str or list of str, optional
         When `a` is an array with fields defined, this argument specifies
         which fields to compare first, second, etc.  A single field can
@@ -159,7 +159,9 @@ enum NPY_TYPECHAR {
 typedef enum {
         NPY_QUICKSORT=0,
         NPY_HEAPSORT=1,
-        NPY_MERGESORT=2
+        NPY_MERGESORT=2,
+        /* any stable sort, radix sort for integers and floats */
+        NPY_STABLESORT=2
 } NPY_SORTKIND;
 #define NPY_NSORTS (NPY_MERGESORT + 1)
 
@@ -49,6 +49,11 @@
 #else
 #define NPY_GCC_TARGET_AVX2
 #endif
+#if defined HAVE_ATTRIBUTE_TARGET_AVX512F && defined HAVE_LINK_AVX512F
+#define NPY_GCC_TARGET_AVX512F __attribute__((target("avx512f")))
+#else
+#define NPY_GCC_TARGET_AVX512F
+#endif
 
 /*
  * mark an argument (starting from 1) that must not be NULL and is not checked
@@ -68,6 +73,22 @@
 #define NPY_HAVE_SSE2_INTRINSICS
 #endif
 
+/*
+ * runtime dispatched intrinsics, only usable in functions marked with the
+ * corresponding NPY_GCC_TARGET_* attribute after checking the cpu supports
+ * them, SSE2 is assumed to be the compile time baseline
+ */
+#if defined NPY_HAVE_SSE2_INTRINSICS && \
+    defined HAVE_ATTRIBUTE_TARGET_AVX2_WITH_INTRINSICS && \
+    defined HAVE_LINK_AVX2 && defined HAVE___BUILTIN_CPU_SUPPORTS
+#define NPY_HAVE_AVX2_INTRINSICS
+#endif
+#if defined NPY_HAVE_AVX2_INTRINSICS && \
+    defined HAVE_ATTRIBUTE_TARGET_AVX512F_WITH_INTRINSICS && \
+    defined HAVE_LINK_AVX512F
+#define NPY_HAVE_AVX512F_INTRINSICS
+#endif
+
 /*
  * give a hint to the compiler which branch is more likely or unlikely
  * to occur, e.g. rare error cases:
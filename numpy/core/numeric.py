@@ -60,7 +60,9 @@ __all__ = [
     'array_equal', 'array_equiv', 'indices', 'fromfunction', 'isclose', 'load',
     'loads', 'isscalar', 'binary_repr', 'base_repr', 'ones', 'identity',
     'allclose', 'compare_chararrays', 'putmask', 'seterr', 'geterr',
-    'setbufsize', 'getbufsize', 'seterrcall', 'geterrcall', 'errstate',
+    'setbufsize', 'getbufsize', 'setthreads', 'getthreads', 'seterrcall',
+    'geterrcall', 'errstate',
+    'setallocpolicy', 'getallocpolicy', 'allocpolicy',
     'flatnonzero', 'Inf', 'inf', 'infty', 'Infinity', 'nan', 'NaN', 'False_',
     'True_', 'bitwise_not', 'CLIP', 'RAISE', 'WRAP', 'MAXDIMS', 'BUFSIZE',
     'ALLOW_THREADS', 'ComplexWarning', 'full', 'full_like', 'matmul',
@@ -2852,6 +2854,189 @@ def getbufsize():
     return umath.geterrobj()[0]
 
 
+def setthreads(n):
+    """
+    Set the number of threads used to compute large ufunc loops and sorts.
+
+    Elementwise ufunc loops over more than a few tens of thousands of
+    elements, which do not need the Python API (so not on object arrays),
+    are split into chunks that are computed in parallel. Likewise `sort`
+    and `argsort` of numeric arrays sort pieces of long axes in parallel
+    and merge them, `matmul` and `dot` split large products between
+    the threads, `histogram` counts equal width bins of large inputs in
+    parallel, and the functions of `numpy.fft` share the rows of batched
+    transforms among them. The default of a single thread leaves all
+    computation on the calling thread.
+
+    This setting is global to the process rather than per thread.
+
+    .. versionadded:: 1.13.0
+
+    Parameters
+    ----------
+    n : int
+        Number of threads to use, including the calling one.
+
+    Returns
+    -------
+    old_n : int
+        The previous number of threads.
+
+    See Also
+    --------
+    getthreads
+
+    Examples
+    --------
+    >>> old = np.setthreads(4)
+    >>> a = np.arange(10**7, dtype=float)
+    >>> b = np.sqrt(a)  # computed on four threads
+    >>> np.setthreads(old)
+    4
+
+    """
+    n = operator.index(n)
+    old = getthreads()
+    umath._set_num_threads(n)
+    multiarray._set_num_threads(n)
+    return old
+
+
+def getthreads():
+    """
+    Return the number of threads used to compute large ufunc loops and sorts.
+
+    .. versionadded:: 1.13.0
+
+    Returns
+    -------
+    getthreads : int
+        Number of threads, see `setthreads`.
+
+    """
+    return umath._get_num_threads()
+
+
+def setallocpolicy(alignment=None, hugepage_threshold=None, first_touch=None):
+    """
+    Set how the data of large arrays is allocated.
+
+    The policy applies to array data buffers of 1024 bytes or more; smaller
+    ones are cached and always come from ``malloc``, as do large ones by
+    default. Arguments which are not given are left unchanged.
+
+    This setting is global to the process rather than per thread.
+
+    .. versionadded:: 1.13.0
+
+    Parameters
+    ----------
+    alignment : int, optional
+        Power of two in bytes to align the data to, for example 64 for the
+        cache lines and AVX512 vectors. 0 means whatever ``malloc`` gives.
+        Only honored where ``posix_memalign`` is available.
+    hugepage_threshold : int, optional
+        Buffers of this many bytes or more are aligned to huge pages and
+        advised to be backed by transparent huge pages, which avoids most
+        TLB misses on very large arrays. 0 disables this. Only honored on
+        systems with ``madvise(MADV_HUGEPAGE)``, such as Linux.
+    first_touch : bool, optional
+        If true, buffers that are large enough to be split over the threads
+        of `setthreads` are written to by those threads on allocation, in
+        the same parts as the parallel loops use. On NUMA systems this puts
+        each part in the memory local to the thread working on it.
+
+    Returns
+    -------
+    old_policy : dict
+        Dictionary with the previous settings, see `getallocpolicy`.
+
+    See Also
+    --------
+    getallocpolicy, allocpolicy, setthreads
+
+    Examples
+    --------
+    >>> old = np.setallocpolicy(alignment=64, hugepage_threshold=2**24)
+    >>> a = np.empty(10**8)  # aligned to 2 MiB, with huge pages
+    >>> np.setallocpolicy(**old)
+    {'alignment': 64, 'hugepage_threshold': 16777216, 'first_touch': False}
+
+    """
+    old = getallocpolicy()
+    new = dict(old)
+    if alignment is not None:
+        new['alignment'] = operator.index(alignment)
+    if hugepage_threshold is not None:
+        new['hugepage_threshold'] = operator.index(hugepage_threshold)
+    if first_touch is not None:
+        new['first_touch'] = bool(first_touch)
+    multiarray._set_alloc_policy(new['alignment'], new['hugepage_threshold'],
+                                 new['first_touch'])
+    return old
+
+
+def getallocpolicy():
+    """
+    Return how the data of large arrays is allocated.
+
+    .. versionadded:: 1.13.0
+
+    Returns
+    -------
+    policy : dict
+        Dictionary with the keys ``alignment``, ``hugepage_threshold`` and
+        ``first_touch``, see `setallocpolicy`.
+
+    """
+    alignment, hugepage_threshold, first_touch = \
+        multiarray._get_alloc_policy()
+    return {'alignment': alignment,
+            'hugepage_threshold': hugepage_threshold,
+            'first_touch': first_touch}
+
+
+class allocpolicy(object):
+    """
+    allocpolicy(**kwargs)
+
+    Context manager for the allocation of large arrays.
+
+    Upon entering the context the allocation policy is set with
+    `setallocpolicy`, and upon exiting it is reset to what it was before.
+    Arrays allocated inside the context keep their memory after it.
+
+    .. versionadded:: 1.13.0
+
+    Parameters
+    ----------
+    kwargs : {alignment, hugepage_threshold, first_touch}
+        Keyword arguments of `setallocpolicy`.
+
+    See Also
+    --------
+    setallocpolicy, getallocpolicy
+
+    Examples
+    --------
+    >>> with np.allocpolicy(alignment=64):
+    ...     a = np.zeros(10**6)
+    ...
+    >>> a.ctypes.data % 64
+    0
+
+    """
+
+    def __init__(self, **kwargs):
+        self.kwargs = kwargs
+
+    def __enter__(self):
+        self.oldstate = setallocpolicy(**self.kwargs)
+
+    def __exit__(self, *exc_info):
+        setallocpolicy(**self.oldstate)
+
+
 def seterrcall(func):
     """
     Set the floating-point error callback function or log object.
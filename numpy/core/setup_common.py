@@ -108,7 +108,7 @@ OPTIONAL_STDFUNCS = ["expm1", "log1p", "acosh", "asinh", "atanh",
         "rint", "trunc", "exp2", "log2", "hypot", "atan2", "pow",
         "copysign", "nextafter", "ftello", "fseeko",
         "strtoll", "strtoull", "cbrt", "strtold_l", "fallocate",
-        "backtrace"]
+        "backtrace", "posix_memalign", "madvise"]
 
 
 OPTIONAL_HEADERS = [
@@ -145,6 +145,8 @@ OPTIONAL_INTRINSICS = [("__builtin_isnan", '5.'),
                         "stdio.h", "LINK_AVX"),
                        ("__asm__ volatile", '"vpand %ymm1, %ymm2, %ymm3"',
                         "stdio.h", "LINK_AVX2"),
+                       ("__asm__ volatile", '"vpaddd %zmm1, %zmm2, %zmm3"',
+                        "stdio.h", "LINK_AVX512F"),
                        ]
 
 # function attributes
@@ -160,8 +162,29 @@ OPTIONAL_FUNCTION_ATTRIBUTES = [('__attribute__((optimize("unroll-loops")))',
                                  'attribute_target_avx'),
                                 ('__attribute__((target ("avx2")))',
                                  'attribute_target_avx2'),
+                                ('__attribute__((target ("avx512f")))',
+                                 'attribute_target_avx512f'),
                                 ]
 
+# function attributes with intrinsics
+# To ensure your compiler can compile avx intrinsics with just the attributes
+# gcc 4.8.4 support attributes but not with intrisics
+# tested via "#include<%s> int %s %s(void *){code; return 0;};"
+#     % (header, attribute, name, code)
+# function name will be converted to HAVE_<upper-case-name> preprocessor macro
+OPTIONAL_FUNCTION_ATTRIBUTES_WITH_INTRINSICS = [
+    ('__attribute__((target("avx2")))',
+     'attribute_target_avx2_with_intrinsics',
+     '__m256i temp = _mm256_set1_epi8(1); '
+     'temp = _mm256_cmpeq_epi8(temp, temp)',
+     'immintrin.h'),
+    ('__attribute__((target("avx512f")))',
+     'attribute_target_avx512f_with_intrinsics',
+     '__m512 temp = _mm512_set1_ps(1.0); '
+     '__mmask16 m = _mm512_cmp_ps_mask(temp, temp, _CMP_EQ_OQ)',
+     'immintrin.h'),
+    ]
+
 # variable attributes tested via "int %s a" % attribute
 OPTIONAL_VARIABLE_ATTRIBUTES = ["__thread", "__declspec(thread)"]
 
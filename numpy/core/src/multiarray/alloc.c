@@ -20,9 +20,13 @@
 #include "numpy/arrayobject.h"
 #include <numpy/npy_common.h>
 #include "npy_config.h"
+#include "npy_threadpool.h"
 #include "alloc.h"
 
 #include <assert.h>
+#if defined(HAVE_MADVISE)
+#include <sys/mman.h>
+#endif
 
 #define NBUCKETS 1024 /* number of buckets for data*/
 #define NBUCKETS_DIM 16 /* number of buckets for dimensions/strides */
@@ -146,6 +150,148 @@ npy_free_cache_dim(void * p, npy_uintp sz)
 }
 
 
+/*
+ * Allocation policy of array data buffers of at least NBUCKETS bytes, which
+ * never go through the cache above. The default is plain malloc.
+ *
+ * alignment:
+ *      Power of two the buffers are aligned to, 0 for what malloc gives.
+ *      Needs posix_memalign, elsewhere it is ignored.
+ * hugepage_threshold:
+ *      Buffers of this many bytes or more are aligned to huge pages and
+ *      advised to be backed by transparent huge pages, which avoids most
+ *      TLB misses when going through them. 0 to disable. Needs madvise
+ *      with MADV_HUGEPAGE, elsewhere it is ignored.
+ * first_touch:
+ *      If set, buffers large enough to be split over the thread pool are
+ *      written to by the pool threads right away, in the same contiguous
+ *      parts as the parallel loops. On NUMA systems this places each part
+ *      of the memory on the node of the thread that will work on it.
+ *
+ * The settings are changed with the GIL held.
+ */
+static npy_uintp alloc_alignment = 0;
+static npy_uintp alloc_hugepage_threshold = 0;
+static int alloc_first_touch = 0;
+
+#define NPY_ALLOC_HUGEPAGE (2 * 1024 * 1024)
+#define NPY_ALLOC_PAGE 4096
+
+NPY_NO_EXPORT int
+npy_set_alloc_policy(npy_uintp alignment, npy_uintp hugepage_threshold,
+                     int first_touch)
+{
+    if ((alignment & (alignment - 1)) != 0 ||
+            alignment > NPY_ALLOC_HUGEPAGE) {
+        PyErr_SetString(PyExc_ValueError,
+                "alignment must be 0 or a power of two of at most 2 MiB");
+        return -1;
+    }
+    alloc_alignment = alignment;
+    alloc_hugepage_threshold = hugepage_threshold;
+    alloc_first_touch = first_touch != 0;
+    return 0;
+}
+
+NPY_NO_EXPORT void
+npy_get_alloc_policy(npy_uintp *alignment, npy_uintp *hugepage_threshold,
+                     int *first_touch)
+{
+    *alignment = alloc_alignment;
+    *hugepage_threshold = alloc_hugepage_threshold;
+    *first_touch = alloc_first_touch;
+}
+
+typedef struct {
+    char *data;
+    npy_uintp size;
+    int zero;
+} touch_info;
+
+/* writes the part of a new buffer of one thread, see alloc_first_touch */
+static void
+touch_pages(void *arg, int ithread, int nthreads)
+{
+    touch_info *info = arg;
+    npy_intp start, end, i;
+
+    npy_parallel_range(info->size, NPY_ALLOC_PAGE, ithread, nthreads,
+                       &start, &end);
+    if (info->zero) {
+        memset(info->data + start, 0, end - start);
+    }
+    else {
+        for (i = start; i < end; i += NPY_ALLOC_PAGE) {
+            info->data[i] = 0;
+        }
+    }
+}
+
+/*
+ * Allocates size bytes of array data following the allocation policy,
+ * zeroed if zero is set.
+ */
+static void *
+policy_alloc(npy_uintp size, int zero)
+{
+    npy_uintp alignment = alloc_alignment;
+    int hugepage = alloc_hugepage_threshold != 0 &&
+                   size >= alloc_hugepage_threshold;
+    int nthreads = 1, aligned = 0;
+    void *p = NULL;
+
+    if (size < NBUCKETS || (alignment == 0 && !hugepage &&
+                            !alloc_first_touch)) {
+        return zero ? calloc(size, 1) : malloc(size);
+    }
+    if (alloc_first_touch) {
+        /* the same split as loops over doubles */
+        nthreads = npy_parallel_threads_nogil(size / sizeof(double));
+    }
+
+#if defined(HAVE_POSIX_MEMALIGN)
+    if (hugepage && alignment < NPY_ALLOC_HUGEPAGE) {
+        alignment = NPY_ALLOC_HUGEPAGE;
+    }
+    if (alignment != 0) {
+        if (alignment < sizeof(void *)) {
+            alignment = sizeof(void *);
+        }
+        if (posix_memalign(&p, alignment, size) != 0) {
+            return NULL;
+        }
+        aligned = 1;
+    }
+#endif
+    if (!aligned) {
+        p = (zero && nthreads == 1) ? calloc(size, 1) : malloc(size);
+        if (p == NULL) {
+            return NULL;
+        }
+    }
+
+#if defined(HAVE_MADVISE) && defined(MADV_HUGEPAGE)
+    if (hugepage && aligned) {
+        /* only a hint, the buffer is usable whether it works or not */
+        madvise(p, size & ~(npy_uintp)(NPY_ALLOC_PAGE - 1), MADV_HUGEPAGE);
+    }
+#endif
+
+    if (nthreads > 1) {
+        touch_info info;
+
+        info.data = p;
+        info.size = size;
+        info.zero = zero;
+        npy_parallel_run(nthreads, &touch_pages, &info);
+    }
+    else if (zero && aligned) {
+        memset(p, 0, size);
+    }
+    return p;
+}
+
+
 /* malloc/free/realloc hook */
 NPY_NO_EXPORT PyDataMem_EventHookFunc *_PyDataMem_eventhook;
 NPY_NO_EXPORT void *_PyDataMem_eventhook_user_data;
@@ -195,7 +341,7 @@ PyDataMem_NEW(size_t size)
 {
     void *result;
 
-    result = malloc(size);
+    result = policy_alloc(size, 0);
     if (_PyDataMem_eventhook != NULL) {
         NPY_ALLOW_C_API_DEF
         NPY_ALLOW_C_API
@@ -217,7 +363,12 @@ PyDataMem_NEW_ZEROED(size_t size, size_t elsize)
 {
     void *result;
 
-    result = calloc(size, elsize);
+    if (elsize != 0 && size > NPY_MAX_INTP / elsize) {
+        result = NULL;
+    }
+    else {
+        result = policy_alloc(size * elsize, 1);
+    }
     if (_PyDataMem_eventhook != NULL) {
         NPY_ALLOW_C_API_DEF
         NPY_ALLOW_C_API
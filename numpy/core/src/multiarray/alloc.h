@@ -21,4 +21,16 @@ npy_alloc_cache_dim(npy_uintp sz);
 NPY_NO_EXPORT void
 npy_free_cache_dim(void * p, npy_uintp sd);
 
+/*
+ * Sets the allocation policy of large array data buffers, see alloc.c.
+ * Returns 0 on success and -1 with a Python exception set on failure.
+ */
+NPY_NO_EXPORT int
+npy_set_alloc_policy(npy_uintp alignment, npy_uintp hugepage_threshold,
+                     int first_touch);
+
+NPY_NO_EXPORT void
+npy_get_alloc_policy(npy_uintp *alignment, npy_uintp *hugepage_threshold,
+                     int *first_touch);
+
 #endif
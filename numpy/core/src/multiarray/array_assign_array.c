@@ -24,6 +24,40 @@
 
 #include "array_assign.h"
 
+/*
+ * Returns the dimension to tile together with the inner dimension 0 when
+ * assigning with the given raw iteration shape and strides, or 0 if the
+ * plain loop over dimension 0 is fine.
+ *
+ * Tiling pays off when the source steps to a new cache line for every
+ * element along dimension 0, has a smaller stride along another dimension,
+ * and the lines along dimension 0 are too long for the cache to keep their
+ * source lines until the next one needs them.
+ */
+static int
+raw_array_tiled_dim(int ndim, npy_intp *shape, npy_intp *src_strides)
+{
+    int idim, tiled = 0;
+    npy_intp stride, min_stride = src_strides[0];
+
+    if (min_stride < 0) {
+        min_stride = -min_stride;
+    }
+    if (ndim < 2 || min_stride < 64 ||
+                shape[0] * min_stride < NPY_TRANSFER_TILE_MIN_BYTES) {
+        return 0;
+    }
+    for (idim = 1; idim < ndim; ++idim) {
+        stride = src_strides[idim] < 0 ? -src_strides[idim] :
+                                          src_strides[idim];
+        if (shape[idim] >= NPY_TRANSFER_TILE && stride < min_stride) {
+            min_stride = stride;
+            tiled = idim;
+        }
+    }
+    return tiled;
+}
+
 /*
  * Assigns the array from 'src' to 'dst'. The strides must already have
  * been broadcast.
@@ -35,7 +69,7 @@ raw_array_assign_array(int ndim, npy_intp *shape,
         PyArray_Descr *dst_dtype, char *dst_data, npy_intp *dst_strides,
         PyArray_Descr *src_dtype, char *src_data, npy_intp *src_strides)
 {
-    int idim;
+    int idim, tiled;
     npy_intp shape_it[NPY_MAXDIMS];
     npy_intp dst_strides_it[NPY_MAXDIMS];
     npy_intp src_strides_it[NPY_MAXDIMS];
@@ -87,17 +121,46 @@ raw_array_assign_array(int ndim, npy_intp *shape,
         return -1;
     }
 
+    /* Move the dimension to tile with the innermost one next to it */
+    tiled = raw_array_tiled_dim(ndim, shape_it, src_strides_it);
+    if (tiled > 1) {
+        npy_intp tmp;
+
+        tmp = shape_it[1];
+        shape_it[1] = shape_it[tiled];
+        shape_it[tiled] = tmp;
+        tmp = dst_strides_it[1];
+        dst_strides_it[1] = dst_strides_it[tiled];
+        dst_strides_it[tiled] = tmp;
+        tmp = src_strides_it[1];
+        src_strides_it[1] = src_strides_it[tiled];
+        src_strides_it[tiled] = tmp;
+    }
+
     if (!needs_api) {
         NPY_BEGIN_THREADS;
     }
 
-    NPY_RAW_ITER_START(idim, ndim, coord, shape_it) {
-        /* Process the innermost dimension */
-        stransfer(dst_data, dst_strides_it[0], src_data, src_strides_it[0],
-                    shape_it[0], src_itemsize, transferdata);
-    } NPY_RAW_ITER_TWO_NEXT(idim, ndim, coord, shape_it,
-                            dst_data, dst_strides_it,
-                            src_data, src_strides_it);
+    if (tiled) {
+        /* Process the two innermost dimensions in tiles */
+        NPY_RAW_ITER_START(idim, ndim - 1, coord, shape_it + 1) {
+            PyArray_TransferTiled2D(shape_it[0], shape_it[1],
+                    dst_data, dst_strides_it[0], dst_strides_it[1],
+                    src_data, src_strides_it[0], src_strides_it[1],
+                    src_itemsize, stransfer, transferdata);
+        } NPY_RAW_ITER_TWO_NEXT(idim, ndim - 1, coord, shape_it + 1,
+                                dst_data, dst_strides_it + 1,
+                                src_data, src_strides_it + 1);
+    }
+    else {
+        NPY_RAW_ITER_START(idim, ndim, coord, shape_it) {
+            /* Process the innermost dimension */
+            stransfer(dst_data, dst_strides_it[0], src_data, src_strides_it[0],
+                        shape_it[0], src_itemsize, transferdata);
+        } NPY_RAW_ITER_TWO_NEXT(idim, ndim, coord, shape_it,
+                                dst_data, dst_strides_it,
+                                src_data, src_strides_it);
+    }
 
     NPY_END_THREADS;
 
@@ -10,6 +10,12 @@
 #include "npy_config.h"
 #include "templ_common.h" /* for npy_mul_with_overflow_intp */
 #include "lowlevel_strided_loops.h" /* for npy_bswap8 */
+#include "npy_cpu_features.h"
+#include "npy_threadpool.h"
+
+#if defined NPY_HAVE_AVX2_INTRINSICS
+#include <immintrin.h>
+#endif
 
 
 /*
@@ -301,6 +307,786 @@ arr_digitize(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
         return ret;
 }
 
+/*
+ * Uniform bin histogram kernel of numpy.histogram.
+ *
+ * The bin of a sample is computed from its offset scaled by the bin count
+ * and then corrected by one against the bin edges, so that it is exactly
+ * the same as searching the edges. This is done for a block of samples at
+ * a time, vectorized with AVX2 when available, before the samples are
+ * counted. Large inputs are split over the thread pool with private
+ * counters per thread which are summed at the end.
+ */
+
+#define HIST_BLOCK 512
+
+typedef struct {
+    double mn, mx, norm;
+    const double *edges;
+    npy_int32 nbins;
+    /* 0 for counts, 1 for real and 2 for complex weights */
+    int nweights;
+    /* current chunk of samples and weights */
+    const double *x;
+    const double *w;
+    npy_intp count;
+    /* nthreads accumulators of nbins items */
+    char *acc;
+    npy_intp accsize;
+} hist_info;
+
+
+/* bin index of each sample in [0, nbins), or -1 if out of range */
+static void
+hist_indices(const hist_info *h, const double *x, npy_intp n, npy_int32 *idx)
+{
+    npy_intp i;
+
+    for (i = 0; i < n; i++) {
+        npy_int32 k;
+
+        if (!(x[i] >= h->mn && x[i] <= h->mx)) {
+            idx[i] = -1;
+            continue;
+        }
+        k = (npy_int32)((x[i] - h->mn) * h->norm);
+        if (k >= h->nbins) {
+            k = h->nbins - 1;
+        }
+        if (x[i] < h->edges[k]) {
+            k--;
+        }
+        else if (x[i] >= h->edges[k + 1] && k != h->nbins - 1) {
+            k++;
+        }
+        idx[i] = k;
+    }
+}
+
+#if defined NPY_HAVE_AVX2_INTRINSICS
+static NPY_GCC_TARGET_AVX2 void
+avx2_hist_indices(const hist_info *h, const double *x, npy_intp n,
+                  npy_int32 *idx)
+{
+    const __m256d mn = _mm256_set1_pd(h->mn);
+    const __m256d mx = _mm256_set1_pd(h->mx);
+    const __m256d norm = _mm256_set1_pd(h->norm);
+    const __m256d one = _mm256_set1_pd(1.);
+    const __m256d none = _mm256_set1_pd(-1.);
+    const __m256d last = _mm256_set1_pd(h->nbins - 1);
+    const __m128i ilast = _mm_set1_epi32(h->nbins - 1);
+    npy_intp i;
+
+    for (i = 0; i + 4 <= n; i += 4) {
+        __m256d v = _mm256_loadu_pd(x + i);
+        __m256d in = _mm256_and_pd(_mm256_cmp_pd(v, mn, _CMP_GE_OQ),
+                                   _mm256_cmp_pd(v, mx, _CMP_LE_OQ));
+        /* out of range samples are moved to bin 0 until the end */
+        __m256d t = _mm256_and_pd(_mm256_mul_pd(_mm256_sub_pd(v, mn), norm),
+                                  in);
+        __m128i k = _mm_min_epi32(_mm256_cvttpd_epi32(t), ilast);
+        __m256d kd = _mm256_cvtepi32_pd(k);
+        __m256d lo = _mm256_i32gather_pd(h->edges, k, 8);
+        __m256d hi = _mm256_i32gather_pd(h->edges + 1, k, 8);
+        __m256d dec = _mm256_cmp_pd(v, lo, _CMP_LT_OQ);
+        __m256d inc = _mm256_andnot_pd(dec, _mm256_and_pd(
+                            _mm256_cmp_pd(v, hi, _CMP_GE_OQ),
+                            _mm256_cmp_pd(kd, last, _CMP_NEQ_OQ)));
+
+        kd = _mm256_sub_pd(kd, _mm256_and_pd(dec, one));
+        kd = _mm256_add_pd(kd, _mm256_and_pd(inc, one));
+        kd = _mm256_blendv_pd(none, kd, in);
+        _mm_storeu_si128((__m128i *)(idx + i), _mm256_cvttpd_epi32(kd));
+    }
+    hist_indices(h, x + i, n - i, idx + i);
+}
+#endif
+
+
+static void
+hist_accumulate(void *arg, int ithread, int nthreads)
+{
+    hist_info *h = arg;
+    npy_int32 idx[HIST_BLOCK];
+    npy_intp start, end, i, j;
+    char *acc = h->acc + ithread * h->accsize;
+
+    npy_parallel_range(h->count, HIST_BLOCK, ithread, nthreads, &start, &end);
+
+    for (i = start; i < end; i += HIST_BLOCK) {
+        npy_intp n = end - i < HIST_BLOCK ? end - i : HIST_BLOCK;
+
+#if defined NPY_HAVE_AVX2_INTRINSICS
+        if (npy_simd_isa >= NPY_SIMD_ISA_AVX2) {
+            avx2_hist_indices(h, h->x + i, n, idx);
+        }
+        else
+#endif
+        {
+            hist_indices(h, h->x + i, n, idx);
+        }
+
+        if (h->nweights == 0) {
+            npy_intp *counts = (npy_intp *)acc;
+            for (j = 0; j < n; j++) {
+                if (idx[j] >= 0) {
+                    counts[idx[j]]++;
+                }
+            }
+        }
+        else if (h->nweights == 1) {
+            double *sums = (double *)acc;
+            const double *w = h->w + i;
+            for (j = 0; j < n; j++) {
+                if (idx[j] >= 0) {
+                    sums[idx[j]] += w[j];
+                }
+            }
+        }
+        else {
+            double *sums = (double *)acc;
+            const double *w = h->w + 2 * i;
+            for (j = 0; j < n; j++) {
+                if (idx[j] >= 0) {
+                    sums[2 * idx[j]] += w[2 * j];
+                    sums[2 * idx[j] + 1] += w[2 * j + 1];
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * _histogram_uniform(a, edges, norm, weights=None) is the histogram of the
+ * samples a over the nbins equal bins with the given edges and
+ * norm = nbins / (edges[-1] - edges[0]). Samples outside the edges are
+ * ignored. Returns the counts as intp, or the sums of the weights as double
+ * or complex double.
+ */
+NPY_NO_EXPORT PyObject *
+arr_histogram_uniform(PyObject *NPY_UNUSED(self), PyObject *args,
+                      PyObject *kwds)
+{
+    PyObject *a_obj, *edges_obj, *weights_obj = Py_None;
+    PyArrayObject *op[2] = {NULL, NULL}, *edges = NULL, *ret = NULL;
+    PyArray_Descr *op_dtypes[2] = {NULL, NULL};
+    npy_uint32 op_flags[2];
+    NpyIter *iter = NULL;
+    NpyIter_IterNextFunc *iternext;
+    char **dataptr;
+    npy_intp *countptr, nbins, i;
+    char *acc = NULL;
+    int nthreads, t, nop, ret_type;
+    hist_info h;
+    static char *kwlist[] = {"a", "edges", "norm", "weights", NULL};
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOd|O:_histogram_uniform",
+                                     kwlist, &a_obj, &edges_obj, &h.norm,
+                                     &weights_obj)) {
+        return NULL;
+    }
+    edges = (PyArrayObject *)PyArray_ContiguousFromAny(edges_obj, NPY_DOUBLE,
+                                                       1, 1);
+    if (edges == NULL) {
+        return NULL;
+    }
+    nbins = PyArray_SIZE(edges) - 1;
+    if (nbins < 1 || nbins > NPY_MAX_INT32 - 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "number of bins must be between 1 and 2**31 - 2");
+        goto fail;
+    }
+    h.edges = (double *)PyArray_DATA(edges);
+    h.nbins = (npy_int32)nbins;
+    h.mn = h.edges[0];
+    h.mx = h.edges[nbins];
+
+    op[0] = (PyArrayObject *)PyArray_FromAny(a_obj, NULL, 1, 1, 0, NULL);
+    if (op[0] == NULL) {
+        goto fail;
+    }
+    op_dtypes[0] = PyArray_DescrFromType(NPY_DOUBLE);
+    op_flags[0] = op_flags[1] = NPY_ITER_READONLY | NPY_ITER_ALIGNED |
+                                NPY_ITER_CONTIG;
+    nop = 1;
+    h.nweights = 0;
+    ret_type = NPY_INTP;
+    if (weights_obj != Py_None) {
+        op[1] = (PyArrayObject *)PyArray_FromAny(weights_obj, NULL, 1, 1, 0,
+                                                 NULL);
+        if (op[1] == NULL) {
+            goto fail;
+        }
+        if (PyArray_SIZE(op[1]) != PyArray_SIZE(op[0])) {
+            PyErr_SetString(PyExc_ValueError,
+                            "weights should have the same shape as a.");
+            goto fail;
+        }
+        if (PyArray_ISCOMPLEX(op[1])) {
+            ret_type = NPY_CDOUBLE;
+            h.nweights = 2;
+        }
+        else {
+            ret_type = NPY_DOUBLE;
+            h.nweights = 1;
+        }
+        op_dtypes[1] = PyArray_DescrFromType(ret_type);
+        nop = 2;
+    }
+
+    ret = (PyArrayObject *)PyArray_ZEROS(1, &nbins, ret_type, 0);
+    if (ret == NULL) {
+        goto fail;
+    }
+    h.accsize = nbins * PyArray_ITEMSIZE(ret);
+
+    iter = NpyIter_MultiNew(nop, op, NPY_ITER_EXTERNAL_LOOP |
+                            NPY_ITER_BUFFERED | NPY_ITER_GROWINNER |
+                            NPY_ITER_ZEROSIZE_OK, NPY_KEEPORDER,
+                            NPY_UNSAFE_CASTING, op_flags, op_dtypes);
+    if (iter == NULL) {
+        goto fail;
+    }
+    if (NpyIter_GetIterSize(iter) == 0) {
+        goto finish;
+    }
+    iternext = NpyIter_GetIterNext(iter, NULL);
+    if (iternext == NULL) {
+        goto fail;
+    }
+    dataptr = NpyIter_GetDataPtrArray(iter);
+    countptr = NpyIter_GetInnerLoopSizePtr(iter);
+
+    /* private counters only pay off with many samples per bin */
+    nthreads = npy_parallel_threads(PyArray_SIZE(op[0]));
+    while (nthreads > 1 &&
+            PyArray_SIZE(op[0]) / nthreads < 4 * nbins) {
+        nthreads--;
+    }
+    h.acc = PyArray_DATA(ret);
+    if (nthreads > 1) {
+        acc = calloc(nthreads, h.accsize);
+        if (acc == NULL) {
+            nthreads = 1;
+        }
+        else {
+            h.acc = acc;
+        }
+    }
+
+    if (!NpyIter_IterationNeedsAPI(iter)) {
+        NPY_BEGIN_THREADS_THRESHOLDED(PyArray_SIZE(op[0]));
+    }
+    do {
+        int nt = (int)(*countptr / NPY_PARALLEL_MIN_CHUNK);
+
+        h.x = (double *)dataptr[0];
+        h.w = nop == 2 ? (double *)dataptr[1] : NULL;
+        h.count = *countptr;
+        npy_parallel_run(nt < nthreads ? (nt > 1 ? nt : 1) : nthreads,
+                         hist_accumulate, &h);
+    } while (iternext(iter));
+
+    /* sum the counters of the threads */
+    for (t = 0; t < nthreads && acc != NULL; t++) {
+        char *src = acc + t * h.accsize;
+
+        if (ret_type == NPY_INTP) {
+            npy_intp *dst = (npy_intp *)PyArray_DATA(ret);
+            for (i = 0; i < nbins; i++) {
+                dst[i] += ((npy_intp *)src)[i];
+            }
+        }
+        else {
+            double *dst = (double *)PyArray_DATA(ret);
+            for (i = 0; i < nbins * h.nweights; i++) {
+                dst[i] += ((double *)src)[i];
+            }
+        }
+    }
+    NPY_END_THREADS;
+
+finish:
+    free(acc);
+    NpyIter_Deallocate(iter);
+    Py_DECREF(edges);
+    Py_DECREF(op[0]);
+    Py_XDECREF(op[1]);
+    Py_DECREF(op_dtypes[0]);
+    Py_XDECREF(op_dtypes[1]);
+    return (PyObject *)ret;
+
+fail:
+    free(acc);
+    if (iter != NULL) {
+        NpyIter_Deallocate(iter);
+    }
+    Py_XDECREF(edges);
+    Py_XDECREF(op[0]);
+    Py_XDECREF(op[1]);
+    Py_XDECREF(op_dtypes[0]);
+    Py_XDECREF(op_dtypes[1]);
+    Py_XDECREF(ret);
+    return NULL;
+}
+
+/*
+ * Open addressing hash table of the distinct items of a contiguous array,
+ * used by the hash based set operations of numpy.lib.arraysetops. Items
+ * are compared by their bytes, which is only the same as equality for the
+ * types accepted by hashable_descr.
+ *
+ * The slots keep the hash of their item, so that probing rarely needs to
+ * look at the items themselves, and resizing never does. Hashes of items
+ * of up to 8 bytes are a bijection, so for those equal hashes mean equal
+ * items.
+ */
+typedef struct {
+    npy_uint64 hash;
+    /* unique id of the item, -1 if the slot is empty */
+    npy_intp id;
+} item_slot;
+
+typedef struct {
+    char *data;
+    npy_intp elsize;
+    item_slot *slots;
+    npy_intp mask;
+    /* index in data of the first occurrence of each unique item */
+    npy_intp *firsts;
+    /* number of occurrences of each unique item, if not NULL */
+    npy_intp *counts;
+    npy_intp nunique;
+} item_table;
+
+
+static int
+hashable_descr(PyArray_Descr *descr)
+{
+    int type_num = descr->type_num;
+
+    /* not bool, whose true values may have different bytes */
+    return PyTypeNum_ISINTEGER(type_num) ||
+           PyTypeNum_ISDATETIME(type_num) || type_num == NPY_STRING ||
+           type_num == NPY_UNICODE ||
+           (type_num == NPY_VOID && !PyDataType_HASFIELDS(descr) &&
+            !PyDataType_HASSUBARRAY(descr));
+}
+
+
+/* finalizer of MurmurHash3, spreads the bits of integer keys */
+static NPY_INLINE npy_uint64
+mix_hash(npy_uint64 h)
+{
+    h ^= h >> 33;
+    h *= NPY_ULONGLONG_SUFFIX(0xff51afd7ed558ccd);
+    h ^= h >> 33;
+    h *= NPY_ULONGLONG_SUFFIX(0xc4ceb9fe1a85ec53);
+    h ^= h >> 33;
+    return h;
+}
+
+
+static NPY_INLINE npy_uint64
+hash_item(const char *item, npy_intp elsize)
+{
+    npy_uint8 v1;
+    npy_uint16 v2;
+    npy_uint32 v4;
+    npy_uint64 v8, h;
+
+    switch (elsize) {
+        case 1:
+            memcpy(&v1, item, 1);
+            return mix_hash(v1);
+        case 2:
+            memcpy(&v2, item, 2);
+            return mix_hash(v2);
+        case 4:
+            memcpy(&v4, item, 4);
+            return mix_hash(v4);
+        case 8:
+            memcpy(&v8, item, 8);
+            return mix_hash(v8);
+    }
+    h = (npy_uint64)elsize;
+    for (; elsize >= 8; elsize -= 8, item += 8) {
+        memcpy(&v8, item, 8);
+        h = mix_hash(h ^ v8);
+    }
+    if (elsize > 0) {
+        v8 = 0;
+        memcpy(&v8, item, elsize);
+        h = mix_hash(h ^ v8);
+    }
+    return h;
+}
+
+
+static NPY_INLINE int
+items_equal(const char *a, const char *b, npy_intp elsize)
+{
+    switch (elsize) {
+        case 1:
+            return *a == *b;
+        case 2: {
+            npy_uint16 x, y;
+            memcpy(&x, a, 2);
+            memcpy(&y, b, 2);
+            return x == y;
+        }
+        case 4: {
+            npy_uint32 x, y;
+            memcpy(&x, a, 4);
+            memcpy(&y, b, 4);
+            return x == y;
+        }
+        case 8: {
+            npy_uint64 x, y;
+            memcpy(&x, a, 8);
+            memcpy(&y, b, 8);
+            return x == y;
+        }
+    }
+    return memcmp(a, b, elsize) == 0;
+}
+
+
+/*
+ * Slot of an item with the given hash, which is either empty or holds an
+ * equal item.
+ */
+static NPY_INLINE item_slot *
+item_table_slot(item_table *table, const char *item, npy_uint64 hash)
+{
+    npy_intp i = (npy_intp)(hash & table->mask);
+
+    for (;;) {
+        item_slot *slot = &table->slots[i];
+
+        if (slot->id < 0) {
+            return slot;
+        }
+        if (slot->hash == hash && (table->elsize <= 8 ||
+                items_equal(item, table->data +
+                            table->firsts[slot->id] * table->elsize,
+                            table->elsize))) {
+            return slot;
+        }
+        i = (i + 1) & table->mask;
+    }
+}
+
+
+/*
+ * Resize the table to `size` slots, a power of two larger than twice the
+ * number of unique items. Does not need the GIL.
+ */
+static int
+item_table_resize(item_table *table, npy_intp size)
+{
+    item_slot *slots, *old = table->slots;
+    npy_intp i, *firsts, *counts;
+
+    slots = malloc(size * sizeof(item_slot));
+    /* at most half of the slots are used */
+    firsts = realloc(table->firsts, size / 2 * sizeof(npy_intp));
+    if (slots == NULL || firsts == NULL) {
+        free(slots);
+        table->firsts = firsts != NULL ? firsts : table->firsts;
+        return -1;
+    }
+    table->firsts = firsts;
+    if (table->counts != NULL) {
+        counts = realloc(table->counts, size / 2 * sizeof(npy_intp));
+        if (counts == NULL) {
+            free(slots);
+            return -1;
+        }
+        table->counts = counts;
+    }
+
+    for (i = 0; i < size; i++) {
+        slots[i].id = -1;
+    }
+    /* the items are distinct, so reinserting them needs no comparisons */
+    for (i = 0; i <= table->mask && old != NULL; i++) {
+        if (old[i].id >= 0) {
+            npy_intp j = (npy_intp)(old[i].hash & (size - 1));
+
+            while (slots[j].id >= 0) {
+                j = (j + 1) & (size - 1);
+            }
+            slots[j] = old[i];
+        }
+    }
+    free(old);
+    table->slots = slots;
+    table->mask = size - 1;
+    return 0;
+}
+
+
+/*
+ * Add the `n` items of the table data, writing the unique id of each to
+ * `ids` if it is not NULL. Does not need the GIL. Returns -1 if out of
+ * memory.
+ */
+static int
+item_table_fill(item_table *table, npy_intp n, npy_intp *ids)
+{
+    npy_intp i;
+    char *item = table->data;
+
+    for (i = 0; i < n; i++, item += table->elsize) {
+        npy_uint64 hash = hash_item(item, table->elsize);
+        item_slot *slot = item_table_slot(table, item, hash);
+
+        if (slot->id < 0) {
+            if (2 * (table->nunique + 1) > table->mask + 1) {
+                if (item_table_resize(table, 2 * (table->mask + 1)) < 0) {
+                    return -1;
+                }
+                slot = item_table_slot(table, item, hash);
+            }
+            slot->hash = hash;
+            slot->id = table->nunique;
+            table->firsts[table->nunique] = i;
+            if (table->counts != NULL) {
+                table->counts[table->nunique] = 0;
+            }
+            table->nunique++;
+        }
+        if (ids != NULL) {
+            ids[i] = slot->id;
+        }
+        if (table->counts != NULL) {
+            table->counts[slot->id]++;
+        }
+    }
+    return 0;
+}
+
+
+static int
+item_table_init(item_table *table, PyArrayObject *arr, int with_counts)
+{
+    /*
+     * Large inputs often have many duplicates, so their table starts at a
+     * million slots and grows while filling it.
+     */
+    npy_intp size = 16;
+
+    while (size < 2 * PyArray_SIZE(arr) && size < (1 << 20)) {
+        size *= 2;
+    }
+    table->data = PyArray_DATA(arr);
+    table->elsize = PyArray_ITEMSIZE(arr);
+    table->slots = NULL;
+    table->mask = -1;
+    table->firsts = NULL;
+    table->counts = with_counts ? malloc(sizeof(npy_intp)) : NULL;
+    table->nunique = 0;
+    if ((with_counts && table->counts == NULL) ||
+            item_table_resize(table, size) < 0) {
+        free(table->counts);
+        free(table->firsts);
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+
+static void
+item_table_free(item_table *table)
+{
+    free(table->slots);
+    free(table->firsts);
+    free(table->counts);
+}
+
+
+/* contiguous 1-d array of a type supported by the item table */
+static PyArrayObject *
+hashable_array(PyObject *obj)
+{
+    PyArrayObject *arr = (PyArrayObject *)PyArray_FromAny(obj, NULL, 1, 1,
+                                                NPY_ARRAY_CARRAY_RO, NULL);
+
+    if (arr != NULL && !hashable_descr(PyArray_DESCR(arr))) {
+        PyErr_Format(PyExc_TypeError,
+                     "items of type %R cannot be hashed",
+                     (PyObject *)PyArray_DESCR(arr));
+        Py_DECREF(arr);
+        return NULL;
+    }
+    return arr;
+}
+
+
+static PyObject *
+intp_array_from(npy_intp *data, npy_intp n)
+{
+    PyArrayObject *ret = (PyArrayObject *)PyArray_SimpleNew(1, &n, NPY_INTP);
+
+    if (ret != NULL) {
+        memcpy(PyArray_DATA(ret), data, n * sizeof(npy_intp));
+    }
+    return (PyObject *)ret;
+}
+
+
+/*
+ * _unique_hash(ar, return_inverse, return_counts) finds the distinct items
+ * of a 1-d array with a hash table and returns a tuple of the index of
+ * the first occurrence of each, in order of appearance, the unique id of
+ * every item (or None), and the number of occurrences of each (or None).
+ */
+NPY_NO_EXPORT PyObject *
+arr_unique_hash(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
+{
+    PyObject *obj, *firsts = NULL, *inverse = NULL, *counts = NULL;
+    PyArrayObject *arr;
+    int return_inverse = 0, return_counts = 0, ret;
+    npy_intp n;
+    item_table table;
+    static char *kwlist[] = {"ar", "return_inverse", "return_counts", NULL};
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|ii:_unique_hash", kwlist,
+                                     &obj, &return_inverse, &return_counts)) {
+        return NULL;
+    }
+    arr = hashable_array(obj);
+    if (arr == NULL) {
+        return NULL;
+    }
+    n = PyArray_SIZE(arr);
+    if (return_inverse) {
+        inverse = PyArray_SimpleNew(1, &n, NPY_INTP);
+        if (inverse == NULL) {
+            goto fail;
+        }
+    }
+    if (item_table_init(&table, arr, return_counts) < 0) {
+        goto fail;
+    }
+
+    NPY_BEGIN_THREADS_THRESHOLDED(n);
+    ret = item_table_fill(&table, n, inverse == NULL ? NULL :
+                          (npy_intp *)PyArray_DATA((PyArrayObject *)inverse));
+    NPY_END_THREADS;
+    if (ret < 0) {
+        PyErr_NoMemory();
+        item_table_free(&table);
+        goto fail;
+    }
+
+    firsts = intp_array_from(table.firsts, table.nunique);
+    if (return_counts) {
+        counts = intp_array_from(table.counts, table.nunique);
+    }
+    item_table_free(&table);
+    if (firsts == NULL || (return_counts && counts == NULL)) {
+        goto fail;
+    }
+    Py_DECREF(arr);
+    if (inverse == NULL) {
+        Py_INCREF(Py_None);
+        inverse = Py_None;
+    }
+    if (counts == NULL) {
+        Py_INCREF(Py_None);
+        counts = Py_None;
+    }
+    return Py_BuildValue("NNN", firsts, inverse, counts);
+
+fail:
+    Py_DECREF(arr);
+    Py_XDECREF(firsts);
+    Py_XDECREF(inverse);
+    Py_XDECREF(counts);
+    return NULL;
+}
+
+
+/*
+ * _in1d_hash(ar1, ar2, invert) tests whether each item of the 1-d array
+ * ar1 is in the 1-d array ar2 of the same type, using a hash table of the
+ * items of ar2.
+ */
+NPY_NO_EXPORT PyObject *
+arr_in1d_hash(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
+{
+    PyObject *obj1, *obj2;
+    PyArrayObject *arr1 = NULL, *arr2 = NULL, *ret = NULL;
+    int invert = 0, err;
+    npy_intp i, n1, elsize;
+    npy_bool *out;
+    char *item;
+    item_table table;
+    static char *kwlist[] = {"ar1", "ar2", "invert", NULL};
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|i:_in1d_hash", kwlist,
+                                     &obj1, &obj2, &invert)) {
+        return NULL;
+    }
+    arr1 = hashable_array(obj1);
+    if (arr1 == NULL) {
+        goto fail;
+    }
+    arr2 = hashable_array(obj2);
+    if (arr2 == NULL) {
+        goto fail;
+    }
+    if (!PyArray_EquivTypes(PyArray_DESCR(arr1), PyArray_DESCR(arr2))) {
+        PyErr_SetString(PyExc_TypeError,
+                        "_in1d_hash requires arrays of the same type");
+        goto fail;
+    }
+    n1 = PyArray_SIZE(arr1);
+    elsize = PyArray_ITEMSIZE(arr1);
+    ret = (PyArrayObject *)PyArray_SimpleNew(1, &n1, NPY_BOOL);
+    if (ret == NULL) {
+        goto fail;
+    }
+    if (item_table_init(&table, arr2, 0) < 0) {
+        goto fail;
+    }
+
+    NPY_BEGIN_THREADS_THRESHOLDED(n1 + PyArray_SIZE(arr2));
+    err = item_table_fill(&table, PyArray_SIZE(arr2), NULL);
+    if (err == 0) {
+        out = (npy_bool *)PyArray_DATA(ret);
+        item = PyArray_DATA(arr1);
+        for (i = 0; i < n1; i++, item += elsize) {
+            item_slot *slot = item_table_slot(&table, item,
+                                              hash_item(item, elsize));
+            out[i] = (slot->id >= 0) != invert;
+        }
+    }
+    NPY_END_THREADS;
+    item_table_free(&table);
+    if (err < 0) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+
+    Py_DECREF(arr1);
+    Py_DECREF(arr2);
+    return (PyObject *)ret;
+
+fail:
+    Py_XDECREF(arr1);
+    Py_XDECREF(arr2);
+    Py_XDECREF(ret);
+    return NULL;
+}
+
 /*
  * Returns input array with values inserted sequentially into places
  * indicated by the mask
@@ -5,10 +5,16 @@
 NPY_NO_EXPORT PyObject *
 arr_insert(PyObject *, PyObject *, PyObject *);
 NPY_NO_EXPORT PyObject *
+arr_unique_hash(PyObject *, PyObject *, PyObject *);
+NPY_NO_EXPORT PyObject *
+arr_in1d_hash(PyObject *, PyObject *, PyObject *);
+NPY_NO_EXPORT PyObject *
 arr_bincount(PyObject *, PyObject *, PyObject *);
 NPY_NO_EXPORT PyObject *
 arr_digitize(PyObject *, PyObject *, PyObject *kwds);
 NPY_NO_EXPORT PyObject *
+arr_histogram_uniform(PyObject *, PyObject *, PyObject *);
+NPY_NO_EXPORT PyObject *
 arr_interp(PyObject *, PyObject *, PyObject *);
 NPY_NO_EXPORT PyObject *
 arr_interp_complex(PyObject *, PyObject *, PyObject *);
@@ -23,6 +23,7 @@
 #include "npy_sort.h"
 #include "npy_partition.h"
 #include "npy_binsearch.h"
+#include "npy_threadpool.h"
 
 /*NUMPY_API
  * Take
@@ -784,6 +785,241 @@ PyArray_Choose(PyArrayObject *ip, PyObject *op, PyArrayObject *out,
     return NULL;
 }
 
+/*
+ * Parallel sorting of large 1-d buffers of the numeric types, for
+ * _new_sortlike and _new_argsortlike.
+ *
+ * The buffer is split into one run per thread, the runs are sorted (or
+ * argsorted) concurrently with the type's sort function, and then merged
+ * pairwise until one run is left. Every merge round splits the output
+ * evenly between the threads: each thread locates the start and end of its
+ * part in the two input runs by a binary search of the merge path, so the
+ * work is balanced whatever the data. Ties are taken from the left run, so
+ * the result of a stable sort is unchanged.
+ */
+
+typedef struct {
+    /* the values, for argsort the items are indices into them */
+    char *vals;
+    npy_intp elsize;
+    /* the items being sorted, and a scratch buffer of the same size */
+    char *items;
+    char *scratch;
+    npy_intp itemsize;
+    npy_intp num;
+    PyArray_SortFunc *sort;
+    PyArray_ArgSortFunc *argsort;
+    PyArray_CompareFunc *compare;
+    PyArrayObject *arr;
+    /* item offsets of the runs in the current round */
+    npy_intp bounds[NPY_MAX_THREADS + 1];
+    int nruns;
+    char *src, *dst;
+    int ret[NPY_MAX_THREADS];
+} parallel_sort_info;
+
+
+/*
+ * Whether the sort functions of a type can be run concurrently and their
+ * order matches the compare function. HALF_compare sorts nans first, unlike
+ * the half sorts, so half is sorted on one thread.
+ */
+static int
+_can_sort_parallel(PyArray_Descr *descr)
+{
+    return (PyTypeNum_ISNUMBER(descr->type_num) ||
+            PyTypeNum_ISDATETIME(descr->type_num)) &&
+           descr->type_num != NPY_HALF && descr->f->compare != NULL;
+}
+
+
+static NPY_INLINE char *
+_psort_key(parallel_sort_info *info, char *item)
+{
+    if (info->argsort != NULL) {
+        return info->vals + *(npy_intp *)item * info->elsize;
+    }
+    return item;
+}
+
+
+static NPY_INLINE void
+_psort_copy(char *dst, char *src, npy_intp itemsize)
+{
+    switch (itemsize) {
+        case 1:
+            *dst = *src;
+            break;
+        case 2:
+            *(npy_uint16 *)dst = *(npy_uint16 *)src;
+            break;
+        case 4:
+            *(npy_uint32 *)dst = *(npy_uint32 *)src;
+            break;
+        case 8:
+            *(npy_uint64 *)dst = *(npy_uint64 *)src;
+            break;
+        default:
+            memcpy(dst, src, itemsize);
+    }
+}
+
+
+static void
+_psort_runs(void *arg, int ithread, int NPY_UNUSED(nthreads))
+{
+    parallel_sort_info *info = arg;
+    npy_intp start = info->bounds[ithread];
+    npy_intp n = info->bounds[ithread + 1] - start;
+
+    if (info->argsort != NULL) {
+        info->ret[ithread] = info->argsort(info->vals,
+                                           (npy_intp *)info->items + start,
+                                           n, info->arr);
+    }
+    else {
+        info->ret[ithread] = info->sort(info->items + start * info->itemsize,
+                                        n, info->arr);
+    }
+}
+
+
+/*
+ * Number of items taken from a in the first k items of the merge of the
+ * sorted runs a and b.
+ */
+static npy_intp
+_psort_corank(parallel_sort_info *info, npy_intp k,
+              char *a, npy_intp na, char *b, npy_intp nb)
+{
+    npy_intp lo = k > nb ? k - nb : 0;
+    npy_intp hi = k < na ? k : na;
+    npy_intp sz = info->itemsize;
+
+    while (lo < hi) {
+        npy_intp i = lo + (hi - lo) / 2;
+        npy_intp j = k - i;
+
+        /* a[i] goes before b[j - 1], so more items are taken from a */
+        if (info->compare(_psort_key(info, a + i * sz),
+                          _psort_key(info, b + (j - 1) * sz),
+                          info->arr) <= 0) {
+            lo = i + 1;
+        }
+        else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+
+static void
+_psort_merge(void *arg, int ithread, int nthreads)
+{
+    parallel_sort_info *info = arg;
+    npy_intp sz = info->itemsize;
+    npy_intp start, end;
+    int r;
+
+    npy_parallel_range(info->num, 1, ithread, nthreads, &start, &end);
+
+    for (r = 0; r < info->nruns; r += 2) {
+        npy_intp lo = info->bounds[r];
+        npy_intp mid = info->bounds[r + 1];
+        npy_intp hi = r + 2 <= info->nruns ? info->bounds[r + 2] : mid;
+        npy_intp k0 = start > lo ? start - lo : 0;
+        npy_intp k1 = (end < hi ? end : hi) - lo;
+        char *a = info->src + lo * sz, *b = info->src + mid * sz;
+        char *out = info->dst + (lo + k0) * sz;
+        npy_intp na = mid - lo, nb = hi - mid;
+        npy_intp i, j, i1, j1;
+
+        if (k0 >= k1) {
+            continue;
+        }
+        i = _psort_corank(info, k0, a, na, b, nb);
+        j = k0 - i;
+        i1 = _psort_corank(info, k1, a, na, b, nb);
+        j1 = k1 - i1;
+
+        while (i < i1 && j < j1) {
+            if (info->compare(_psort_key(info, b + j * sz),
+                              _psort_key(info, a + i * sz),
+                              info->arr) < 0) {
+                _psort_copy(out, b + j++ * sz, sz);
+            }
+            else {
+                _psort_copy(out, a + i++ * sz, sz);
+            }
+            out += sz;
+        }
+        if (i < i1) {
+            memcpy(out, a + i * sz, (i1 - i) * sz);
+        }
+        if (j < j1) {
+            memcpy(out, b + j * sz, (j1 - j) * sz);
+        }
+    }
+}
+
+
+static void
+_psort_copyback(void *arg, int ithread, int nthreads)
+{
+    parallel_sort_info *info = arg;
+    npy_intp start, end;
+
+    npy_parallel_range(info->num, 1, ithread, nthreads, &start, &end);
+    memcpy(info->items + start * info->itemsize,
+           info->scratch + start * info->itemsize,
+           (end - start) * info->itemsize);
+}
+
+
+/*
+ * Sort (if argsort is NULL) or argsort a 1-d buffer on nthreads threads.
+ * Does not need the GIL, `scratch` must be as large as the items. Returns
+ * a negative value if a sort function ran out of memory.
+ */
+static int
+_parallel_sort(parallel_sort_info *info, int nthreads)
+{
+    int i;
+
+    info->nruns = nthreads;
+    for (i = 0; i <= nthreads; i++) {
+        info->bounds[i] = info->num * i / nthreads;
+    }
+    npy_parallel_run(nthreads, _psort_runs, info);
+    for (i = 0; i < nthreads; i++) {
+        if (info->ret[i] < 0) {
+            return info->ret[i];
+        }
+    }
+
+    info->src = info->items;
+    info->dst = info->scratch;
+    while (info->nruns > 1) {
+        char *tmp;
+
+        npy_parallel_run(nthreads, _psort_merge, info);
+        for (i = 0; 2 * i < info->nruns; i++) {
+            info->bounds[i] = info->bounds[2 * i];
+        }
+        info->bounds[i] = info->num;
+        info->nruns = i;
+        tmp = info->src;
+        info->src = info->dst;
+        info->dst = tmp;
+    }
+    if (info->src != info->items) {
+        npy_parallel_run(nthreads, _psort_copyback, info);
+    }
+    return 0;
+}
+
+
 /*
  * These algorithms use special sorting.  They are not called unless the
  * underlying sort function for the type is available.  Note that axis is
@@ -810,6 +1046,8 @@ _new_sortlike(PyArrayObject *op, int axis, PyArray_SortFunc *sort,
     npy_intp size;
 
     int ret = 0;
+    int nthreads = 1;
+    parallel_sort_info pinfo;
 
     NPY_BEGIN_THREADS_DEF;
 
@@ -824,6 +1062,10 @@ _new_sortlike(PyArrayObject *op, int axis, PyArray_SortFunc *sort,
     }
     size = it->size;
 
+    if (part == NULL && _can_sort_parallel(PyArray_DESCR(op))) {
+        nthreads = npy_parallel_threads(N);
+    }
+
     NPY_BEGIN_THREADS_DESCR(PyArray_DESCR(op));
 
     if (needcopy) {
@@ -834,6 +1076,21 @@ _new_sortlike(PyArrayObject *op, int axis, PyArray_SortFunc *sort,
         }
     }
 
+    if (nthreads > 1) {
+        pinfo.vals = NULL;
+        pinfo.elsize = elsize;
+        pinfo.itemsize = elsize;
+        pinfo.num = N;
+        pinfo.sort = sort;
+        pinfo.argsort = NULL;
+        pinfo.compare = PyArray_DESCR(op)->f->compare;
+        pinfo.arr = op;
+        pinfo.scratch = PyDataMem_NEW(N * elsize);
+        if (pinfo.scratch == NULL) {
+            nthreads = 1;
+        }
+    }
+
     while (size--) {
         char *bufptr = it->dataptr;
 
@@ -867,7 +1124,14 @@ _new_sortlike(PyArrayObject *op, int axis, PyArray_SortFunc *sort,
          * sort or part, the unswapping is still done before returning.
          */
 
-        if (part == NULL) {
+        if (nthreads > 1) {
+            pinfo.items = bufptr;
+            ret = _parallel_sort(&pinfo, nthreads);
+            if (ret < 0) {
+                goto fail;
+            }
+        }
+        else if (part == NULL) {
             ret = sort(bufptr, N, op);
 #if defined(NPY_PY3K)
             /* Object comparisons may raise an exception in Python 3 */
@@ -915,6 +1179,9 @@ _new_sortlike(PyArrayObject *op, int axis, PyArray_SortFunc *sort,
 
 fail:
     PyDataMem_FREE(buffer);
+    if (nthreads > 1) {
+        PyDataMem_FREE(pinfo.scratch);
+    }
     NPY_END_THREADS_DESCR(PyArray_DESCR(op));
     if (ret < 0 && !PyErr_Occurred()) {
         /* Out of memory during sorting or buffer creation */
@@ -949,6 +1216,8 @@ _new_argsortlike(PyArrayObject *op, int axis, PyArray_ArgSortFunc *argsort,
     npy_intp size;
 
     int ret = 0;
+    int nthreads = 1;
+    parallel_sort_info pinfo;
 
     NPY_BEGIN_THREADS_DEF;
 
@@ -975,6 +1244,10 @@ _new_argsortlike(PyArrayObject *op, int axis, PyArray_ArgSortFunc *argsort,
     }
     size = it->size;
 
+    if (argpart == NULL && _can_sort_parallel(PyArray_DESCR(op))) {
+        nthreads = npy_parallel_threads(N);
+    }
+
     NPY_BEGIN_THREADS_DESCR(PyArray_DESCR(op));
 
     if (needcopy) {
@@ -993,6 +1266,20 @@ _new_argsortlike(PyArrayObject *op, int axis, PyArray_ArgSortFunc *argsort,
         }
     }
 
+    if (nthreads > 1) {
+        pinfo.elsize = elsize;
+        pinfo.itemsize = sizeof(npy_intp);
+        pinfo.num = N;
+        pinfo.sort = NULL;
+        pinfo.argsort = argsort;
+        pinfo.compare = PyArray_DESCR(op)->f->compare;
+        pinfo.arr = op;
+        pinfo.scratch = PyDataMem_NEW(N * sizeof(npy_intp));
+        if (pinfo.scratch == NULL) {
+            nthreads = 1;
+        }
+    }
+
     while (size--) {
         char *valptr = it->dataptr;
         npy_intp *idxptr = (npy_intp *)rit->dataptr;
@@ -1031,7 +1318,15 @@ _new_argsortlike(PyArrayObject *op, int axis, PyArray_ArgSortFunc *argsort,
             *iptr++ = i;
         }
 
-        if (argpart == NULL) {
+        if (nthreads > 1) {
+            pinfo.vals = valptr;
+            pinfo.items = (char *)idxptr;
+            ret = _parallel_sort(&pinfo, nthreads);
+            if (ret < 0) {
+                goto fail;
+            }
+        }
+        else if (argpart == NULL) {
             ret = argsort(valptr, idxptr, N, op);
 #if defined(NPY_PY3K)
             /* Object comparisons may raise an exception in Python 3 */
@@ -1078,6 +1373,9 @@ _new_argsortlike(PyArrayObject *op, int axis, PyArray_ArgSortFunc *argsort,
 fail:
     PyDataMem_FREE(valbuffer);
     PyDataMem_FREE(idxbuffer);
+    if (nthreads > 1) {
+        PyDataMem_FREE(pinfo.scratch);
+    }
     NPY_END_THREADS_DESCR(PyArray_DESCR(op));
     if (ret < 0) {
         if (!PyErr_Occurred()) {
@@ -0,0 +1,22 @@
+#ifndef _NPY_MATMUL_H_
+#define _NPY_MATMUL_H_
+
+/*
+ * Whether npy_matmul_stacked supports the type, which is the case for the
+ * types BLAS supports, the integers, booleans and half floats.
+ */
+NPY_NO_EXPORT int
+npy_matmul_supported(int typenum);
+
+/*
+ * Computes numpy.matmul of ap1 and ap2 into out, which must be a C
+ * contiguous array of the result type of both, not overlapping them, of
+ * the shape of the result. The stack dimensions of ap1 and ap2 must
+ * broadcast to stack_shape, of nstack dimensions. Releases the GIL.
+ * Returns 0 on success and -1 with a MemoryError set on failure.
+ */
+NPY_NO_EXPORT int
+npy_matmul_stacked(PyArrayObject *ap1, PyArrayObject *ap2,
+                   PyArrayObject *out, int nstack, npy_intp *stack_shape);
+
+#endif
@@ -59,7 +59,12 @@ NPY_NO_EXPORT int NPY_NUMUSERTYPES = 0;
 #include "vdot.h"
 #include "templ_common.h" /* for npy_mul_with_overflow_intp */
 #include "compiled_base.h"
+#include "textreading.h"
+#include "textformatting.h"
 #include "mem_overlap.h"
+#include "matmul.h"
+#include "npy_threadpool.h"
+#include "npy_cpu_features.h"
 #include "alloc.h"
 
 #include "get_attr_string.h"
@@ -1020,6 +1025,22 @@ PyArray_MatrixProduct2(PyObject *op1, PyObject *op2, PyArrayObject* out)
         memset(PyArray_DATA(out_buf), 0, PyArray_NBYTES(out_buf));
     }
 
+    /*
+     * Vectors and matrices of the types without BLAS are multiplied in
+     * cache blocks by the matmul kernels rather than one dot at a time.
+     */
+    if (PyArray_NDIM(ap1) <= 2 && PyArray_NDIM(ap2) <= 2 &&
+            npy_matmul_supported(typenum)) {
+        if (npy_matmul_stacked(ap1, ap2, out_buf, 0, NULL) < 0) {
+            goto fail;
+        }
+        Py_DECREF(ap1);
+        Py_DECREF(ap2);
+        /* Trigger possible copy-back into `result` */
+        Py_DECREF(out_buf);
+        return (PyObject *)result;
+    }
+
     dot = PyArray_DESCR(out_buf)->f->dotfunc;
     if (dot == NULL) {
         PyErr_SetString(PyExc_ValueError,
@@ -2406,9 +2427,8 @@ array_matmul(PyObject *NPY_UNUSED(m), PyObject *args, PyObject* kwds)
 #endif
 
     /*
-     * Use einsum for the stacked cases. This is a quick implementation
-     * to avoid setting up the proper iterators. Einsum broadcasts, so
-     * we need to check dimensions before the call.
+     * Check the core dimensions, which einsum would broadcast, and pick
+     * the einsum subscripts for the types without a native implementation.
      */
     if (nd1 == 1 && nd2 == 1) {
         /* vector vector */
@@ -2442,6 +2462,66 @@ array_matmul(PyObject *NPY_UNUSED(m), PyObject *args, PyObject* kwds)
         }
         subscripts = "...ij, ...jk";
     }
+
+    /*
+     * The numeric types have a native stacked implementation. It needs an
+     * exact output, einsum handles the rest and broadcasting errors.
+     */
+    if (npy_matmul_supported(typenum)) {
+        int nstack1 = nd1 > 2 ? nd1 - 2 : 0, nstack2 = nd2 > 2 ? nd2 - 2 : 0;
+        int nstack = nstack1 > nstack2 ? nstack1 : nstack2;
+        int nd, idim, broadcastable = 1;
+        npy_intp dims[NPY_MAXDIMS];
+        PyArrayObject *out_buf, *result = NULL;
+
+        for (idim = 0; idim < nstack; idim++) {
+            int i1 = idim - (nstack - nstack1), i2 = idim - (nstack - nstack2);
+            npy_intp d1 = i1 >= 0 ? PyArray_DIM(ap1, i1) : 1;
+            npy_intp d2 = i2 >= 0 ? PyArray_DIM(ap2, i2) : 1;
+
+            if (d1 != d2 && d1 != 1 && d2 != 1) {
+                broadcastable = 0;
+            }
+            dims[idim] = d1 == 1 ? d2 : d1;
+        }
+        nd = nstack;
+        if (nd1 > 1) {
+            dims[nd++] = PyArray_DIM(ap1, nd1 - 2);
+        }
+        if (nd2 > 1) {
+            dims[nd++] = PyArray_DIM(ap2, nd2 - 1);
+        }
+
+        if (broadcastable && (out == NULL ||
+                (Py_TYPE(out) == Py_TYPE(ap1) &&
+                 Py_TYPE(out) == Py_TYPE(ap2) &&
+                 PyArray_TYPE((PyArrayObject *)out) == typenum &&
+                 PyArray_ISCARRAY((PyArrayObject *)out) &&
+                 PyArray_NDIM((PyArrayObject *)out) == nd &&
+                 PyArray_CompareLists(PyArray_DIMS((PyArrayObject *)out),
+                                      dims, nd)))) {
+            out_buf = new_array_for_sum(ap1, ap2, (PyArrayObject *)out,
+                                        nd, dims, typenum, &result);
+            if (out_buf == NULL) {
+                goto fail;
+            }
+            if (npy_matmul_stacked(ap1, ap2, out_buf, nstack, dims) < 0) {
+                Py_DECREF(out_buf);
+                Py_DECREF(result);
+                goto fail;
+            }
+            Py_DECREF(ap1);
+            Py_DECREF(ap2);
+            /* Trigger possible copy-back into `result` */
+            Py_DECREF(out_buf);
+
+            if (out == NULL) {
+                return PyArray_Return(result);
+            }
+            return (PyObject *)result;
+        }
+    }
+
     ops[0] = ap1;
     ops[1] = ap2;
     ret = PyArray_EinsteinSum(subscripts, 2, ops, NULL, order, casting,
@@ -4083,6 +4163,61 @@ normalize_axis_index(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
     return PyInt_FromLong(axis);
 }
 
+/* backend of numpy.setthreads, see numeric.py */
+static PyObject *
+set_num_threads(PyObject *NPY_UNUSED(dummy), PyObject *args)
+{
+    int nthreads;
+
+    if (!PyArg_ParseTuple(args, "i:_set_num_threads", &nthreads)) {
+        return NULL;
+    }
+    if (npy_set_num_threads(nthreads) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+get_num_threads(PyObject *NPY_UNUSED(dummy), PyObject *NPY_UNUSED(args))
+{
+    return PyInt_FromLong(npy_get_num_threads());
+}
+
+static PyObject *
+set_alloc_policy(PyObject *NPY_UNUSED(dummy), PyObject *args)
+{
+    Py_ssize_t alignment, hugepage_threshold;
+    int first_touch;
+
+    if (!PyArg_ParseTuple(args, "nni:_set_alloc_policy", &alignment,
+                          &hugepage_threshold, &first_touch)) {
+        return NULL;
+    }
+    if (alignment < 0 || hugepage_threshold < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "alignment and hugepage_threshold must be >= 0");
+        return NULL;
+    }
+    if (npy_set_alloc_policy(alignment, hugepage_threshold,
+                             first_touch) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+get_alloc_policy(PyObject *NPY_UNUSED(dummy), PyObject *NPY_UNUSED(args))
+{
+    npy_uintp alignment, hugepage_threshold;
+    int first_touch;
+
+    npy_get_alloc_policy(&alignment, &hugepage_threshold, &first_touch);
+    return Py_BuildValue("nnN", (Py_ssize_t)alignment,
+                         (Py_ssize_t)hugepage_threshold,
+                         PyBool_FromLong(first_touch));
+}
+
 static struct PyMethodDef array_module_methods[] = {
     {"_get_ndarray_c_version",
         (PyCFunction)array__get_ndarray_c_version,
@@ -4243,6 +4378,20 @@ static struct PyMethodDef array_module_methods[] = {
         METH_VARARGS | METH_KEYWORDS, NULL},
     {"digitize", (PyCFunction)arr_digitize,
         METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_unique_hash", (PyCFunction)arr_unique_hash,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_in1d_hash", (PyCFunction)arr_in1d_hash,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_histogram_uniform", (PyCFunction)arr_histogram_uniform,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_load_from_filelike", (PyCFunction)arr_load_from_filelike,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_format_rows", (PyCFunction)arr_format_rows,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_format_floats", (PyCFunction)arr_format_floats,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_fraction_digits", (PyCFunction)arr_fraction_digits,
+        METH_VARARGS | METH_KEYWORDS, NULL},
     {"interp", (PyCFunction)arr_interp,
         METH_VARARGS | METH_KEYWORDS, NULL},
     {"interp_complex", (PyCFunction)arr_interp_complex,
@@ -4259,6 +4408,14 @@ static struct PyMethodDef array_module_methods[] = {
         METH_VARARGS | METH_KEYWORDS, NULL},
     {"normalize_axis_index", (PyCFunction)normalize_axis_index,
         METH_VARARGS | METH_KEYWORDS, NULL},
+    {"_set_num_threads", (PyCFunction)set_num_threads,
+        METH_VARARGS, NULL},
+    {"_get_num_threads", (PyCFunction)get_num_threads,
+        METH_NOARGS, NULL},
+    {"_set_alloc_policy", (PyCFunction)set_alloc_policy,
+        METH_VARARGS, NULL},
+    {"_get_alloc_policy", (PyCFunction)get_alloc_policy,
+        METH_NOARGS, NULL},
     {NULL, NULL, 0, NULL}                /* sentinel */
 };
 
@@ -4575,6 +4732,9 @@ PyMODINIT_FUNC initmultiarray(void) {
     if (setup_scalartypes(d) < 0) {
         goto err;
     }
+    if (npy_cpu_init() < 0) {
+        goto err;
+    }
     PyArrayIter_Type.tp_iter = PyObject_SelfIter;
     NpyIter_Type.tp_iter = PyObject_SelfIter;
     PyArrayMultiIter_Type.tp_iter = PyObject_SelfIter;
@@ -4607,6 +4767,9 @@ PyMODINIT_FUNC initmultiarray(void) {
     if (PyType_Ready(&NpyBusDayCalendar_Type) < 0) {
         return RETVAL;
     }
+    if (PyType_Ready(&NpyTextReader_Type) < 0) {
+        return RETVAL;
+    }
 /* FIXME
  * There is no error handling here
  */
@@ -4685,6 +4848,10 @@ PyMODINIT_FUNC initmultiarray(void) {
     Py_INCREF(&NpyBusDayCalendar_Type);
     PyDict_SetItemString(d, "busdaycalendar",
                             (PyObject *)&NpyBusDayCalendar_Type);
+
+    /* Text reader behind np.iter_loadtxt */
+    Py_INCREF(&NpyTextReader_Type);
+    PyDict_SetItemString(d, "_TextReader", (PyObject *)&NpyTextReader_Type);
     set_flaginfo(d);
 
     if (!intern_strings()) {
@@ -0,0 +1,1174 @@
+/*
+ * The text formatter behind np.savetxt and the printing of float arrays.
+ *
+ * Numbers are formatted with printf style conversions following the rules
+ * of Python's % operator, so that the output is the same as when the
+ * elements are formatted one at a time in Python.  Floating point values
+ * get correctly rounded digits for the fixed precision conversions, from
+ * exact 128 bit integer arithmetic where the digits fit and else from
+ * PyOS_double_to_string, which Python's own formatting uses as well.  'r'
+ * gives the shortest string that reads back as the same value at the
+ * precision of the array.  Anything not handled here, such as integer
+ * conversions with a precision, is passed on to Python one value at a
+ * time.
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <string.h>
+
+#define NPY_NO_DEPRECATED_API NPY_API_VERSION
+#define _MULTIARRAYMODULE
+#include "numpy/arrayobject.h"
+#include "numpy/npy_3kcompat.h"
+#include "numpy/npy_math.h"
+#include "numpy/halffloat.h"
+
+#include "npy_config.h"
+#include "npy_pycompat.h"
+#include "common.h"
+#include "textformatting.h"
+
+/* bytes collected before they are passed to the write method */
+#define TF_BUFSIZE (1 << 20)
+
+/* conversion flags */
+#define TF_LJUST 1
+#define TF_SIGN 2
+#define TF_BLANK 4
+#define TF_ALT 8
+#define TF_ZERO 16
+
+typedef struct {
+    /* 'd' (also for 'i' and 'u'), 'e', 'E', 'f', 'F', 'g', 'G' or 'r' */
+    int conv;
+    int flags;
+    /* -1 if not given */
+    int width;
+    int prec;
+    /* the literal text in front of the conversion */
+    npy_intp lit_start, lit_len;
+    /* the conversion alone, for values formatted in Python */
+    PyObject *pyfmt;
+} tf_spec;
+
+typedef struct {
+    tf_spec *specs;
+    npy_intp nspecs;
+    /* the literal text with %% replaced by % */
+    char *text;
+    npy_intp tail_start, tail_len;
+} tf_format;
+
+typedef struct {
+    char *buf;
+    npy_intp len, cap;
+    /* write method the full buffer is passed to, or NULL */
+    PyObject *write;
+} tf_buffer;
+
+typedef struct {
+    enum {TF_BOOL, TF_INT, TF_UINT, TF_FLOAT} kind;
+    npy_int64 i;
+    npy_uint64 u;
+    double d;
+    /* the precision of a TF_FLOAT, 16, 32 or 64 bits */
+    int bits;
+} tf_value;
+
+
+static void
+tf_format_clear(tf_format *f)
+{
+    npy_intp i;
+
+    if (f->specs != NULL) {
+        for (i = 0; i < f->nspecs; i++) {
+            Py_XDECREF(f->specs[i].pyfmt);
+        }
+        PyMem_Free(f->specs);
+    }
+    PyMem_Free(f->text);
+    memset(f, 0, sizeof(*f));
+}
+
+/*
+ * Parses the % format fmt.  Returns 0 on success, 1 if it has a
+ * conversion or mapping key not handled here and -1 on error.
+ */
+static int
+tf_parse_format(tf_format *f, const char *fmt, npy_intp len)
+{
+    npy_intp i = 0, ntext = 0, lit_start = 0;
+
+    memset(f, 0, sizeof(*f));
+    f->text = PyMem_Malloc(len > 0 ? len : 1);
+    /* no more conversions than every other character */
+    f->specs = PyMem_Malloc((len / 2 + 1) * sizeof(tf_spec));
+    if (f->text == NULL || f->specs == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    while (i < len) {
+        tf_spec *s;
+        npy_intp start;
+        char c = fmt[i++];
+
+        if (c != '%') {
+            f->text[ntext++] = c;
+            continue;
+        }
+        if (i < len && fmt[i] == '%') {
+            f->text[ntext++] = '%';
+            i++;
+            continue;
+        }
+        start = i - 1;
+        s = &f->specs[f->nspecs];
+        s->flags = 0;
+        s->width = -1;
+        s->prec = -1;
+        s->pyfmt = NULL;
+        for (; i < len; i++) {
+            switch (fmt[i]) {
+                case '-': s->flags |= TF_LJUST; continue;
+                case '+': s->flags |= TF_SIGN; continue;
+                case ' ': s->flags |= TF_BLANK; continue;
+                case '#': s->flags |= TF_ALT; continue;
+                case '0': s->flags |= TF_ZERO; continue;
+            }
+            break;
+        }
+        if (i < len && fmt[i] >= '0' && fmt[i] <= '9') {
+            s->width = 0;
+            for (; i < len && fmt[i] >= '0' && fmt[i] <= '9'; i++) {
+                if (s->width >= 100000) {
+                    return 1;
+                }
+                s->width = 10 * s->width + (fmt[i] - '0');
+            }
+        }
+        if (i < len && fmt[i] == '.') {
+            s->prec = 0;
+            for (i++; i < len && fmt[i] >= '0' && fmt[i] <= '9'; i++) {
+                if (s->prec >= 100000) {
+                    return 1;
+                }
+                s->prec = 10 * s->prec + (fmt[i] - '0');
+            }
+        }
+        if (i < len && (fmt[i] == 'h' || fmt[i] == 'l' || fmt[i] == 'L')) {
+            i++;
+        }
+        if (i == len) {
+            return 1;
+        }
+        switch (fmt[i]) {
+            case 'd':
+            case 'i':
+            case 'u':
+                s->conv = 'd';
+                break;
+            case 'e':
+            case 'E':
+            case 'f':
+            case 'F':
+            case 'g':
+            case 'G':
+            case 'r':
+                s->conv = fmt[i];
+                break;
+            default:
+                /* mapping keys, '*', %s, %x, ... */
+                return 1;
+        }
+        i++;
+        s->pyfmt = PyUString_FromStringAndSize(fmt + start, i - start);
+        if (s->pyfmt == NULL) {
+            return -1;
+        }
+        s->lit_start = lit_start;
+        s->lit_len = ntext - lit_start;
+        lit_start = ntext;
+        f->nspecs++;
+    }
+    f->tail_start = lit_start;
+    f->tail_len = ntext - lit_start;
+    return 0;
+}
+
+/* Passes the buffer to the write method */
+static int
+tf_flush(tf_buffer *b)
+{
+    PyObject *bytes, *ret;
+
+    if (b->len == 0) {
+        return 0;
+    }
+    bytes = PyBytes_FromStringAndSize(b->buf, b->len);
+    if (bytes == NULL) {
+        return -1;
+    }
+    ret = PyObject_CallFunctionObjArgs(b->write, bytes, NULL);
+    Py_DECREF(bytes);
+    if (ret == NULL) {
+        return -1;
+    }
+    Py_DECREF(ret);
+    b->len = 0;
+    return 0;
+}
+
+/* Makes room for n more bytes */
+static int
+tf_reserve(tf_buffer *b, npy_intp n)
+{
+    if (b->len + n > b->cap) {
+        npy_intp cap = b->cap > 0 ? b->cap : 256;
+        char *buf;
+
+        while (cap < b->len + n) {
+            cap *= 2;
+        }
+        buf = PyMem_Realloc(b->buf, cap);
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        b->buf = buf;
+        b->cap = cap;
+    }
+    return 0;
+}
+
+static int
+tf_put(tf_buffer *b, const char *s, npy_intp n)
+{
+    if (tf_reserve(b, n) < 0) {
+        return -1;
+    }
+    memcpy(b->buf + b->len, s, n);
+    b->len += n;
+    return 0;
+}
+
+/* Appends the str result of a Python formatting, latin-1 encoded */
+static int
+tf_put_object(tf_buffer *b, PyObject *obj)
+{
+    PyObject *bytes;
+    int ret;
+
+    if (PyUnicode_Check(obj)) {
+        bytes = PyUnicode_AsLatin1String(obj);
+        if (bytes == NULL) {
+            return -1;
+        }
+    }
+    else if (PyBytes_Check(obj)) {
+        Py_INCREF(obj);
+        bytes = obj;
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError, "formatting did not return a str");
+        return -1;
+    }
+    ret = tf_put(b, PyBytes_AS_STRING(bytes), PyBytes_GET_SIZE(bytes));
+    Py_DECREF(bytes);
+    return ret;
+}
+
+/*
+ * Appends a number, given as its sign and the digits without it, padded to
+ * the width of the conversion as Python does.
+ */
+static int
+tf_put_number(tf_buffer *b, const tf_spec *s, int neg, const char *body,
+              npy_intp len)
+{
+    char sign = neg ? '-' : (s->flags & TF_SIGN) ? '+' :
+                (s->flags & TF_BLANK) ? ' ' : 0;
+    npy_intp total = len + (sign != 0);
+    npy_intp pad = s->width > total ? s->width - total : 0;
+    char *out;
+
+    if (tf_reserve(b, total + pad) < 0) {
+        return -1;
+    }
+    out = b->buf + b->len;
+    if (!(s->flags & TF_LJUST) && !(s->flags & TF_ZERO)) {
+        memset(out, ' ', pad);
+        out += pad;
+    }
+    if (sign) {
+        *out++ = sign;
+    }
+    if (!(s->flags & TF_LJUST) && (s->flags & TF_ZERO)) {
+        memset(out, '0', pad);
+        out += pad;
+    }
+    memcpy(out, body, len);
+    out += len;
+    if (s->flags & TF_LJUST) {
+        memset(out, ' ', pad);
+        out += pad;
+    }
+    b->len = out - b->buf;
+    return 0;
+}
+
+/* Appends a %r string, cut to the precision and padded with spaces */
+static int
+tf_put_string(tf_buffer *b, const tf_spec *s, const char *str, npy_intp len)
+{
+    npy_intp pad;
+
+    if (s->prec >= 0 && len > s->prec) {
+        len = s->prec;
+    }
+    pad = s->width > len ? s->width - len : 0;
+    if (tf_reserve(b, len + pad) < 0) {
+        return -1;
+    }
+    if (!(s->flags & TF_LJUST)) {
+        memset(b->buf + b->len, ' ', pad);
+        b->len += pad;
+    }
+    memcpy(b->buf + b->len, str, len);
+    b->len += len;
+    if (s->flags & TF_LJUST) {
+        memset(b->buf + b->len, ' ', pad);
+        b->len += pad;
+    }
+    return 0;
+}
+
+/* The decimal digits of v, written backwards from end */
+static char *
+tf_digits(npy_uint64 v, char *end)
+{
+    do {
+        *--end = '0' + (char)(v % 10);
+        v /= 10;
+    } while (v != 0);
+    return end;
+}
+
+#ifdef __SIZEOF_INT128__
+
+static __uint128_t tf_pow10_table[39];
+
+static __uint128_t
+tf_pow10(int n)
+{
+    if (tf_pow10_table[0] == 0) {
+        int i;
+
+        tf_pow10_table[0] = 1;
+        for (i = 1; i < 39; i++) {
+            tf_pow10_table[i] = tf_pow10_table[i - 1] * 10;
+        }
+    }
+    return tf_pow10_table[n];
+}
+
+static int
+tf_bitlen(__uint128_t x)
+{
+    npy_uint64 hi = (npy_uint64)(x >> 64), lo = (npy_uint64)x;
+
+    if (hi != 0) {
+        return 128 - __builtin_clzll(hi);
+    }
+    return lo != 0 ? 64 - __builtin_clzll(lo) : 0;
+}
+
+/*
+ * The integer part q of m * 2**e * 10**s, and in cmp whether the remaining
+ * fraction is below (-1), at (0) or above (1) one half.  Returns -1 if the
+ * product does not fit into 128 bits.
+ */
+static int
+tf_scale(npy_uint64 m, int e, int s, __uint128_t *q, int *cmp)
+{
+    __uint128_t p, x, r, half;
+
+    if (s > 38 || s < -38) {
+        return -1;
+    }
+    if (s >= 0) {
+        p = tf_pow10(s);
+        if (e >= 0) {
+            if (tf_bitlen(m) + e + tf_bitlen(p) > 127) {
+                return -1;
+            }
+            *q = ((__uint128_t)m << e) * p;
+            *cmp = -1;
+            return 0;
+        }
+        if (-e > 127 || tf_bitlen(m) + tf_bitlen(p) > 128) {
+            return -1;
+        }
+        x = (__uint128_t)m * p;
+        *q = x >> -e;
+        r = x & ((((__uint128_t)1) << -e) - 1);
+        half = ((__uint128_t)1) << (-e - 1);
+    }
+    else {
+        p = tf_pow10(-s);
+        if (e >= 0) {
+            if (tf_bitlen(m) + e > 127) {
+                return -1;
+            }
+            x = (__uint128_t)m << e;
+        }
+        else {
+            if (tf_bitlen(p) - e > 127) {
+                return -1;
+            }
+            x = m;
+            p <<= -e;
+        }
+        *q = x / p;
+        r = 2 * (x % p);
+        half = p;
+    }
+    *cmp = r < half ? -1 : r > half;
+    return 0;
+}
+
+/*
+ * The digits of d > 0 as _Py_dg_dtoa gives them, correctly rounded (half
+ * to even) to ndigits significant digits, or with fixed set, to ndigits
+ * digits after the decimal point, and without trailing zeros.  Returns
+ * the number of digits written to the end of buf, and the position of the
+ * decimal point in decpt, or -1 if the digits do not fit in 64 bits, or
+ * without ties, if d is exactly halfway between two results.  The dtoa of
+ * Python before 3.9 keeps trailing zeros for those, which shows in 'g'.
+ */
+static int
+tf_exact_digits(double d, int fixed, int ndigits, int ties, char *buf,
+                int *decpt)
+{
+    npy_uint64 bits, m, limit;
+    __uint128_t q;
+    int e, exp10 = 0, cmp, len, i;
+    char *start, *end = buf + 20;
+
+    if (ndigits > 19 || (!fixed && ndigits < 1)) {
+        return -1;
+    }
+    limit = fixed ? (npy_uint64)1e19 : (npy_uint64)tf_pow10(ndigits);
+    memcpy(&bits, &d, sizeof(bits));
+    m = bits & (((npy_uint64)1 << 52) - 1);
+    e = (int)((bits >> 52) & 0x7ff);
+    if (e == 0) {
+        e = -1074;
+    }
+    else {
+        m |= (npy_uint64)1 << 52;
+        e -= 1075;
+    }
+
+    if (fixed) {
+        if (tf_scale(m, e, ndigits, &q, &cmp) < 0 || q >= limit) {
+            return -1;
+        }
+    }
+    else {
+        /* d is in [2**(b-1), 2**b), so its decimal exponent is exp10 or
+         * exp10 + 1 */
+        int b = tf_bitlen(m) + e;
+
+        exp10 = (int)npy_floor((b - 1) * 0.30102999566398120);
+        for (i = 0;; i++) {
+            if (tf_scale(m, e, ndigits - 1 - exp10, &q, &cmp) < 0) {
+                return -1;
+            }
+            if (q < limit) {
+                break;
+            }
+            if (i > 0) {
+                return -1;
+            }
+            exp10++;
+        }
+    }
+    if (cmp == 0 && !ties) {
+        return -1;
+    }
+    if (cmp > 0 || (cmp == 0 && (q & 1))) {
+        q++;
+    }
+    if (q == 0) {
+        /* rounded away completely, no digits */
+        *decpt = -ndigits;
+        return 0;
+    }
+    if (!fixed && q == limit) {
+        q /= 10;
+        exp10++;
+    }
+    start = tf_digits((npy_uint64)q, end);
+    if (fixed) {
+        exp10 = (int)(end - start) - ndigits - 1;
+    }
+    while (end[-1] == '0') {
+        end--;
+    }
+    len = (int)(end - start);
+    memmove(buf, start, len);
+    *decpt = exp10 + 1;
+    return len;
+}
+
+/*
+ * Lays out the digits of a conversion as format_float_short in CPython's
+ * pystrtod.c does, with the decimal point at decpt.  Returns the length
+ * written to out.
+ */
+static int
+tf_layout(char *out, const char *digits, int ndigits, int decpt,
+          const tf_spec *s)
+{
+    int conv = s->conv, alt = (s->flags & TF_ALT) != 0;
+    int prec = s->prec < 0 ? 6 : s->prec;
+    int use_exp = 0, exp = 0, vstart, vend = ndigits;
+    char *p = out;
+
+    switch (conv) {
+        case 'e':
+        case 'E':
+            use_exp = 1;
+            vend = prec + 1;
+            break;
+        case 'f':
+        case 'F':
+            vend = decpt + prec;
+            break;
+        default:
+            if (prec == 0) {
+                prec = 1;
+            }
+            use_exp = decpt <= -4 || decpt > prec;
+            if (alt) {
+                vend = prec;
+            }
+            break;
+    }
+    if (use_exp) {
+        exp = decpt - 1;
+        decpt = 1;
+    }
+    vstart = decpt <= 0 ? decpt - 1 : 0;
+    if (vend < decpt) {
+        vend = decpt;
+    }
+
+    if (decpt <= 0) {
+        memset(p, '0', decpt - vstart);
+        p += decpt - vstart;
+        *p++ = '.';
+        memset(p, '0', -decpt);
+        p += -decpt;
+    }
+    else {
+        memset(p, '0', -vstart);
+        p += -vstart;
+    }
+    if (0 < decpt && decpt <= ndigits) {
+        memcpy(p, digits, decpt);
+        p += decpt;
+        *p++ = '.';
+        memcpy(p, digits + decpt, ndigits - decpt);
+        p += ndigits - decpt;
+    }
+    else {
+        memcpy(p, digits, ndigits);
+        p += ndigits;
+    }
+    if (ndigits < decpt) {
+        memset(p, '0', decpt - ndigits);
+        p += decpt - ndigits;
+        *p++ = '.';
+        memset(p, '0', vend - decpt);
+        p += vend - decpt;
+    }
+    else {
+        memset(p, '0', vend - ndigits);
+        p += vend - ndigits;
+    }
+    if (p[-1] == '.' && !alt) {
+        p--;
+    }
+    if (use_exp) {
+        *p++ = (conv == 'E' || conv == 'G') ? 'E' : 'e';
+        *p++ = exp < 0 ? '-' : '+';
+        if (exp < 0) {
+            exp = -exp;
+        }
+        if (exp >= 100) {
+            *p++ = '0' + exp / 100;
+        }
+        *p++ = '0' + exp / 10 % 10;
+        *p++ = '0' + exp % 10;
+    }
+    return (int)(p - out);
+}
+
+#endif
+
+/*
+ * Appends d formatted with the float conversion s.  Digits are found with
+ * 128 bit integer arithmetic where they fit, which is exact and much faster
+ * than the arbitrary precision dtoa, and with PyOS_double_to_string else.
+ */
+static int
+tf_put_double(tf_buffer *b, const tf_spec *s, double d)
+{
+    char *str;
+    int neg, ret;
+
+#ifdef __SIZEOF_INT128__
+    if (npy_isfinite(d)) {
+        int prec = s->prec < 0 ? 6 : s->prec;
+        int fixed = s->conv == 'f' || s->conv == 'F';
+        int ties = s->conv != 'g' && s->conv != 'G';
+        int ndigits = fixed ? prec :
+                      (s->conv == 'e' || s->conv == 'E') ? prec + 1 :
+                      prec == 0 ? 1 : prec;
+        int len = 1, decpt = 1;
+        char digits[24] = "0", out[128];
+
+        neg = npy_signbit(d) != 0;
+        if (d != 0) {
+            len = tf_exact_digits(neg ? -d : d, fixed, ndigits, ties,
+                                  digits, &decpt);
+        }
+        if (len >= 0) {
+            return tf_put_number(b, s, neg, out,
+                                 tf_layout(out, digits, len, decpt, s));
+        }
+    }
+#endif
+    str = PyOS_double_to_string(d, (char)s->conv, s->prec < 0 ? 6 : s->prec,
+                                (s->flags & TF_ALT) ? Py_DTSF_ALT : 0, NULL);
+    if (str == NULL) {
+        return -1;
+    }
+    neg = str[0] == '-';
+    ret = tf_put_number(b, s, neg, str + neg, strlen(str + neg));
+    PyMem_Free(str);
+    return ret;
+}
+
+/*
+ * The shortest repr of d that reads back as the same value of its
+ * precision.  Half and single precision values are tried with increasing
+ * numbers of digits, the double closest to the first decimal that rounds
+ * to the value has the same digits as its repr.
+ */
+static char *
+tf_shortest(double d, int bits)
+{
+    if (bits < 64 && npy_isfinite(d)) {
+        int p, maxdigits = bits == 32 ? 9 : 5;
+
+        for (p = 1; p <= maxdigits; p++) {
+            char *s = PyOS_double_to_string(d, 'e', p - 1, 0, NULL);
+            double t;
+
+            if (s == NULL) {
+                return NULL;
+            }
+            t = PyOS_string_to_double(s, NULL, NULL);
+            PyMem_Free(s);
+            if (bits == 32 ? (float)t == (float)d :
+                             npy_double_to_half(t) == npy_double_to_half(d)) {
+                d = t;
+                break;
+            }
+        }
+    }
+    return PyOS_double_to_string(d, 'r', 0, Py_DTSF_ADD_DOT_0, NULL);
+}
+
+static NPY_INLINE int
+tf_supported_type(int type_num)
+{
+    return PyTypeNum_ISBOOL(type_num) || PyTypeNum_ISINTEGER(type_num) ||
+           type_num == NPY_HALF || type_num == NPY_FLOAT ||
+           type_num == NPY_DOUBLE;
+}
+
+static void
+tf_get_value(int type_num, const char *p, tf_value *v)
+{
+    switch (type_num) {
+        case NPY_BOOL:
+            v->kind = TF_BOOL;
+            v->i = *(npy_bool *)p != 0;
+            return;
+#define TF_SIGNED(NUM, TYPE)                                   \
+        case NUM:                                              \
+            v->kind = TF_INT;                                  \
+            v->i = *(TYPE *)p;                                 \
+            return;
+#define TF_UNSIGNED(NUM, TYPE)                                 \
+        case NUM:                                              \
+            v->kind = TF_UINT;                                 \
+            v->u = *(TYPE *)p;                                 \
+            return;
+        TF_SIGNED(NPY_BYTE, npy_byte)
+        TF_SIGNED(NPY_SHORT, npy_short)
+        TF_SIGNED(NPY_INT, npy_int)
+        TF_SIGNED(NPY_LONG, npy_long)
+        TF_SIGNED(NPY_LONGLONG, npy_longlong)
+        TF_UNSIGNED(NPY_UBYTE, npy_ubyte)
+        TF_UNSIGNED(NPY_USHORT, npy_ushort)
+        TF_UNSIGNED(NPY_UINT, npy_uint)
+        TF_UNSIGNED(NPY_ULONG, npy_ulong)
+        TF_UNSIGNED(NPY_ULONGLONG, npy_ulonglong)
+#undef TF_SIGNED
+#undef TF_UNSIGNED
+        case NPY_HALF:
+            v->kind = TF_FLOAT;
+            v->d = npy_half_to_double(*(npy_half *)p);
+            v->bits = 16;
+            return;
+        case NPY_FLOAT:
+            v->kind = TF_FLOAT;
+            v->d = *(npy_float *)p;
+            v->bits = 32;
+            return;
+        default:
+            v->kind = TF_FLOAT;
+            v->d = *(npy_double *)p;
+            v->bits = 64;
+            return;
+    }
+}
+
+/* Formats the element at p of arr in Python with the conversion alone */
+static int
+tf_format_python(tf_buffer *b, const tf_spec *s, PyArrayObject *arr,
+                 char *p)
+{
+    PyObject *scalar, *str;
+    int ret;
+
+    scalar = PyArray_Scalar(p, PyArray_DESCR(arr), (PyObject *)arr);
+    if (scalar == NULL) {
+        return -1;
+    }
+    str = PyNumber_Remainder(s->pyfmt, scalar);
+    Py_DECREF(scalar);
+    if (str == NULL) {
+        return -1;
+    }
+    ret = tf_put_object(b, str);
+    Py_DECREF(str);
+    return ret;
+}
+
+/* Formats the element at p of arr as s->pyfmt % element would */
+static int
+tf_format_value(tf_buffer *b, const tf_spec *s, PyArrayObject *arr, char *p)
+{
+    tf_value v = {TF_BOOL, 0, 0, 0., 64};
+    char digits[24], *start, *end = digits + sizeof(digits);
+    char *str;
+    int ret, neg;
+
+    tf_get_value(PyArray_DESCR(arr)->type_num, p, &v);
+    if (s->conv == 'd') {
+        if (s->prec >= 0) {
+            /* zero padding to the precision differs between Pythons */
+            return tf_format_python(b, s, arr, p);
+        }
+        if (v.kind == TF_FLOAT) {
+            /* truncated like int(), unless that needs a Python long */
+            if (!(v.d > -9.2e18 && v.d < 9.2e18)) {
+                return tf_format_python(b, s, arr, p);
+            }
+            v.kind = TF_INT;
+            v.i = (npy_int64)v.d;
+        }
+        if (v.kind == TF_UINT) {
+            neg = 0;
+            start = tf_digits(v.u, end);
+        }
+        else {
+            neg = v.i < 0;
+            start = tf_digits(neg ? -(npy_uint64)v.i : (npy_uint64)v.i, end);
+        }
+        return tf_put_number(b, s, neg, start, end - start);
+    }
+    if (s->conv == 'r') {
+        switch (v.kind) {
+            case TF_BOOL:
+                return v.i ? tf_put_string(b, s, "True", 4) :
+                             tf_put_string(b, s, "False", 5);
+            case TF_INT:
+                start = tf_digits(v.i < 0 ? -(npy_uint64)v.i :
+                                            (npy_uint64)v.i, end);
+                if (v.i < 0) {
+                    *--start = '-';
+                }
+                return tf_put_string(b, s, start, end - start);
+            case TF_UINT:
+                start = tf_digits(v.u, end);
+                return tf_put_string(b, s, start, end - start);
+            default:
+                str = tf_shortest(v.d, v.bits);
+                if (str == NULL) {
+                    return -1;
+                }
+                ret = tf_put_string(b, s, str, strlen(str));
+                PyMem_Free(str);
+                return ret;
+        }
+    }
+
+    if (v.kind == TF_INT || v.kind == TF_BOOL) {
+        v.d = (double)v.i;
+    }
+    else if (v.kind == TF_UINT) {
+        v.d = (double)v.u;
+    }
+    return tf_put_double(b, s, v.d);
+}
+
+/*
+ * Parses format, a str or bytes, into f.  Returns 1 if the text
+ * formatter cannot handle it.
+ */
+static int
+tf_setup_format(tf_format *f, PyObject *format)
+{
+    PyObject *bytes;
+    int ret;
+
+    if (PyUnicode_Check(format)) {
+        bytes = PyUnicode_AsLatin1String(format);
+        if (bytes == NULL) {
+            PyErr_Clear();
+            return 1;
+        }
+    }
+    else if (PyBytes_Check(format)) {
+        Py_INCREF(format);
+        bytes = format;
+    }
+    else {
+        PyErr_SetString(PyExc_TypeError, "format must be a str");
+        return -1;
+    }
+    ret = tf_parse_format(f, PyBytes_AS_STRING(bytes),
+                          PyBytes_GET_SIZE(bytes));
+    Py_DECREF(bytes);
+    return ret;
+}
+
+/*
+ * _format_rows(X, format, newline, file)
+ *
+ * Writes format % tuple(row) + newline for every row of the 2-d array X to
+ * file, latin-1 encoded and in large blocks.  Returns NotImplemented,
+ * without writing, if X or format are not handled here.
+ */
+NPY_NO_EXPORT PyObject *
+arr_format_rows(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
+{
+    PyObject *X, *format, *newline, *file, *nl_bytes = NULL;
+    PyArrayObject *arr = NULL;
+    tf_format f;
+    tf_buffer b = {NULL, 0, 0, NULL};
+    npy_intp i, j, nrows, ncols;
+    int ret;
+    static char *kwlist[] = {"X", "format", "newline", "file", NULL};
+
+    memset(&f, 0, sizeof(f));
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOOO:_format_rows", kwlist,
+                                     &X, &format, &newline, &file)) {
+        return NULL;
+    }
+    if (!PyArray_Check(X) || PyArray_NDIM((PyArrayObject *)X) != 2 ||
+            !tf_supported_type(PyArray_DESCR((PyArrayObject *)X)->type_num)) {
+        goto not_implemented;
+    }
+    ret = tf_setup_format(&f, format);
+    if (ret != 0) {
+        if (ret < 0) {
+            goto fail;
+        }
+        goto not_implemented;
+    }
+    ncols = PyArray_DIM((PyArrayObject *)X, 1);
+    if (f.nspecs != ncols) {
+        goto not_implemented;
+    }
+    if (PyUnicode_Check(newline)) {
+        nl_bytes = PyUnicode_AsLatin1String(newline);
+        if (nl_bytes == NULL) {
+            PyErr_Clear();
+            goto not_implemented;
+        }
+    }
+    else if (PyBytes_Check(newline)) {
+        Py_INCREF(newline);
+        nl_bytes = newline;
+    }
+    else {
+        goto not_implemented;
+    }
+
+    /* the elements are read directly, so they have to be behaved */
+    if (PyArray_ISBEHAVED_RO((PyArrayObject *)X)) {
+        Py_INCREF(X);
+        arr = (PyArrayObject *)X;
+    }
+    else {
+        PyArray_Descr *descr = PyArray_DescrNewByteorder(
+                                    PyArray_DESCR((PyArrayObject *)X),
+                                    NPY_NATIVE);
+        if (descr == NULL) {
+            goto fail;
+        }
+        arr = (PyArrayObject *)PyArray_FromArray((PyArrayObject *)X, descr,
+                                                 NPY_ARRAY_ALIGNED);
+        if (arr == NULL) {
+            goto fail;
+        }
+    }
+    b.write = PyObject_GetAttrString(file, "write");
+    if (b.write == NULL) {
+        goto fail;
+    }
+
+    nrows = PyArray_DIM(arr, 0);
+    for (i = 0; i < nrows; i++) {
+        char *row = PyArray_BYTES(arr) + i * PyArray_STRIDE(arr, 0);
+
+        for (j = 0; j < ncols; j++) {
+            tf_spec *s = &f.specs[j];
+
+            if (tf_put(&b, f.text + s->lit_start, s->lit_len) < 0 ||
+                    tf_format_value(&b, s, arr,
+                                    row + j * PyArray_STRIDE(arr, 1)) < 0) {
+                goto fail;
+            }
+        }
+        if (tf_put(&b, f.text + f.tail_start, f.tail_len) < 0 ||
+                tf_put(&b, PyBytes_AS_STRING(nl_bytes),
+                       PyBytes_GET_SIZE(nl_bytes)) < 0) {
+            goto fail;
+        }
+        if (b.len >= TF_BUFSIZE && tf_flush(&b) < 0) {
+            goto fail;
+        }
+    }
+    if (tf_flush(&b) < 0) {
+        goto fail;
+    }
+    PyMem_Free(b.buf);
+    Py_DECREF(b.write);
+    Py_DECREF(arr);
+    Py_DECREF(nl_bytes);
+    tf_format_clear(&f);
+    Py_RETURN_NONE;
+
+not_implemented:
+    Py_XDECREF(nl_bytes);
+    tf_format_clear(&f);
+    Py_INCREF(Py_NotImplemented);
+    return Py_NotImplemented;
+
+fail:
+    PyMem_Free(b.buf);
+    Py_XDECREF(b.write);
+    Py_XDECREF(arr);
+    Py_XDECREF(nl_bytes);
+    tf_format_clear(&f);
+    return NULL;
+}
+
+/*
+ * Parses a format of a single float conversion and nothing else, for the
+ * functions used by the array printing.
+ */
+static int
+tf_setup_float_format(tf_format *f, PyObject *format)
+{
+    int ret = tf_setup_format(f, format);
+
+    if (ret < 0) {
+        return -1;
+    }
+    if (ret > 0 || f->nspecs != 1 || f->specs[0].lit_len != 0 ||
+            f->tail_len != 0 || f->specs[0].conv == 'd' ||
+            f->specs[0].conv == 'r') {
+        PyErr_SetString(PyExc_ValueError,
+                        "format must be a single float conversion");
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * _format_floats(a, format, exp_format=False, large_exponent=False,
+ *                strip_zeros=False)
+ *
+ * Returns an object array of the shape of a with format % x for each
+ * element, adjusted as FloatFormat does for finite values: with a
+ * large_exponent the exponent gets three digits, else with exp_format two,
+ * and with strip_zeros trailing zeros are replaced by spaces.
+ */
+NPY_NO_EXPORT PyObject *
+arr_format_floats(PyObject *NPY_UNUSED(self), PyObject *args, PyObject *kwds)
+{
+    PyObject *a, *format;
+    PyArrayObject *arr = NULL, *ret = NULL;
+    PyObject **out;
+    double *data;
+    int exp_format = 0, large_exponent = 0, strip_zeros = 0;
+    tf_format f;
+    tf_buffer b = {NULL, 0, 0, NULL};
+    npy_intp i, n;
+    static char *kwlist[] = {"a", "format", "exp_format", "large_exponent",
+                             "strip_zeros", NULL};
+
+    memset(&f, 0, sizeof(f));
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|iii:_format_floats",
+                                     kwlist, &a, &format, &exp_format,
+                                     &large_exponent, &strip_zeros)) {
+        return NULL;
+    }
+    if (tf_setup_float_format(&f, format) < 0) {
+        goto fail;
+    }
+    arr = (PyArrayObject *)PyArray_FROM_OTF(a, NPY_DOUBLE,
+                                            NPY_ARRAY_CARRAY_RO);
+    if (arr == NULL) {
+        goto fail;
+    }
+    ret = (PyArrayObject *)PyArray_SimpleNew(PyArray_NDIM(arr),
+                                             PyArray_DIMS(arr), NPY_OBJECT);
+    if (ret == NULL) {
+        goto fail;
+    }
+    out = (PyObject **)PyArray_DATA(ret);
+    data = (double *)PyArray_DATA(arr);
+    n = PyArray_SIZE(arr);
+    for (i = 0; i < n; i++) {
+        tf_spec *s = &f.specs[0];
+        char *p;
+
+        b.len = 0;
+        if (tf_put_double(&b, s, data[i]) < 0) {
+            goto fail;
+        }
+        p = b.buf;
+        if (npy_isfinite(data[i])) {
+            char *e = p + b.len;
+
+            if (large_exponent) {
+                if (b.len >= 3 && (e[-3] == '+' || e[-3] == '-')) {
+                    /* s[1:-2] + '0' + s[-2:] */
+                    if (tf_reserve(&b, 1) < 0) {
+                        goto fail;
+                    }
+                    p = b.buf;
+                    e = p + b.len;
+                    memmove(e - 1, e - 2, 2);
+                    e[-2] = '0';
+                    b.len++;
+                    p++;
+                }
+            }
+            else if (exp_format) {
+                if (b.len >= 3 && e[-3] == '0') {
+                    /* ' ' + s[:-3] + s[-2:] */
+                    memmove(p + 1, p, b.len - 3);
+                    *p = ' ';
+                }
+            }
+            else if (strip_zeros) {
+                while (e > p && e[-1] == '0') {
+                    *--e = ' ';
+                }
+            }
+        }
+        out[i] = PyUString_FromStringAndSize(p, b.buf + b.len - p);
+        if (out[i] == NULL) {
+            goto fail;
+        }
+    }
+    PyMem_Free(b.buf);
+    tf_format_clear(&f);
+    Py_DECREF(arr);
+    return (PyObject *)ret;
+
+fail:
+    PyMem_Free(b.buf);
+    tf_format_clear(&f);
+    Py_XDECREF(arr);
+    Py_XDECREF(ret);
+    return NULL;
+}
+
+/*
+ * _fraction_digits(a, precision)
+ *
+ * The most digits after the decimal point that '%.<precision>f' % x
+ * has for the elements of a, ignoring trailing zeros.
+ */
+NPY_NO_EXPORT PyObject *
+arr_fraction_digits(PyObject *NPY_UNUSED(self), PyObject *args,
+                    PyObject *kwds)
+{
+    PyObject *a;
+    PyArrayObject *arr;
+    double *data;
+    int precision, digits = 0;
+    tf_spec spec = {'f', 0, -1, 0, 0, 0, NULL};
+    tf_buffer b = {NULL, 0, 0, NULL};
+    npy_intp i, n;
+    static char *kwlist[] = {"a", "precision", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "Oi:_fraction_digits",
+                                     kwlist, &a, &precision)) {
+        return NULL;
+    }
+    if (precision < 0) {
+        PyErr_SetString(PyExc_ValueError, "precision must not be negative");
+        return NULL;
+    }
+    arr = (PyArrayObject *)PyArray_FROM_OTF(a, NPY_DOUBLE,
+                                            NPY_ARRAY_CARRAY_RO);
+    if (arr == NULL) {
+        return NULL;
+    }
+    spec.prec = precision;
+    data = (double *)PyArray_DATA(arr);
+    n = PyArray_SIZE(arr);
+    for (i = 0; i < n && precision > 0 && digits < precision; i++) {
+        npy_intp zeros = 0;
+
+        b.len = 0;
+        if (tf_put_double(&b, &spec, data[i]) < 0) {
+            PyMem_Free(b.buf);
+            Py_DECREF(arr);
+            return NULL;
+        }
+        while (zeros < b.len && b.buf[b.len - 1 - zeros] == '0') {
+            zeros++;
+        }
+        if (precision - zeros > digits) {
+            digits = (int)(precision - zeros);
+        }
+    }
+    PyMem_Free(b.buf);
+    Py_DECREF(arr);
+    return PyInt_FromLong(digits);
+}
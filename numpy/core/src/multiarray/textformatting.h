@@ -0,0 +1,13 @@
+#ifndef _NPY_TEXTFORMATTING_H_
+#define _NPY_TEXTFORMATTING_H_
+
+NPY_NO_EXPORT PyObject *
+arr_format_rows(PyObject *, PyObject *, PyObject *);
+
+NPY_NO_EXPORT PyObject *
+arr_format_floats(PyObject *, PyObject *, PyObject *);
+
+NPY_NO_EXPORT PyObject *
+arr_fraction_digits(PyObject *, PyObject *, PyObject *);
+
+#endif
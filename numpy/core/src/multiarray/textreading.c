@@ -0,0 +1,1416 @@
+/*
+ * The text reader behind np.loadtxt and np.genfromtxt.
+ *
+ * The input is read in large chunks from a file-like object (or line by
+ * line from any other iterable) and split into rows and fields in C.  Each
+ * field is parsed straight into a growing buffer of rows of the requested
+ * dtype.  Fields the fast parsers below do not accept are handed to a
+ * Python converter, whose result is stored with the dtype's setitem, so
+ * that anything the converter accepts (or the error it raises) is the same
+ * as when reading line by line in Python.
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include <float.h>
+#include <string.h>
+
+#define NPY_NO_DEPRECATED_API NPY_API_VERSION
+#define _MULTIARRAYMODULE
+#include "numpy/arrayobject.h"
+#include "numpy/npy_3kcompat.h"
+#include "numpy/halffloat.h"
+
+#include "npy_config.h"
+#include "npy_pycompat.h"
+#include "common.h"
+#include "conversion_utils.h"
+#include "numpyos.h"
+#include "textreading.h"
+
+/* number of bytes (or characters for text files) read at a time */
+#define TR_CHUNKSIZE (1 << 20)
+
+/* returned by tr_next_row if the row may continue past the buffer */
+#define TR_NEED_MORE -2
+
+/* how a field is parsed, anything but TR_CONVERT is tried first in C */
+enum {
+    TR_CONVERT,
+    TR_BOOL,
+    TR_INT,
+    TR_UINT,
+    TR_HALF,
+    TR_FLOAT,
+    TR_DOUBLE,
+    TR_BYTES,
+    TR_UNICODE
+};
+
+typedef struct {
+    int kind;
+    int itemsize;
+    npy_intp offset;
+    /* called with the field as bytes when kind is TR_CONVERT or fails */
+    PyObject *converter;
+    /* 0-d array of the field dtype the converter result is set into */
+    PyArrayObject *tmp;
+} tr_field;
+
+typedef struct {
+    /* input, either a bound read method or an iterator over lines */
+    PyObject *read;
+    PyObject *iter;
+    char *buf;
+    npy_intp len, pos, cap;
+    int eof;
+
+    /* dialect */
+    const char *delimiter;      /* NULL to split at runs of whitespace */
+    npy_intp delimlen;
+    PyObject *comments;         /* tuple of non-empty bytes, or NULL */
+    char comment_first[256];    /* first bytes of the comments */
+    int quotechar;              /* -1 without quoting */
+    int strip_spaces;           /* strip spaces, not only \r\n, from lines */
+    int strip_fields;           /* strip whitespace from every field */
+
+    /* the values of the current row, NUL terminated in valuebuf */
+    char *valuebuf;
+    npy_intp valuebuf_cap;
+    npy_intp *value_start;
+    npy_intp *value_len;
+    npy_intp nvalues, values_cap;
+    npy_intp line;              /* physical lines consumed so far */
+    npy_intp row_line;          /* line the current row starts on */
+
+    /* conversion of the selected values into a row of the output */
+    tr_field *fields;
+    npy_intp nfields;
+    npy_intp *usecols;
+    npy_intp nusecols;
+    npy_intp *selected;
+    npy_intp ncols;             /* values per row without usecols */
+    npy_intp rowsize;
+    npy_intp lineno;            /* reported number of line 0 */
+    PyObject *invalid;          /* list collecting bad rows, or NULL */
+} tr_reader;
+
+
+static NPY_INLINE int
+tr_isspace(unsigned char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v' ||
+           c == '\f';
+}
+
+static void
+tr_reader_clear(tr_reader *r)
+{
+    npy_intp i;
+
+    Py_CLEAR(r->read);
+    Py_CLEAR(r->iter);
+    Py_CLEAR(r->comments);
+    PyMem_Free(r->buf);
+    PyMem_Free(r->valuebuf);
+    PyMem_Free(r->value_start);
+    PyMem_Free(r->value_len);
+    if (r->fields != NULL) {
+        for (i = 0; i < r->nfields; i++) {
+            Py_XDECREF(r->fields[i].converter);
+            Py_XDECREF(r->fields[i].tmp);
+        }
+        PyMem_Free(r->fields);
+    }
+    PyMem_Free(r->usecols);
+    PyMem_Free(r->selected);
+    memset(r, 0, sizeof(*r));
+}
+
+/*
+ * Appends the bytes, or latin-1 encoded text, in obj to the buffer, with a
+ * newline if line is set and it does not end with one.
+ */
+static int
+tr_append(tr_reader *r, PyObject *obj, int line)
+{
+    PyObject *bytes;
+    npy_intp n, need;
+
+    if (PyUnicode_Check(obj)) {
+        bytes = PyUnicode_AsLatin1String(obj);
+        if (bytes == NULL) {
+            return -1;
+        }
+    }
+    else if (PyBytes_Check(obj)) {
+        Py_INCREF(obj);
+        bytes = obj;
+    }
+    else {
+        PyErr_Format(PyExc_TypeError,
+                     "text input must be str or bytes, not %s",
+                     Py_TYPE(obj)->tp_name);
+        return -1;
+    }
+    n = PyBytes_GET_SIZE(bytes);
+    need = r->len + n + 1;
+    if (need > r->cap) {
+        npy_intp cap = r->cap > 0 ? r->cap : 4096;
+        char *buf;
+
+        while (cap < need) {
+            cap *= 2;
+        }
+        buf = PyMem_Realloc(r->buf, cap);
+        if (buf == NULL) {
+            Py_DECREF(bytes);
+            PyErr_NoMemory();
+            return -1;
+        }
+        r->buf = buf;
+        r->cap = cap;
+    }
+    memcpy(r->buf + r->len, PyBytes_AS_STRING(bytes), n);
+    r->len += n;
+    if (line && (n == 0 || r->buf[r->len - 1] != '\n')) {
+        r->buf[r->len++] = '\n';
+    }
+    Py_DECREF(bytes);
+    return 0;
+}
+
+/*
+ * Moves the unfinished row to the front of the buffer and appends the next
+ * chunk of input, or sets eof.
+ */
+static int
+tr_refill(tr_reader *r)
+{
+    PyObject *chunk;
+    int ret;
+
+    if (r->pos > 0) {
+        memmove(r->buf, r->buf + r->pos, r->len - r->pos);
+        r->len -= r->pos;
+        r->pos = 0;
+    }
+    if (r->read != NULL) {
+        npy_intp len = r->len;
+
+        chunk = PyObject_CallFunction(r->read, "n", (Py_ssize_t)TR_CHUNKSIZE);
+        if (chunk == NULL) {
+            return -1;
+        }
+        ret = tr_append(r, chunk, 0);
+        r->eof = r->len == len;
+    }
+    else {
+        chunk = PyIter_Next(r->iter);
+        if (chunk == NULL) {
+            if (PyErr_Occurred()) {
+                return -1;
+            }
+            r->eof = 1;
+            return 0;
+        }
+        ret = tr_append(r, chunk, 1);
+    }
+    Py_DECREF(chunk);
+    return ret;
+}
+
+/* Whether one of the comments starts at p */
+static int
+tr_is_comment(tr_reader *r, const char *p, const char *end)
+{
+    Py_ssize_t i, n = PyTuple_GET_SIZE(r->comments);
+
+    for (i = 0; i < n; i++) {
+        PyObject *c = PyTuple_GET_ITEM(r->comments, i);
+        npy_intp len = PyBytes_GET_SIZE(c);
+
+        if (end - p >= len && memcmp(p, PyBytes_AS_STRING(c), len) == 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* The start of the first comment in [p, end), or end */
+static const char *
+tr_find_comment(tr_reader *r, const char *p, const char *end)
+{
+    if (r->comments == NULL) {
+        return end;
+    }
+    if (PyTuple_GET_SIZE(r->comments) == 1) {
+        PyObject *c = PyTuple_GET_ITEM(r->comments, 0);
+
+        while ((p = memchr(p, PyBytes_AS_STRING(c)[0], end - p)) != NULL) {
+            if (tr_is_comment(r, p, end)) {
+                return p;
+            }
+            p++;
+        }
+        return end;
+    }
+    for (; p < end; p++) {
+        if (r->comment_first[(unsigned char)*p] && tr_is_comment(r, p, end)) {
+            return p;
+        }
+    }
+    return end;
+}
+
+static int
+tr_reserve_values(tr_reader *r, npy_intp n)
+{
+    if (2 * n + 2 > r->valuebuf_cap) {
+        char *buf = PyMem_Realloc(r->valuebuf, 2 * n + 2);
+
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        r->valuebuf = buf;
+        r->valuebuf_cap = 2 * n + 2;
+    }
+    if (n + 1 > r->values_cap) {
+        npy_intp *start = PyMem_Realloc(r->value_start,
+                                        (n + 1) * sizeof(npy_intp));
+        npy_intp *len;
+
+        if (start == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        r->value_start = start;
+        len = PyMem_Realloc(r->value_len, (n + 1) * sizeof(npy_intp));
+        if (len == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        r->value_len = len;
+        r->values_cap = n + 1;
+    }
+    return 0;
+}
+
+/* Terminates the value written to [start, *out) and records it */
+static NPY_INLINE void
+tr_end_value(tr_reader *r, char *start, char **out)
+{
+    char *end = *out;
+
+    if (r->strip_fields) {
+        while (start < end && tr_isspace(*start)) {
+            start++;
+        }
+        while (end > start && tr_isspace(end[-1])) {
+            end--;
+        }
+    }
+    *end = '\0';
+    r->value_start[r->nvalues] = start - r->valuebuf;
+    r->value_len[r->nvalues] = end - start;
+    r->nvalues++;
+    *out += 1;
+}
+
+/*
+ * Splits the line content [s, e) into values like bytes.split(delimiter),
+ * where quoted parts, in which a doubled quotechar stands for itself, do
+ * not split.
+ */
+static int
+tr_split(tr_reader *r, const char *s, const char *e)
+{
+    const int quote = r->quotechar;
+    int quoted = 0;
+    char *out, *start;
+
+    r->nvalues = 0;
+    if (s == e) {
+        return 0;
+    }
+    if (tr_reserve_values(r, e - s) < 0) {
+        return -1;
+    }
+    out = r->valuebuf;
+    if (r->delimiter == NULL) {
+        for (;;) {
+            while (s < e && tr_isspace(*s)) {
+                s++;
+            }
+            if (s == e) {
+                break;
+            }
+            start = out;
+            while (s < e) {
+                unsigned char c = *s;
+
+                if (c == quote) {
+                    if (quoted && s + 1 < e && s[1] == quote) {
+                        *out++ = c;
+                        s += 2;
+                        continue;
+                    }
+                    quoted = !quoted;
+                    s++;
+                    continue;
+                }
+                if (!quoted && tr_isspace(c)) {
+                    break;
+                }
+                *out++ = c;
+                s++;
+            }
+            tr_end_value(r, start, &out);
+        }
+    }
+    else {
+        const char *delim = r->delimiter;
+        const npy_intp dlen = r->delimlen;
+
+        for (;;) {
+            start = out;
+            while (s < e) {
+                unsigned char c = *s;
+
+                if (c == quote) {
+                    if (quoted && s + 1 < e && s[1] == quote) {
+                        *out++ = c;
+                        s += 2;
+                        continue;
+                    }
+                    quoted = !quoted;
+                    s++;
+                    continue;
+                }
+                if (!quoted && c == (unsigned char)delim[0] &&
+                        (dlen == 1 ||
+                         (e - s >= dlen && memcmp(s, delim, dlen) == 0))) {
+                    break;
+                }
+                *out++ = c;
+                s++;
+            }
+            tr_end_value(r, start, &out);
+            if (s == e) {
+                break;
+            }
+            s += dlen;
+        }
+    }
+    return 0;
+}
+
+static NPY_INLINE int
+tr_strip_char(tr_reader *r, char c)
+{
+    return c == '\r' || c == '\n' || (r->strip_spaces && c == ' ');
+}
+
+/*
+ * Splits the next row of the buffer into values, leaving out comments and
+ * the line terminator.  Returns 1 if there was a row, possibly without any
+ * values, 0 at the end of the input and TR_NEED_MORE if the row may go on
+ * past the end of the buffer.
+ */
+static int
+tr_next_row(tr_reader *r)
+{
+    const char *p = r->buf + r->pos, *end = r->buf + r->len;
+    const char *q, *stop, *next;
+    npy_intp nlines = 1;
+
+    if (p == end) {
+        return r->eof ? 0 : TR_NEED_MORE;
+    }
+    if (r->quotechar < 0) {
+        q = memchr(p, '\n', end - p);
+        if (q == NULL) {
+            if (!r->eof) {
+                return TR_NEED_MORE;
+            }
+            q = end;
+        }
+        stop = tr_find_comment(r, p, q);
+    }
+    else {
+        int quoted = 0;
+
+        stop = NULL;
+        for (q = p; q < end; q++) {
+            unsigned char c = *q;
+
+            if (c == r->quotechar) {
+                quoted = !quoted;
+            }
+            else if (quoted) {
+                nlines += c == '\n';
+            }
+            else if (c == '\n') {
+                break;
+            }
+            else if (r->comments != NULL && r->comment_first[c] &&
+                     tr_is_comment(r, q, end)) {
+                stop = q;
+                q = memchr(q, '\n', end - q);
+                if (q == NULL) {
+                    q = end;
+                }
+                break;
+            }
+        }
+        if (q == end && !r->eof) {
+            return TR_NEED_MORE;
+        }
+        if (stop == NULL) {
+            stop = q;
+        }
+    }
+    next = q < end ? q + 1 : end;
+
+    while (p < stop && tr_strip_char(r, *p)) {
+        p++;
+    }
+    while (stop > p && tr_strip_char(r, stop[-1])) {
+        stop--;
+    }
+    if (tr_split(r, p, stop) < 0) {
+        return -1;
+    }
+    r->pos = next - r->buf;
+    r->row_line = r->line;
+    r->line += nlines;
+    return 1;
+}
+
+/*
+ * Parses a decimal integer between optional whitespace into its magnitude
+ * and sign.  Returns -1 if the value is anything else or its magnitude does
+ * not fit in 64 bits.
+ */
+static int
+tr_parse_integer(const char *str, npy_intp len, npy_uint64 *mag,
+                 int *negative)
+{
+    const char *p = str, *end = str + len;
+    npy_uint64 v = 0;
+
+    while (p < end && tr_isspace(*p)) {
+        p++;
+    }
+    *negative = 0;
+    if (p < end && (*p == '-' || *p == '+')) {
+        *negative = *p == '-';
+        p++;
+    }
+    if (p == end || *p < '0' || *p > '9') {
+        return -1;
+    }
+    while (p < end && *p >= '0' && *p <= '9') {
+        npy_uint64 d = *p - '0';
+
+        if (v > (NPY_MAX_UINT64 - d) / 10) {
+            return -1;
+        }
+        v = v * 10 + d;
+        p++;
+    }
+    while (p < end && tr_isspace(*p)) {
+        p++;
+    }
+    if (p != end) {
+        return -1;
+    }
+    *mag = v;
+    return 0;
+}
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+static const double tr_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12,
+    1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ * Clinger's fast path: a decimal with a significand below 2**53 and a
+ * power of ten of at most 22 is exactly one correctly rounded product or
+ * quotient of two doubles.  Returns -1 for anything else.
+ */
+static int
+tr_parse_double_fast(const char *p, const char *end, double *out)
+{
+    npy_uint64 m = 0;
+    int neg = 0, digits = 0, any = 0, e = 0;
+
+    if (p < end && (*p == '-' || *p == '+')) {
+        neg = *p == '-';
+        p++;
+    }
+    for (; p < end && *p >= '0' && *p <= '9'; p++) {
+        any = 1;
+        if (m != 0 || *p != '0') {
+            if (++digits > 19) {
+                return -1;
+            }
+            m = m * 10 + (*p - '0');
+        }
+    }
+    if (p < end && *p == '.') {
+        for (p++; p < end && *p >= '0' && *p <= '9'; p++) {
+            any = 1;
+            if (m != 0 || *p != '0') {
+                if (++digits > 19) {
+                    return -1;
+                }
+                m = m * 10 + (*p - '0');
+            }
+            e--;
+        }
+    }
+    if (!any) {
+        return -1;
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        int eneg = 0, x = 0, xdigits = 0;
+
+        p++;
+        if (p < end && (*p == '-' || *p == '+')) {
+            eneg = *p == '-';
+            p++;
+        }
+        for (; p < end && *p >= '0' && *p <= '9'; p++) {
+            if (++xdigits > 4) {
+                return -1;
+            }
+            x = x * 10 + (*p - '0');
+        }
+        if (xdigits == 0) {
+            return -1;
+        }
+        e += eneg ? -x : x;
+    }
+    while (p < end && tr_isspace(*p)) {
+        p++;
+    }
+    if (p != end) {
+        return -1;
+    }
+    if (m == 0) {
+        *out = neg ? -0.0 : 0.0;
+        return 0;
+    }
+    if (m > ((npy_uint64)1 << 53) || e < -22 || e > 22) {
+        return -1;
+    }
+    *out = e < 0 ? (double)m / tr_pow10[-e] : (double)m * tr_pow10[e];
+    if (neg) {
+        *out = -*out;
+    }
+    return 0;
+}
+#endif
+
+/*
+ * Parses a decimal floating point number between optional whitespace.
+ * nan, inf and hexadecimal values are left to the converter.
+ */
+static int
+tr_parse_double(const char *str, npy_intp len, double *out)
+{
+    const char *p = str, *end = str + len;
+    char *stop;
+
+    while (p < end && tr_isspace(*p)) {
+        p++;
+    }
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+    if (tr_parse_double_fast(p, end, out) == 0) {
+        return 0;
+    }
+#endif
+    if (p < end && (*p == '-' || *p == '+')) {
+        p++;
+    }
+    if (p == end || !((*p >= '0' && *p <= '9') || *p == '.')) {
+        return -1;
+    }
+    *out = NumPyOS_ascii_strtod(str, &stop);
+    if (stop == str) {
+        return -1;
+    }
+    while (stop < end && tr_isspace(*stop)) {
+        stop++;
+    }
+    return stop == end ? 0 : -1;
+}
+
+/* Stores the low itemsize bytes of v */
+static NPY_INLINE void
+tr_store_integer(npy_uint64 v, int itemsize, char *dst)
+{
+    switch (itemsize) {
+        case 1: {
+            npy_uint8 t = (npy_uint8)v;
+            memcpy(dst, &t, 1);
+            break;
+        }
+        case 2: {
+            npy_uint16 t = (npy_uint16)v;
+            memcpy(dst, &t, 2);
+            break;
+        }
+        case 4: {
+            npy_uint32 t = (npy_uint32)v;
+            memcpy(dst, &t, 4);
+            break;
+        }
+        default:
+            memcpy(dst, &v, 8);
+    }
+}
+
+/* Converts the value with the field's converter and stores the result */
+static int
+tr_convert(tr_field *f, const char *str, npy_intp len, char *dst)
+{
+    PyObject *value, *res;
+    int ret;
+
+    value = PyBytes_FromStringAndSize(str, len);
+    if (value == NULL) {
+        return -1;
+    }
+    res = PyObject_CallFunctionObjArgs(f->converter, value, NULL);
+    Py_DECREF(value);
+    if (res == NULL) {
+        return -1;
+    }
+    ret = PyArray_SETITEM(f->tmp, PyArray_DATA(f->tmp), res);
+    Py_DECREF(res);
+    if (ret < 0) {
+        return -1;
+    }
+    memcpy(dst, PyArray_DATA(f->tmp), f->itemsize);
+    return 0;
+}
+
+static int
+tr_parse_field(tr_field *f, const char *str, npy_intp len, char *dst)
+{
+    npy_uint64 mag;
+    int neg;
+    double d;
+
+    switch (f->kind) {
+        case TR_BOOL:
+            if (tr_parse_integer(str, len, &mag, &neg) == 0) {
+                *(npy_bool *)dst = mag != 0;
+                return 0;
+            }
+            break;
+        case TR_INT:
+        case TR_UINT:
+            if (tr_parse_integer(str, len, &mag, &neg) < 0) {
+                break;
+            }
+            /*
+             * The converters of narrower integers go through a double,
+             * int64 and uint64 parse exactly and reject what does not fit.
+             */
+            if (f->itemsize < 8) {
+                if (mag > ((npy_uint64)1 << 53)) {
+                    break;
+                }
+            }
+            else if (f->kind == TR_INT) {
+                if (mag > (npy_uint64)NPY_MAX_INT64 + neg) {
+                    break;
+                }
+            }
+            else if (neg && mag != 0) {
+                break;
+            }
+            tr_store_integer(neg ? (npy_uint64)0 - mag : mag, f->itemsize,
+                             dst);
+            return 0;
+        case TR_HALF:
+            if (tr_parse_double(str, len, &d) == 0) {
+                npy_half h = npy_double_to_half(d);
+                memcpy(dst, &h, sizeof(h));
+                return 0;
+            }
+            break;
+        case TR_FLOAT:
+            if (tr_parse_double(str, len, &d) == 0) {
+                npy_float v = (npy_float)d;
+                memcpy(dst, &v, sizeof(v));
+                return 0;
+            }
+            break;
+        case TR_DOUBLE:
+            if (tr_parse_double(str, len, &d) == 0) {
+                memcpy(dst, &d, sizeof(d));
+                return 0;
+            }
+            break;
+        case TR_BYTES:
+            memcpy(dst, str, len < f->itemsize ? len : f->itemsize);
+            return 0;
+        case TR_UNICODE: {
+            /* latin-1, the rest of the row is zeroed already */
+            npy_intp i, n = f->itemsize / 4;
+
+            for (i = 0; i < n && i < len; i++) {
+                npy_ucs4 c = (unsigned char)str[i];
+                memcpy(dst + 4 * i, &c, 4);
+            }
+            return 0;
+        }
+    }
+    return tr_convert(f, str, len, dst);
+}
+
+/*
+ * Selects the values of the current row and parses them into row.  Returns
+ * 0 if the row was stored, 1 if it was recorded as invalid and -1 on
+ * error.
+ */
+static int
+tr_fill_row(tr_reader *r, char *row)
+{
+    npy_intp i, nsel, nvalues = r->nvalues;
+
+    if (r->usecols != NULL) {
+        for (i = 0; i < r->nusecols; i++) {
+            npy_intp col = r->usecols[i];
+
+            if (col < 0) {
+                col += nvalues;
+            }
+            if (col < 0 || col >= nvalues) {
+                if (r->invalid != NULL) {
+                    goto invalid;
+                }
+                PyErr_SetString(PyExc_IndexError, "list index out of range");
+                return -1;
+            }
+            r->selected[i] = col;
+        }
+        nsel = r->nusecols;
+    }
+    else {
+        if (nvalues != r->ncols) {
+            if (r->invalid != NULL) {
+                goto invalid;
+            }
+            PyErr_Format(PyExc_ValueError,
+                         "Wrong number of columns at line %zd",
+                         (Py_ssize_t)(r->lineno + r->row_line));
+            return -1;
+        }
+        nsel = nvalues;
+    }
+
+    memset(row, 0, r->rowsize);
+    for (i = 0; i < r->nfields && i < nsel; i++) {
+        npy_intp v = r->usecols != NULL ? r->selected[i] : i;
+        tr_field *f = &r->fields[i];
+
+        if (tr_parse_field(f, r->valuebuf + r->value_start[v],
+                           r->value_len[v], row + f->offset) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+
+invalid: {
+        PyObject *item = Py_BuildValue("(nn)",
+                                       (Py_ssize_t)(r->lineno + r->row_line),
+                                       (Py_ssize_t)nvalues);
+        int ret;
+
+        if (item == NULL) {
+            return -1;
+        }
+        ret = PyList_Append(r->invalid, item);
+        Py_DECREF(item);
+        return ret < 0 ? -1 : 1;
+    }
+}
+
+/*
+ * Reads up to max_rows rows, all of them if it is negative, into *data,
+ * which has room for *capacity rows and is grown with PyDataMem_RENEW.
+ * Returns the number of rows read or -1 on error.
+ */
+static npy_intp
+tr_read_rows(tr_reader *r, npy_intp max_rows, char **data,
+             npy_intp *capacity)
+{
+    npy_intp nrows = 0;
+
+    while (max_rows < 0 || nrows < max_rows) {
+        int ret = tr_next_row(r);
+
+        if (ret == TR_NEED_MORE) {
+            if (tr_refill(r) < 0) {
+                return -1;
+            }
+            continue;
+        }
+        if (ret <= 0) {
+            if (ret < 0) {
+                return -1;
+            }
+            break;
+        }
+        if (r->nvalues == 0) {
+            continue;
+        }
+        if (nrows == *capacity) {
+            npy_intp cap = *capacity < 64 ? 128 : *capacity + *capacity / 2;
+            char *new_data = PyDataMem_RENEW(*data, cap * r->rowsize);
+
+            if (new_data == NULL) {
+                PyErr_NoMemory();
+                return -1;
+            }
+            *data = new_data;
+            *capacity = cap;
+        }
+        ret = tr_fill_row(r, *data + nrows * r->rowsize);
+        if (ret < 0) {
+            return -1;
+        }
+        nrows += ret == 0;
+    }
+    return nrows;
+}
+
+/* Reads the (descr, offset, converter, fast) tuples describing the fields */
+static int
+tr_setup_fields(tr_reader *r, PyObject *fields_obj)
+{
+    PyObject *seq;
+    npy_intp i, n;
+
+    seq = PySequence_Fast(fields_obj, "fields must be a sequence");
+    if (seq == NULL) {
+        return -1;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    r->fields = PyMem_Malloc((n > 0 ? n : 1) * sizeof(tr_field));
+    if (r->fields == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    memset(r->fields, 0, (n > 0 ? n : 1) * sizeof(tr_field));
+    r->nfields = n;
+    for (i = 0; i < n; i++) {
+        tr_field *f = &r->fields[i];
+        PyArray_Descr *descr;
+        PyObject *converter;
+        Py_ssize_t offset;
+        int fast;
+
+        if (!PyArg_ParseTuple(PySequence_Fast_GET_ITEM(seq, i),
+                              "O&nOi:_load_from_filelike",
+                              &PyArray_DescrConverter, &descr, &offset,
+                              &converter, &fast)) {
+            Py_DECREF(seq);
+            return -1;
+        }
+        if (PyDataType_REFCHK(descr) || descr->elsize == 0 ||
+                offset < 0 || offset + descr->elsize > r->rowsize ||
+                !PyCallable_Check(converter)) {
+            PyErr_SetString(PyExc_ValueError,
+                            "invalid field for _load_from_filelike");
+            Py_DECREF(descr);
+            Py_DECREF(seq);
+            return -1;
+        }
+        f->offset = offset;
+        f->itemsize = descr->elsize;
+        Py_INCREF(converter);
+        f->converter = converter;
+        f->kind = TR_CONVERT;
+        if (fast && PyArray_ISNBO(descr->byteorder)) {
+            switch (descr->type_num) {
+                case NPY_BOOL:
+                    f->kind = TR_BOOL;
+                    break;
+                case NPY_BYTE:
+                case NPY_SHORT:
+                case NPY_INT:
+                case NPY_LONG:
+                case NPY_LONGLONG:
+                    f->kind = TR_INT;
+                    break;
+                case NPY_UBYTE:
+                case NPY_USHORT:
+                case NPY_UINT:
+                case NPY_ULONG:
+                case NPY_ULONGLONG:
+                    f->kind = TR_UINT;
+                    break;
+                case NPY_HALF:
+                    f->kind = TR_HALF;
+                    break;
+                case NPY_FLOAT:
+                    f->kind = TR_FLOAT;
+                    break;
+                case NPY_DOUBLE:
+                    f->kind = TR_DOUBLE;
+                    break;
+                case NPY_STRING:
+                    f->kind = TR_BYTES;
+                    break;
+                case NPY_UNICODE:
+                    f->kind = TR_UNICODE;
+                    break;
+            }
+        }
+        /* steals the reference to descr */
+        f->tmp = (PyArrayObject *)PyArray_NewFromDescr(&PyArray_Type, descr,
+                                                       0, NULL, NULL, NULL,
+                                                       0, NULL);
+        if (f->tmp == NULL) {
+            Py_DECREF(seq);
+            return -1;
+        }
+    }
+    Py_DECREF(seq);
+    return 0;
+}
+
+static int
+tr_setup_usecols(tr_reader *r, PyObject *usecols_obj)
+{
+    PyObject *seq;
+    npy_intp i, n;
+
+    seq = PySequence_Fast(usecols_obj, "usecols must be a sequence");
+    if (seq == NULL) {
+        return -1;
+    }
+    n = PySequence_Fast_GET_SIZE(seq);
+    r->usecols = PyMem_Malloc((n > 0 ? n : 1) * sizeof(npy_intp));
+    r->selected = PyMem_Malloc((n > 0 ? n : 1) * sizeof(npy_intp));
+    if (r->usecols == NULL || r->selected == NULL) {
+        Py_DECREF(seq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    r->nusecols = n;
+    for (i = 0; i < n; i++) {
+        r->usecols[i] = PyArray_PyIntAsIntp(PySequence_Fast_GET_ITEM(seq, i));
+        if (error_converting(r->usecols[i])) {
+            Py_DECREF(seq);
+            return -1;
+        }
+    }
+    Py_DECREF(seq);
+    return 0;
+}
+
+static int
+tr_setup_dialect(tr_reader *r, PyObject *delimiter, PyObject *comments,
+                 PyObject *quotechar)
+{
+    if (delimiter != Py_None) {
+        if (!PyBytes_Check(delimiter) || PyBytes_GET_SIZE(delimiter) == 0) {
+            PyErr_SetString(PyExc_TypeError,
+                            "delimiter must be None or non-empty bytes");
+            return -1;
+        }
+        /* the caller keeps delimiter alive */
+        r->delimiter = PyBytes_AS_STRING(delimiter);
+        r->delimlen = PyBytes_GET_SIZE(delimiter);
+    }
+    if (comments != Py_None) {
+        Py_ssize_t i;
+
+        r->comments = PySequence_Tuple(comments);
+        if (r->comments == NULL) {
+            return -1;
+        }
+        for (i = 0; i < PyTuple_GET_SIZE(r->comments); i++) {
+            PyObject *c = PyTuple_GET_ITEM(r->comments, i);
+
+            if (!PyBytes_Check(c) || PyBytes_GET_SIZE(c) == 0) {
+                PyErr_SetString(PyExc_TypeError,
+                                "comments must be non-empty bytes");
+                return -1;
+            }
+            r->comment_first[(unsigned char)PyBytes_AS_STRING(c)[0]] = 1;
+        }
+        if (PyTuple_GET_SIZE(r->comments) == 0) {
+            Py_CLEAR(r->comments);
+        }
+    }
+    r->quotechar = -1;
+    if (quotechar != Py_None) {
+        if (!PyBytes_Check(quotechar) || PyBytes_GET_SIZE(quotechar) != 1) {
+            PyErr_SetString(PyExc_TypeError,
+                            "quotechar must be None or a single byte");
+            return -1;
+        }
+        r->quotechar = (unsigned char)PyBytes_AS_STRING(quotechar)[0];
+    }
+    return 0;
+}
+
+/*
+ * Text files are read a chunk at a time with their read method, anything
+ * else is iterated over as lines.  Python 2 files cannot be read from
+ * after they have been iterated over, as loadtxt does for the header.
+ */
+static int
+tr_setup_input(tr_reader *r, PyObject *file, PyObject *first_line)
+{
+    int use_read = PyObject_HasAttrString(file, "read");
+
+#if !defined(NPY_PY3K)
+    use_read = use_read && !PyFile_Check(file);
+#endif
+    if (use_read) {
+        r->read = PyObject_GetAttrString(file, "read");
+        if (r->read == NULL) {
+            return -1;
+        }
+    }
+    else {
+        r->iter = PyObject_GetIter(file);
+        if (r->iter == NULL) {
+            return -1;
+        }
+    }
+    if (first_line != Py_None) {
+        return tr_append(r, first_line, 1);
+    }
+    return 0;
+}
+
+/*
+ * Sets up the reader for the arguments shared by _load_from_filelike and
+ * _TextReader.  delimiter and invalid are borrowed and have to be kept
+ * alive by the caller.
+ */
+static int
+tr_reader_init(tr_reader *r, PyArray_Descr *dtype, PyObject *file,
+               PyObject *fields, PyObject *first_line, PyObject *delimiter,
+               PyObject *comments, PyObject *quotechar, PyObject *usecols,
+               npy_intp ncols, npy_intp lineno, int strip_spaces,
+               int strip_fields, PyObject *invalid)
+{
+    if (dtype->elsize == 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "the text reader needs a sized dtype");
+        return -1;
+    }
+    r->rowsize = dtype->elsize;
+    r->ncols = ncols;
+    r->lineno = lineno;
+    r->strip_spaces = strip_spaces;
+    r->strip_fields = strip_fields;
+    if (invalid != Py_None) {
+        if (!PyList_Check(invalid)) {
+            PyErr_SetString(PyExc_TypeError, "invalid must be a list");
+            return -1;
+        }
+        r->invalid = invalid;
+    }
+    if (tr_setup_dialect(r, delimiter, comments, quotechar) < 0 ||
+            tr_setup_fields(r, fields) < 0) {
+        return -1;
+    }
+    if (usecols != Py_None && tr_setup_usecols(r, usecols) < 0) {
+        return -1;
+    }
+    return tr_setup_input(r, file, first_line);
+}
+
+/*
+ * Wraps nrows rows of data, allocated with PyDataMem_NEW for capacity
+ * rows, in a new array owning it.  Steals the references to dtype and
+ * data, also on failure.
+ */
+static PyObject *
+tr_wrap_rows(PyArray_Descr *dtype, char *data, npy_intp nrows,
+             npy_intp capacity)
+{
+    PyArrayObject *ret;
+
+    /* trim, the array frees its data knowing only its size */
+    if (nrows != capacity || data == NULL) {
+        char *new_data = PyDataMem_RENEW(data, nrows > 0 ?
+                                               nrows * dtype->elsize : 1);
+        if (new_data == NULL) {
+            PyDataMem_FREE(data);
+            Py_DECREF(dtype);
+            return PyErr_NoMemory();
+        }
+        data = new_data;
+    }
+    ret = (PyArrayObject *)PyArray_NewFromDescr(&PyArray_Type, dtype, 1,
+                                                &nrows, NULL, data,
+                                                NPY_ARRAY_CARRAY, NULL);
+    if (ret == NULL) {
+        PyDataMem_FREE(data);
+        return NULL;
+    }
+    PyArray_ENABLEFLAGS(ret, NPY_ARRAY_OWNDATA);
+    return (PyObject *)ret;
+}
+
+NPY_NO_EXPORT PyObject *
+arr_load_from_filelike(PyObject *NPY_UNUSED(self), PyObject *args,
+                       PyObject *kwds)
+{
+    PyObject *file, *fields, *first_line = Py_None;
+    PyObject *delimiter = Py_None, *comments = Py_None;
+    PyObject *quotechar = Py_None, *usecols = Py_None, *invalid = Py_None;
+    PyArray_Descr *dtype = NULL;
+    Py_ssize_t ncols = -1, lineno = 1, max_rows = -1;
+    int strip_spaces = 0, strip_fields = 0;
+    npy_intp nrows, capacity = 0;
+    char *data = NULL;
+    tr_reader r;
+    static char *kwlist[] = {"file", "dtype", "fields", "first_line",
+                             "delimiter", "comments", "quotechar", "usecols",
+                             "ncols", "lineno", "strip_spaces",
+                             "strip_fields", "invalid", "max_rows", NULL};
+
+    memset(&r, 0, sizeof(r));
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                "OO&O|OOOOOnniiOn:_load_from_filelike", kwlist,
+                &file, &PyArray_DescrConverter, &dtype, &fields,
+                &first_line, &delimiter, &comments, &quotechar, &usecols,
+                &ncols, &lineno, &strip_spaces, &strip_fields, &invalid,
+                &max_rows)) {
+        Py_XDECREF(dtype);
+        return NULL;
+    }
+    if (tr_reader_init(&r, dtype, file, fields, first_line, delimiter,
+                       comments, quotechar, usecols, ncols, lineno,
+                       strip_spaces, strip_fields, invalid) < 0) {
+        goto fail;
+    }
+
+    nrows = tr_read_rows(&r, max_rows, &data, &capacity);
+    if (nrows < 0) {
+        goto fail;
+    }
+    tr_reader_clear(&r);
+    return tr_wrap_rows(dtype, data, nrows, capacity);
+
+fail:
+    PyDataMem_FREE(data);
+    Py_DECREF(dtype);
+    tr_reader_clear(&r);
+    return NULL;
+}
+
+
+/*
+ * _TextReader reads the input a given number of rows at a time, keeping
+ * the buffered input and line count between the calls.  This is how
+ * np.iter_loadtxt reads files of any size in bounded memory.
+ */
+typedef struct {
+    PyObject_HEAD
+    tr_reader r;
+    PyArray_Descr *dtype;
+    /* referenced by r */
+    PyObject *delimiter;
+    PyObject *invalid;
+} NpyTextReader;
+
+static void
+textreader_dealloc(NpyTextReader *self)
+{
+    tr_reader_clear(&self->r);
+    Py_XDECREF(self->dtype);
+    Py_XDECREF(self->delimiter);
+    Py_XDECREF(self->invalid);
+    Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *
+textreader_new(PyTypeObject *subtype, PyObject *args, PyObject *kwds)
+{
+    PyObject *file, *fields, *first_line = Py_None;
+    PyObject *delimiter = Py_None, *comments = Py_None;
+    PyObject *quotechar = Py_None, *usecols = Py_None, *invalid = Py_None;
+    PyArray_Descr *dtype = NULL;
+    Py_ssize_t ncols = -1, lineno = 1;
+    int strip_spaces = 0, strip_fields = 0;
+    NpyTextReader *self;
+    static char *kwlist[] = {"file", "dtype", "fields", "first_line",
+                             "delimiter", "comments", "quotechar", "usecols",
+                             "ncols", "lineno", "strip_spaces",
+                             "strip_fields", "invalid", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds,
+                "OO&O|OOOOOnniiO:_TextReader", kwlist,
+                &file, &PyArray_DescrConverter, &dtype, &fields,
+                &first_line, &delimiter, &comments, &quotechar, &usecols,
+                &ncols, &lineno, &strip_spaces, &strip_fields, &invalid)) {
+        Py_XDECREF(dtype);
+        return NULL;
+    }
+    self = (NpyTextReader *)subtype->tp_alloc(subtype, 0);
+    if (self == NULL) {
+        Py_DECREF(dtype);
+        return NULL;
+    }
+    self->dtype = dtype;
+    Py_INCREF(delimiter);
+    self->delimiter = delimiter;
+    Py_INCREF(invalid);
+    self->invalid = invalid;
+    if (tr_reader_init(&self->r, dtype, file, fields, first_line, delimiter,
+                       comments, quotechar, usecols, ncols, lineno,
+                       strip_spaces, strip_fields, invalid) < 0) {
+        Py_DECREF(self);
+        return NULL;
+    }
+    return (PyObject *)self;
+}
+
+/*
+ * read(nrows, out=None) returns the next rows of the input, nrows of them
+ * unless the input ends first.  They are stored in the leading rows of out
+ * if given, and a view of these is returned, otherwise in a new array.
+ */
+static PyObject *
+textreader_read(NpyTextReader *self, PyObject *args, PyObject *kwds)
+{
+    PyArray_Descr *dtype = self->dtype;
+    PyArrayObject *out = NULL;
+    Py_ssize_t max_rows;
+    npy_intp nrows, capacity;
+    char *data;
+    static char *kwlist[] = {"nrows", "out", NULL};
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "n|O&:read", kwlist,
+                                     &max_rows, &PyArray_OutputConverter,
+                                     &out)) {
+        return NULL;
+    }
+    if (max_rows < 0) {
+        PyErr_SetString(PyExc_ValueError, "nrows must not be negative");
+        return NULL;
+    }
+    if (out != NULL) {
+        PyArray_Descr *base = dtype->subarray != NULL ?
+                              dtype->subarray->base : dtype;
+
+        if (!PyArray_ISCARRAY(out) || PyArray_NDIM(out) == 0 ||
+                !PyArray_EquivTypes(PyArray_DESCR(out), base) ||
+                PyArray_NBYTES(out) !=
+                        PyArray_DIM(out, 0) * dtype->elsize) {
+            PyErr_SetString(PyExc_ValueError,
+                            "out must be a writeable C-contiguous array "
+                            "of rows of the dtype read");
+            return NULL;
+        }
+        if (PyArray_DIM(out, 0) < max_rows) {
+            PyErr_SetString(PyExc_ValueError,
+                            "out has fewer than nrows rows");
+            return NULL;
+        }
+        data = PyArray_BYTES(out);
+        capacity = max_rows;
+        nrows = tr_read_rows(&self->r, max_rows, &data, &capacity);
+        if (nrows < 0) {
+            return NULL;
+        }
+        return PySequence_GetSlice((PyObject *)out, 0, nrows);
+    }
+
+    data = PyDataMem_NEW(max_rows > 0 ? max_rows * dtype->elsize : 1);
+    if (data == NULL) {
+        return PyErr_NoMemory();
+    }
+    capacity = max_rows;
+    nrows = tr_read_rows(&self->r, max_rows, &data, &capacity);
+    if (nrows < 0) {
+        PyDataMem_FREE(data);
+        return NULL;
+    }
+    Py_INCREF(dtype);
+    return tr_wrap_rows(dtype, data, nrows, capacity);
+}
+
+static PyMethodDef textreader_methods[] = {
+    {"read",
+        (PyCFunction)textreader_read,
+        METH_VARARGS | METH_KEYWORDS, NULL},
+    {NULL, NULL, 0, NULL}
+};
+
+NPY_NO_EXPORT PyTypeObject NpyTextReader_Type = {
+#if defined(NPY_PY3K)
+    PyVarObject_HEAD_INIT(NULL, 0)
+#else
+    PyObject_HEAD_INIT(NULL)
+    0,                                          /* ob_size */
+#endif
+    "numpy.core.multiarray._TextReader",        /* tp_name */
+    sizeof(NpyTextReader),                      /* tp_basicsize */
+    0,                                          /* tp_itemsize */
+    /* methods */
+    (destructor)textreader_dealloc,             /* tp_dealloc */
+    0,                                          /* tp_print */
+    0,                                          /* tp_getattr */
+    0,                                          /* tp_setattr */
+#if defined(NPY_PY3K)
+    0,                                          /* tp_reserved */
+#else
+    0,                                          /* tp_compare */
+#endif
+    0,                                          /* tp_repr */
+    0,                                          /* tp_as_number */
+    0,                                          /* tp_as_sequence */
+    0,                                          /* tp_as_mapping */
+    0,                                          /* tp_hash */
+    0,                                          /* tp_call */
+    0,                                          /* tp_str */
+    0,                                          /* tp_getattro */
+    0,                                          /* tp_setattro */
+    0,                                          /* tp_as_buffer */
+    Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+    0,                                          /* tp_doc */
+    0,                                          /* tp_traverse */
+    0,                                          /* tp_clear */
+    0,                                          /* tp_richcompare */
+    0,                                          /* tp_weaklistoffset */
+    0,                                          /* tp_iter */
+    0,                                          /* tp_iternext */
+    textreader_methods,                         /* tp_methods */
+    0,                                          /* tp_members */
+    0,                                          /* tp_getset */
+    0,                                          /* tp_base */
+    0,                                          /* tp_dict */
+    0,                                          /* tp_descr_get */
+    0,                                          /* tp_descr_set */
+    0,                                          /* tp_dictoffset */
+    0,                                          /* tp_init */
+    0,                                          /* tp_alloc */
+    textreader_new,                             /* tp_new */
+    0,                                          /* tp_free */
+    0,                                          /* tp_is_gc */
+    0,                                          /* tp_bases */
+    0,                                          /* tp_mro */
+    0,                                          /* tp_cache */
+    0,                                          /* tp_subclasses */
+    0,                                          /* tp_weaklist */
+    0,                                          /* tp_del */
+    0,                                          /* tp_version_tag */
+};
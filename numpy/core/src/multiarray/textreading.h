@@ -0,0 +1,9 @@
+#ifndef _NPY_TEXTREADING_H_
+#define _NPY_TEXTREADING_H_
+
+extern NPY_NO_EXPORT PyTypeObject NpyTextReader_Type;
+
+NPY_NO_EXPORT PyObject *
+arr_load_from_filelike(PyObject *, PyObject *, PyObject *);
+
+#endif
@@ -327,6 +327,33 @@ PyArray_TransferMaskedStridedToNDim(npy_intp ndim,
                 PyArray_MaskedStridedUnaryOp *stransfer,
                 NpyAuxData *data);
 
+/* Side of the square tiles of PyArray_TransferTiled2D, in elements */
+#define NPY_TRANSFER_TILE 32
+
+/*
+ * Lines of the source shorter than this many bytes stay in the cache
+ * without tiling.
+ */
+#define NPY_TRANSFER_TILE_MIN_BYTES 65536
+
+/*
+ * Transfers the 2-D block of shape0 x shape1 elements in square tiles,
+ * calling 'stransfer' along dimension 0 for each line of a tile.
+ *
+ * This is for a source which is strided along dimension 0 but close to
+ * contiguous along dimension 1, as when copying a transposed array. Going
+ * through the lines of the whole block would load a new cache line for
+ * every element and evict it before the next line reads its neighbour,
+ * while all the lines of a tile fit in the cache together.
+ */
+NPY_NO_EXPORT void
+PyArray_TransferTiled2D(npy_intp shape0, npy_intp shape1,
+                char *dst, npy_intp dst_stride0, npy_intp dst_stride1,
+                char *src, npy_intp src_stride0, npy_intp src_stride1,
+                npy_intp src_itemsize,
+                PyArray_StridedUnaryOp *stransfer,
+                NpyAuxData *data);
+
 NPY_NO_EXPORT int
 mapiter_trivial_get(PyArrayObject *self, PyArrayObject *ind,
                        PyArrayObject *result);
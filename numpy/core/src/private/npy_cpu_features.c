@@ -0,0 +1,105 @@
+/*
+ * Runtime detection of the simd instruction sets used by the dispatched
+ * kernels in umath/simd.inc.src and multiarray/compiled_base.c.
+ *
+ * The SSE2 kernels are built in whenever the compiler baseline supports them
+ * (amd64, x32 or CFLAGS=-march=...). The AVX2 and AVX512F kernels are built
+ * with gcc target attributes so the binary stays portable and are only
+ * selected when the running cpu supports them.
+ *
+ * The detected level can be capped with the NPY_SIMD_MAX_ISA environment
+ * variable to make benchmarks reproducible across machines, e.g.
+ *
+ *     NPY_SIMD_MAX_ISA=sse2 python bench.py
+ */
+#include <Python.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define NPY_NO_DEPRECATED_API NPY_API_VERSION
+#include "npy_cpu_features.h"
+
+#ifdef NPY_HAVE_SSE2_INTRINSICS
+NPY_VISIBILITY_HIDDEN int npy_simd_isa = NPY_SIMD_ISA_SSE2;
+#else
+NPY_VISIBILITY_HIDDEN int npy_simd_isa = NPY_SIMD_ISA_NONE;
+#endif
+
+static const char *isa_names[] = {"none", "sse2", "avx2", "avx512f"};
+
+
+NPY_VISIBILITY_HIDDEN const char *
+npy_simd_isa_name(int isa)
+{
+    if (isa < NPY_SIMD_ISA_NONE || isa > NPY_SIMD_ISA_AVX512F) {
+        return "unknown";
+    }
+    return isa_names[isa];
+}
+
+
+static int
+detect_simd_isa(void)
+{
+    int isa = NPY_SIMD_ISA_NONE;
+
+#ifdef NPY_HAVE_SSE2_INTRINSICS
+    /* compile time baseline */
+    isa = NPY_SIMD_ISA_SSE2;
+#endif
+#ifdef HAVE___BUILTIN_CPU_SUPPORTS
+    __builtin_cpu_init();
+#ifdef NPY_HAVE_AVX2_INTRINSICS
+    if (isa == NPY_SIMD_ISA_SSE2 && __builtin_cpu_supports("avx2")) {
+        isa = NPY_SIMD_ISA_AVX2;
+    }
+#endif
+#ifdef NPY_HAVE_AVX512F_INTRINSICS
+    if (isa == NPY_SIMD_ISA_AVX2 && __builtin_cpu_supports("avx512f")) {
+        isa = NPY_SIMD_ISA_AVX512F;
+    }
+#endif
+#endif
+    return isa;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_cpu_init(void)
+{
+    char buf[16];
+    const char *env;
+    int isa, i;
+
+    isa = detect_simd_isa();
+
+    env = getenv("NPY_SIMD_MAX_ISA");
+    if (env != NULL && env[0] != '\0') {
+        int cap = -1;
+
+        for (i = 0; env[i] != '\0' && i < (int)sizeof(buf) - 1; i++) {
+            buf[i] = (env[i] >= 'A' && env[i] <= 'Z') ?
+                     env[i] - 'A' + 'a' : env[i];
+        }
+        buf[i] = '\0';
+        for (i = NPY_SIMD_ISA_NONE; i <= NPY_SIMD_ISA_AVX512F; i++) {
+            if (strcmp(buf, isa_names[i]) == 0) {
+                cap = i;
+                break;
+            }
+        }
+        if (cap < 0) {
+            if (PyErr_WarnEx(PyExc_RuntimeWarning,
+                    "ignoring invalid NPY_SIMD_MAX_ISA value, expected "
+                    "one of 'none', 'sse2', 'avx2' or 'avx512f'", 1) < 0) {
+                return -1;
+            }
+        }
+        else if (cap < isa) {
+            isa = cap;
+        }
+    }
+
+    npy_simd_isa = isa;
+    return 0;
+}
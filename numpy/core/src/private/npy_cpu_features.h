@@ -0,0 +1,36 @@
+#ifndef NPY_CPU_FEATURES_H_
+#define NPY_CPU_FEATURES_H_
+
+#include "npy_config.h"
+#include "numpy/npy_common.h"
+
+/*
+ * Instruction set levels of the runtime dispatched simd kernels, ordered so
+ * that a higher level implies all lower ones.
+ */
+typedef enum {
+    NPY_SIMD_ISA_NONE = 0,
+    NPY_SIMD_ISA_SSE2 = 1,
+    NPY_SIMD_ISA_AVX2 = 2,
+    NPY_SIMD_ISA_AVX512F = 3
+} npy_simd_isa_t;
+
+/*
+ * Best instruction set level usable in this process, set by npy_cpu_init.
+ * Before initialization it is the compile time baseline.
+ */
+NPY_VISIBILITY_HIDDEN extern int npy_simd_isa;
+
+/*
+ * Detect the cpu features and cap the result with the NPY_SIMD_MAX_ISA
+ * environment variable (one of "none", "sse2", "avx2", "avx512f").
+ * Returns 0 on success and -1 with a Python exception set on failure.
+ */
+NPY_VISIBILITY_HIDDEN int
+npy_cpu_init(void);
+
+/* lower case name of an instruction set level */
+NPY_VISIBILITY_HIDDEN const char *
+npy_simd_isa_name(int isa);
+
+#endif
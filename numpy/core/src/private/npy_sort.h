@@ -24,6 +24,8 @@ int mergesort_bool(void *vec, npy_intp cnt, void *null);
 int aquicksort_bool(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_bool(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_bool(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_bool(void *vec, npy_intp cnt, void *null);
+int aradixsort_bool(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_byte(void *vec, npy_intp cnt, void *null);
@@ -32,6 +34,8 @@ int mergesort_byte(void *vec, npy_intp cnt, void *null);
 int aquicksort_byte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_byte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_byte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_byte(void *vec, npy_intp cnt, void *null);
+int aradixsort_byte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_ubyte(void *vec, npy_intp cnt, void *null);
@@ -40,6 +44,8 @@ int mergesort_ubyte(void *vec, npy_intp cnt, void *null);
 int aquicksort_ubyte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_ubyte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_ubyte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_ubyte(void *vec, npy_intp cnt, void *null);
+int aradixsort_ubyte(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_short(void *vec, npy_intp cnt, void *null);
@@ -48,6 +54,8 @@ int mergesort_short(void *vec, npy_intp cnt, void *null);
 int aquicksort_short(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_short(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_short(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_short(void *vec, npy_intp cnt, void *null);
+int aradixsort_short(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_ushort(void *vec, npy_intp cnt, void *null);
@@ -56,6 +64,8 @@ int mergesort_ushort(void *vec, npy_intp cnt, void *null);
 int aquicksort_ushort(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_ushort(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_ushort(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_ushort(void *vec, npy_intp cnt, void *null);
+int aradixsort_ushort(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_int(void *vec, npy_intp cnt, void *null);
@@ -64,6 +74,8 @@ int mergesort_int(void *vec, npy_intp cnt, void *null);
 int aquicksort_int(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_int(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_int(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_int(void *vec, npy_intp cnt, void *null);
+int aradixsort_int(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_uint(void *vec, npy_intp cnt, void *null);
@@ -72,6 +84,8 @@ int mergesort_uint(void *vec, npy_intp cnt, void *null);
 int aquicksort_uint(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_uint(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_uint(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_uint(void *vec, npy_intp cnt, void *null);
+int aradixsort_uint(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_long(void *vec, npy_intp cnt, void *null);
@@ -80,6 +94,8 @@ int mergesort_long(void *vec, npy_intp cnt, void *null);
 int aquicksort_long(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_long(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_long(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_long(void *vec, npy_intp cnt, void *null);
+int aradixsort_long(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_ulong(void *vec, npy_intp cnt, void *null);
@@ -88,6 +104,8 @@ int mergesort_ulong(void *vec, npy_intp cnt, void *null);
 int aquicksort_ulong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_ulong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_ulong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_ulong(void *vec, npy_intp cnt, void *null);
+int aradixsort_ulong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_longlong(void *vec, npy_intp cnt, void *null);
@@ -96,6 +114,8 @@ int mergesort_longlong(void *vec, npy_intp cnt, void *null);
 int aquicksort_longlong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_longlong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_longlong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_longlong(void *vec, npy_intp cnt, void *null);
+int aradixsort_longlong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_ulonglong(void *vec, npy_intp cnt, void *null);
@@ -104,6 +124,8 @@ int mergesort_ulonglong(void *vec, npy_intp cnt, void *null);
 int aquicksort_ulonglong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_ulonglong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_ulonglong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_ulonglong(void *vec, npy_intp cnt, void *null);
+int aradixsort_ulonglong(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_half(void *vec, npy_intp cnt, void *null);
@@ -120,6 +142,8 @@ int mergesort_float(void *vec, npy_intp cnt, void *null);
 int aquicksort_float(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_float(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_float(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_float(void *vec, npy_intp cnt, void *null);
+int aradixsort_float(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_double(void *vec, npy_intp cnt, void *null);
@@ -128,6 +152,8 @@ int mergesort_double(void *vec, npy_intp cnt, void *null);
 int aquicksort_double(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_double(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_double(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_double(void *vec, npy_intp cnt, void *null);
+int aradixsort_double(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_longdouble(void *vec, npy_intp cnt, void *null);
@@ -184,6 +210,8 @@ int mergesort_datetime(void *vec, npy_intp cnt, void *null);
 int aquicksort_datetime(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_datetime(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_datetime(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_datetime(void *vec, npy_intp cnt, void *null);
+int aradixsort_datetime(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int quicksort_timedelta(void *vec, npy_intp cnt, void *null);
@@ -192,6 +220,8 @@ int mergesort_timedelta(void *vec, npy_intp cnt, void *null);
 int aquicksort_timedelta(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int aheapsort_timedelta(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 int amergesort_timedelta(void *vec, npy_intp *ind, npy_intp cnt, void *null);
+int radixsort_timedelta(void *vec, npy_intp cnt, void *null);
+int aradixsort_timedelta(void *vec, npy_intp *ind, npy_intp cnt, void *null);
 
 
 int npy_quicksort(void *vec, npy_intp cnt, void *arr);
@@ -0,0 +1,301 @@
+/*
+ * Fork-join thread pool for splitting large loops which don't need the
+ * Python API, see npy_threadpool.h.
+ *
+ * The workers are started through the portable Python thread API and only
+ * ever synchronize on Python locks, which are binary semaphores that may be
+ * released by a different thread than the one acquiring them. Each worker
+ * owns a `start` lock, released by the caller to hand it the current job,
+ * and a `done` lock, released by the worker when it has finished. Workers
+ * never touch Python objects or take the GIL, so they can run while the
+ * interpreter is busy and simply block on their start lock at exit.
+ */
+#include <Python.h>
+#include <stdlib.h>
+
+#define NPY_NO_DEPRECATED_API NPY_API_VERSION
+#include "numpy/npy_math.h"
+#include "npy_threadpool.h"
+
+#if NPY_ALLOW_THREADS
+
+#include "pythread.h"
+#ifndef _WIN32
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+typedef struct {
+    PyThread_type_lock start;
+    PyThread_type_lock done;
+    int index;
+    int fpstatus;
+} npy_worker;
+
+static struct {
+    npy_parallel_func *func;
+    void *arg;
+    int nthreads;
+} current_job;
+
+/* workers[1] to workers[nworkers], the calling thread acts as index 0 */
+static npy_worker *workers[NPY_MAX_THREADS];
+static int nworkers = 0;
+static int num_threads = 1;
+/* held while a job is running, so concurrent callers fall back to serial */
+static PyThread_type_lock pool_lock = NULL;
+#ifndef _WIN32
+static pid_t pool_pid = 0;
+#endif
+
+
+static void
+worker_main(void *p)
+{
+    npy_worker *w = (npy_worker *)p;
+
+    for (;;) {
+        PyThread_acquire_lock(w->start, WAIT_LOCK);
+        npy_clear_floatstatus();
+        current_job.func(current_job.arg, w->index, current_job.nthreads);
+        w->fpstatus = npy_get_floatstatus();
+        PyThread_release_lock(w->done);
+    }
+}
+
+
+/*
+ * Threads do not survive a fork, and the locks may have been copied in a
+ * held state, so a child process forgets about the parent's pool (leaking
+ * it) and starts a new one.
+ */
+static void
+check_fork(void)
+{
+#ifndef _WIN32
+    if (pool_pid != getpid()) {
+        pool_pid = getpid();
+        pool_lock = NULL;
+        nworkers = 0;
+    }
+#endif
+}
+
+
+/* Make sure at least `count` workers are running, requires the GIL */
+static int
+start_workers(int count)
+{
+    check_fork();
+
+    if (pool_lock == NULL) {
+        pool_lock = PyThread_allocate_lock();
+        if (pool_lock == NULL) {
+            PyErr_SetString(PyExc_RuntimeError,
+                            "could not allocate thread pool lock");
+            return -1;
+        }
+    }
+
+    while (nworkers < count) {
+        npy_worker *w = malloc(sizeof(npy_worker));
+
+        if (w == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        w->start = PyThread_allocate_lock();
+        w->done = PyThread_allocate_lock();
+        w->index = nworkers + 1;
+        w->fpstatus = 0;
+        if (w->start == NULL || w->done == NULL) {
+            goto fail;
+        }
+        /* both locks start out held by the pool */
+        PyThread_acquire_lock(w->start, WAIT_LOCK);
+        PyThread_acquire_lock(w->done, WAIT_LOCK);
+        if ((long)PyThread_start_new_thread(worker_main, w) == -1) {
+            goto fail;
+        }
+        workers[++nworkers] = w;
+        continue;
+
+fail:
+        if (w->start != NULL) {
+            PyThread_free_lock(w->start);
+        }
+        if (w->done != NULL) {
+            PyThread_free_lock(w->done);
+        }
+        free(w);
+        PyErr_SetString(PyExc_RuntimeError,
+                        "could not start thread pool worker");
+        return -1;
+    }
+    return 0;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_set_num_threads(int nthreads)
+{
+    if (nthreads < 1 || nthreads > NPY_MAX_THREADS) {
+        PyErr_Format(PyExc_ValueError,
+                     "number of threads must be between 1 and %d, got %d",
+                     NPY_MAX_THREADS, nthreads);
+        return -1;
+    }
+    if (start_workers(nthreads - 1) < 0) {
+        return -1;
+    }
+    num_threads = nthreads;
+    return 0;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_get_num_threads(void)
+{
+    return num_threads;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_parallel_threads(npy_intp size)
+{
+    npy_intp n;
+
+    if (num_threads <= 1) {
+        return 1;
+    }
+    n = size / NPY_PARALLEL_MIN_CHUNK;
+    if (n < 2) {
+        return 1;
+    }
+    if (n > num_threads) {
+        n = num_threads;
+    }
+    /* restart the workers after a fork, falling back to fewer on failure */
+    if (start_workers(num_threads - 1) < 0) {
+        PyErr_Clear();
+        if (n > nworkers + 1) {
+            n = nworkers + 1;
+        }
+    }
+    return (int)n;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_parallel_threads_nogil(npy_intp size)
+{
+    npy_intp n;
+
+    if (num_threads <= 1) {
+        return 1;
+    }
+    n = size / NPY_PARALLEL_MIN_CHUNK;
+    if (n < 2) {
+        return 1;
+    }
+#ifndef _WIN32
+    if (pool_pid != getpid()) {
+        return 1;
+    }
+#endif
+    if (n > nworkers + 1) {
+        n = nworkers + 1;
+    }
+    return (int)n;
+}
+
+
+NPY_VISIBILITY_HIDDEN void
+npy_parallel_run(int nthreads, npy_parallel_func *func, void *arg)
+{
+    int i, fpstatus = 0;
+
+    if (nthreads > nworkers + 1) {
+        nthreads = nworkers + 1;
+    }
+    if (nthreads <= 1 || pool_lock == NULL ||
+            !PyThread_acquire_lock(pool_lock, NOWAIT_LOCK)) {
+        for (i = 0; i < nthreads; i++) {
+            func(arg, i, nthreads);
+        }
+        return;
+    }
+
+    current_job.func = func;
+    current_job.arg = arg;
+    current_job.nthreads = nthreads;
+    for (i = 1; i < nthreads; i++) {
+        PyThread_release_lock(workers[i]->start);
+    }
+    func(arg, 0, nthreads);
+    for (i = 1; i < nthreads; i++) {
+        PyThread_acquire_lock(workers[i]->done, WAIT_LOCK);
+        fpstatus |= workers[i]->fpstatus;
+    }
+    PyThread_release_lock(pool_lock);
+
+    if (fpstatus & NPY_FPE_DIVIDEBYZERO) {
+        npy_set_floatstatus_divbyzero();
+    }
+    if (fpstatus & NPY_FPE_OVERFLOW) {
+        npy_set_floatstatus_overflow();
+    }
+    if (fpstatus & NPY_FPE_UNDERFLOW) {
+        npy_set_floatstatus_underflow();
+    }
+    if (fpstatus & NPY_FPE_INVALID) {
+        npy_set_floatstatus_invalid();
+    }
+}
+
+#else  /* NPY_ALLOW_THREADS */
+
+NPY_VISIBILITY_HIDDEN int
+npy_set_num_threads(int nthreads)
+{
+    if (nthreads != 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "numpy was built without thread support");
+        return -1;
+    }
+    return 0;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_get_num_threads(void)
+{
+    return 1;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_parallel_threads(npy_intp NPY_UNUSED(size))
+{
+    return 1;
+}
+
+
+NPY_VISIBILITY_HIDDEN int
+npy_parallel_threads_nogil(npy_intp NPY_UNUSED(size))
+{
+    return 1;
+}
+
+
+NPY_VISIBILITY_HIDDEN void
+npy_parallel_run(int nthreads, npy_parallel_func *func, void *arg)
+{
+    int i;
+
+    for (i = 0; i < nthreads; i++) {
+        func(arg, i, nthreads);
+    }
+}
+
+#endif  /* NPY_ALLOW_THREADS */
@@ -0,0 +1,91 @@
+#ifndef NPY_THREADPOOL_H_
+#define NPY_THREADPOOL_H_
+
+#include "npy_config.h"
+#include "numpy/ndarraytypes.h"
+
+/*
+ * A minimal fork-join pool of worker threads for splitting the inner loops
+ * of large operations that do not need the Python API.
+ *
+ * Every extension module compiling this file gets its own pool and thread
+ * count; numpy.setthreads forwards the setting to all of them. The pool is
+ * opt-in: the default of one thread never starts a worker.
+ */
+
+/* upper limit accepted by npy_set_num_threads */
+#define NPY_MAX_THREADS 256
+
+/*
+ * Problems with fewer elements per thread than this are not worth waking
+ * up a worker for.
+ */
+#define NPY_PARALLEL_MIN_CHUNK 32768
+
+/*
+ * A job run by npy_parallel_run. It is called once for every
+ * ithread in [0, nthreads) and must not use the Python API.
+ */
+typedef void (npy_parallel_func)(void *arg, int ithread, int nthreads);
+
+/*
+ * Set the number of threads (including the calling one) used by
+ * parallelized loops, starting workers as needed. Requires the GIL.
+ * Returns 0 on success and -1 with a Python exception set on failure.
+ */
+NPY_VISIBILITY_HIDDEN int
+npy_set_num_threads(int nthreads);
+
+NPY_VISIBILITY_HIDDEN int
+npy_get_num_threads(void);
+
+/*
+ * Number of threads to use for a problem of `size` elements, 1 if it is
+ * too small to be split or the pool is disabled. Requires the GIL, as it
+ * restarts the workers in a child process after a fork.
+ */
+NPY_VISIBILITY_HIDDEN int
+npy_parallel_threads(npy_intp size);
+
+/*
+ * Like npy_parallel_threads, but may be called without the GIL, e.g. from
+ * an inner loop. It only uses workers that are already running, so it
+ * returns 1 in a forked child until the pool is restarted.
+ */
+NPY_VISIBILITY_HIDDEN int
+npy_parallel_threads_nogil(npy_intp size);
+
+/*
+ * Run func(arg, i, nthreads) for all i, with i == 0 on the calling thread,
+ * and wait for all of them to finish. Does not require the GIL and should
+ * be called with it released. Floating point status flags raised by the
+ * workers are merged into the calling thread.
+ *
+ * If the pool is busy with another call, everything runs on the calling
+ * thread, so func must not rely on running concurrently.
+ */
+NPY_VISIBILITY_HIDDEN void
+npy_parallel_run(int nthreads, npy_parallel_func *func, void *arg);
+
+/*
+ * The part [*start, *end) of the range [0, n) handled by thread ithread of
+ * nthreads. The chunk boundaries are multiples of `block` elements, except
+ * for the end of the last one.
+ */
+static NPY_INLINE void
+npy_parallel_range(npy_intp n, npy_intp block, int ithread, int nthreads,
+                   npy_intp *start, npy_intp *end)
+{
+    npy_intp nblocks = (n + block - 1) / block;
+
+    *start = (nblocks * ithread / nthreads) * block;
+    *end = (nblocks * (ithread + 1) / nthreads) * block;
+    if (*start > n) {
+        *start = n;
+    }
+    if (*end > n) {
+        *end = n;
+    }
+}
+
+#endif
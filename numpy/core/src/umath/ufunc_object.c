@@ -42,6 +42,7 @@
 #include "ufunc_type_resolution.h"
 #include "reduction.h"
 #include "mem_overlap.h"
+#include "npy_threadpool.h"
 
 #include "ufunc_object.h"
 #include "override.h"
@@ -1280,33 +1281,117 @@ check_for_trivial_loop(PyUFuncObject *ufunc,
     return 1;
 }
 
+/*
+ * The trivial loops are split into chunks of a multiple of this many
+ * elements when running on several threads, which keeps the alignment of
+ * the chunks the same as that of the whole operands for the simd loops.
+ */
+#define TRIVIAL_LOOP_BLOCK 1024
+
+typedef struct {
+    PyUFuncGenericFunction innerloop;
+    void *innerloopdata;
+    int nop;
+    char *data[3];
+    npy_intp count;
+    npy_intp stride[3];
+} trivial_loop_job;
+
+static void
+trivial_loop_chunk(void *arg, int ithread, int nthreads)
+{
+    trivial_loop_job *job = (trivial_loop_job *)arg;
+    char *data[3];
+    npy_intp count[3], start, end;
+    int i;
+
+    npy_parallel_range(job->count, TRIVIAL_LOOP_BLOCK, ithread, nthreads,
+                       &start, &end);
+    if (start >= end) {
+        return;
+    }
+    for (i = 0; i < job->nop; ++i) {
+        data[i] = job->data[i] + start * job->stride[i];
+        count[i] = end - start;
+    }
+    job->innerloop(data, count, job->stride, job->innerloopdata);
+}
+
+/*
+ * The trivial loops allow an output to partially overlap an input as long
+ * as it trails behind it, which is only safe when iterating in order.
+ * Splitting the loop requires each output to be either exactly one of the
+ * inputs or not to overlap any of them.
+ */
+static int
+trivial_loop_split_ok(PyArrayObject **op, trivial_loop_job *job)
+{
+    int iout = job->nop - 1, i;
+
+    for (i = 0; i < iout; ++i) {
+        if (job->data[i] == job->data[iout] &&
+                job->stride[i] == job->stride[iout]) {
+            continue;
+        }
+        if (solve_may_share_memory(op[i], op[iout], 1) != 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Runs the inner loop over the prepared trivial iteration, split over the
+ * thread pool if it is large and doesn't need the Python API.
+ */
+static void
+trivial_loop(PyArrayObject **op, trivial_loop_job *job, int needs_api)
+{
+    int nthreads = 1;
+    NPY_BEGIN_THREADS_DEF;
+
+    if (!needs_api) {
+        nthreads = npy_parallel_threads(job->count);
+        if (nthreads > 1 && !trivial_loop_split_ok(op, job)) {
+            nthreads = 1;
+        }
+        NPY_BEGIN_THREADS_THRESHOLDED(job->count);
+    }
+
+    if (nthreads > 1) {
+        npy_parallel_run(nthreads, &trivial_loop_chunk, job);
+    }
+    else {
+        npy_intp count[3];
+
+        count[0] = count[1] = count[2] = job->count;
+        job->innerloop(job->data, count, job->stride, job->innerloopdata);
+    }
+
+    NPY_END_THREADS;
+}
+
 static void
 trivial_two_operand_loop(PyArrayObject **op,
                     PyUFuncGenericFunction innerloop,
                     void *innerloopdata)
 {
-    char *data[2];
-    npy_intp count[2], stride[2];
+    trivial_loop_job job;
     int needs_api;
-    NPY_BEGIN_THREADS_DEF;
 
     needs_api = PyDataType_REFCHK(PyArray_DESCR(op[0])) ||
                 PyDataType_REFCHK(PyArray_DESCR(op[1]));
 
     PyArray_PREPARE_TRIVIAL_PAIR_ITERATION(op[0], op[1],
-                                            count[0],
-                                            data[0], data[1],
-                                            stride[0], stride[1]);
-    count[1] = count[0];
-    NPY_UF_DBG_PRINT1("two operand loop count %d\n", (int)count[0]);
-
-    if (!needs_api) {
-        NPY_BEGIN_THREADS_THRESHOLDED(count[0]);
-    }
-
-    innerloop(data, count, stride, innerloopdata);
-
-    NPY_END_THREADS;
+                                            job.count,
+                                            job.data[0], job.data[1],
+                                            job.stride[0], job.stride[1]);
+    NPY_UF_DBG_PRINT1("two operand loop count %d\n", (int)job.count);
+
+    job.innerloop = innerloop;
+    job.innerloopdata = innerloopdata;
+    job.nop = 2;
+    trivial_loop(op, &job, needs_api);
 }
 
 static void
@@ -1314,30 +1399,25 @@ trivial_three_operand_loop(PyArrayObject **op,
                     PyUFuncGenericFunction innerloop,
                     void *innerloopdata)
 {
-    char *data[3];
-    npy_intp count[3], stride[3];
+    trivial_loop_job job;
     int needs_api;
-    NPY_BEGIN_THREADS_DEF;
 
     needs_api = PyDataType_REFCHK(PyArray_DESCR(op[0])) ||
                 PyDataType_REFCHK(PyArray_DESCR(op[1])) ||
                 PyDataType_REFCHK(PyArray_DESCR(op[2]));
 
     PyArray_PREPARE_TRIVIAL_TRIPLE_ITERATION(op[0], op[1], op[2],
-                                            count[0],
-                                            data[0], data[1], data[2],
-                                            stride[0], stride[1], stride[2]);
-    count[1] = count[0];
-    count[2] = count[0];
-    NPY_UF_DBG_PRINT1("three operand loop count %d\n", (int)count[0]);
-
-    if (!needs_api) {
-        NPY_BEGIN_THREADS_THRESHOLDED(count[0]);
-    }
-
-    innerloop(data, count, stride, innerloopdata);
-
-    NPY_END_THREADS;
+                                            job.count,
+                                            job.data[0], job.data[1],
+                                            job.data[2],
+                                            job.stride[0], job.stride[1],
+                                            job.stride[2]);
+    NPY_UF_DBG_PRINT1("three operand loop count %d\n", (int)job.count);
+
+    job.innerloop = innerloop;
+    job.innerloopdata = innerloopdata;
+    job.nop = 3;
+    trivial_loop(op, &job, needs_api);
 }
 
 /*
@@ -1403,6 +1483,95 @@ prepare_ufunc_output(PyUFuncObject *ufunc,
     return 0;
 }
 
+typedef struct {
+    NpyIter **iters;
+    PyUFuncGenericFunction innerloop;
+    void *innerloopdata;
+    char *errmsg[NPY_MAX_THREADS];
+} iterator_loop_job;
+
+static void
+iterator_loop_chunk(void *arg, int ithread, int nthreads)
+{
+    iterator_loop_job *job = (iterator_loop_job *)arg;
+    NpyIter *iter = job->iters[ithread];
+    NpyIter_IterNextFunc *iternext;
+    char **dataptr;
+    npy_intp *stride;
+    npy_intp *count_ptr;
+    npy_intp start, end;
+
+    npy_parallel_range(NpyIter_GetIterSize(iter), 1, ithread, nthreads,
+                       &start, &end);
+    if (start >= end) {
+        return;
+    }
+    if (NpyIter_ResetToIterIndexRange(iter, start, end,
+                                      &job->errmsg[ithread]) != NPY_SUCCEED) {
+        return;
+    }
+    iternext = NpyIter_GetIterNext(iter, &job->errmsg[ithread]);
+    if (iternext == NULL) {
+        return;
+    }
+    dataptr = NpyIter_GetDataPtrArray(iter);
+    stride = NpyIter_GetInnerStrideArray(iter);
+    count_ptr = NpyIter_GetInnerLoopSizePtr(iter);
+
+    do {
+        job->innerloop(dataptr, count_ptr, stride, job->innerloopdata);
+    } while (iternext(iter));
+}
+
+/*
+ * Runs the inner loop over a ranged iterator on nthreads threads, each
+ * using its own copy of the iterator restricted to a part of the
+ * iteration space.
+ */
+static int
+iterator_loop_parallel(NpyIter *iter, int nthreads,
+                       PyUFuncGenericFunction innerloop, void *innerloopdata)
+{
+    NpyIter *iters[NPY_MAX_THREADS];
+    iterator_loop_job job;
+    int i, ret = 0;
+    NPY_BEGIN_THREADS_DEF;
+
+    iters[0] = iter;
+    for (i = 1; i < nthreads; ++i) {
+        iters[i] = NpyIter_Copy(iter);
+        if (iters[i] == NULL) {
+            nthreads = i;
+            ret = -1;
+            goto finish;
+        }
+    }
+    job.iters = iters;
+    job.innerloop = innerloop;
+    job.innerloopdata = innerloopdata;
+    for (i = 0; i < nthreads; ++i) {
+        job.errmsg[i] = NULL;
+    }
+
+    NPY_BEGIN_THREADS;
+    npy_parallel_run(nthreads, &iterator_loop_chunk, &job);
+    NPY_END_THREADS;
+
+    for (i = 0; i < nthreads; ++i) {
+        if (job.errmsg[i] != NULL) {
+            PyErr_SetString(PyExc_ValueError, job.errmsg[i]);
+            ret = -1;
+            break;
+        }
+    }
+
+finish:
+    for (i = 1; i < nthreads; ++i) {
+        NpyIter_Deallocate(iters[i]);
+    }
+    return ret;
+}
+
 static int
 iterator_loop(PyUFuncObject *ufunc,
                     PyArrayObject **op,
@@ -1427,6 +1596,7 @@ iterator_loop(PyUFuncObject *ufunc,
 
     PyArrayObject **op_it;
     npy_uint32 iter_flags;
+    int nthreads;
 
     NPY_BEGIN_THREADS_DEF;
 
@@ -1461,6 +1631,10 @@ iterator_loop(PyUFuncObject *ufunc,
                  NPY_ITER_GROWINNER |
                  NPY_ITER_DELAY_BUFALLOC |
                  NPY_ITER_COPY_IF_OVERLAP;
+    /* Allow splitting the iteration over the thread pool */
+    if (npy_get_num_threads() > 1) {
+        iter_flags |= NPY_ITER_RANGED;
+    }
 
     /* Call the __array_prepare__ functions for already existing output arrays.
      * Do this before creating the iterator, as the iterator may UPDATEIFCOPY
@@ -1532,6 +1706,21 @@ iterator_loop(PyUFuncObject *ufunc,
             return -1;
         }
 
+        nthreads = 1;
+        if ((iter_flags & NPY_ITER_RANGED) &&
+                !NpyIter_IterationNeedsAPI(iter)) {
+            nthreads = npy_parallel_threads(NpyIter_GetIterSize(iter));
+        }
+        if (nthreads > 1) {
+            if (iterator_loop_parallel(iter, nthreads,
+                                       innerloop, innerloopdata) < 0) {
+                NpyIter_Deallocate(iter);
+                return -1;
+            }
+            NpyIter_Deallocate(iter);
+            return 0;
+        }
+
         /* Get the variables needed for the loop */
         iternext = NpyIter_GetIterNext(iter, NULL);
         if (iternext == NULL) {
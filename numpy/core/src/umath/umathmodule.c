@@ -29,6 +29,8 @@
 #include "abstract.h"
 
 #include "numpy/npy_math.h"
+#include "npy_cpu_features.h"
+#include "npy_threadpool.h"
 
 /*
  *****************************************************************************
@@ -243,6 +245,28 @@ add_newdoc_ufunc(PyObject *NPY_UNUSED(dummy), PyObject *args)
 }
 
 
+/* backend of numpy.setthreads, see numeric.py */
+static PyObject *
+set_num_threads(PyObject *NPY_UNUSED(dummy), PyObject *args)
+{
+    int nthreads;
+
+    if (!PyArg_ParseTuple(args, "i:_set_num_threads", &nthreads)) {
+        return NULL;
+    }
+    if (npy_set_num_threads(nthreads) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *
+get_num_threads(PyObject *NPY_UNUSED(dummy), PyObject *NPY_UNUSED(args))
+{
+    return PyInt_FromLong(npy_get_num_threads());
+}
+
+
 /*
  *****************************************************************************
  **                            SETUP UFUNCS                                 **
@@ -289,6 +313,10 @@ static struct PyMethodDef methods[] = {
         METH_VARARGS, NULL},
     {"_add_newdoc_ufunc", (PyCFunction)add_newdoc_ufunc,
         METH_VARARGS, NULL},
+    {"_set_num_threads", (PyCFunction)set_num_threads,
+        METH_VARARGS, NULL},
+    {"_get_num_threads", (PyCFunction)get_num_threads,
+        METH_NOARGS, NULL},
     {NULL, NULL, 0, NULL}                /* sentinel */
 };
 
@@ -346,6 +374,11 @@ PyMODINIT_FUNC initumath(void)
     if (PyType_Ready(&PyUFunc_Type) < 0)
         return RETVAL;
 
+    /* Select the simd loops for this cpu */
+    if (npy_cpu_init() < 0) {
+        goto err;
+    }
+
     /* Add some symbolic constants to the module */
     d = PyModule_GetDict(m);
 
@@ -401,6 +434,7 @@ PyMODINIT_FUNC initumath(void)
 #undef ADDCONST
 #undef ADDSCONST
     PyModule_AddIntConstant(m, "UFUNC_BUFSIZE_DEFAULT", (long)NPY_BUFSIZE);
+    PyModule_AddStringConstant(m, "_simd_isa", npy_simd_isa_name(npy_simd_isa));
 
     PyModule_AddObject(m, "PINF", PyFloat_FromDouble(NPY_INFINITY));
     PyModule_AddObject(m, "NINF", PyFloat_FromDouble(-NPY_INFINITY));
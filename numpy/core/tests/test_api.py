@@ -461,6 +461,30 @@ def test_copy_order():
     res = np.copy(c, order='K')
     check_copy_result(res, c, ccontig=False, fcontig=False, strides=True)
 
+def test_copy_transposed():
+    # Large transposed copies go through the tiled loop, check them for
+    # uneven tile edges, batches, negative strides and casts
+    for n, m in [(300, 517), (1000, 33), (33, 2000)]:
+        a = np.arange(n * m).reshape(n, m)
+        expected = np.arange(m)[:, None] + m * np.arange(n)
+        for dt in ['u1', 'i2', 'f4', 'f8', 'c16', 'O']:
+            b = a.astype(dt)
+            assert_equal(b.T.copy(), expected.astype(dt))
+            assert_equal(np.ascontiguousarray(b.T), expected.astype(dt))
+        assert_equal(a[::-1, ::-1].T.copy(), expected[::-1, ::-1])
+        assert_equal(a.T.astype('f4', order='C'), expected)
+        c = np.zeros((m, n), dtype='f8')
+        c[...] = a.T
+        assert_equal(c, expected)
+
+    a = np.arange(5 * 300 * 70).reshape(5, 300, 70)
+    for axes in [(0, 2, 1), (2, 1, 0), (1, 2, 0), (2, 0, 1)]:
+        t = a.transpose(axes)
+        expected = np.empty(t.shape, dtype=a.dtype)
+        for i in range(t.shape[0]):
+            expected[i] = t[i].tolist()
+        assert_equal(t.copy(), expected)
+
 def test_contiguous_flags():
     a = np.ones((4, 4, 1))[::2,:,:]
     if NPY_RELAXED_STRIDES_CHECKING:
@@ -3,7 +3,7 @@ from __future__ import division, absolute_import, print_function
 import numpy as np
 from numpy.testing import (
     TestCase, run_module_suite, assert_, assert_equal, assert_array_equal,
-    assert_almost_equal, assert_raises, suppress_warnings
+    assert_almost_equal, assert_allclose, assert_raises, suppress_warnings
     )
 
 # Setup for optimize einsum
@@ -684,6 +684,86 @@ class TestEinSum(TestCase):
         res = np.einsum('...ij,...jk->...ik', a, a, out=out)
         assert_equal(res, tgt)
 
+    def test_einsum_long_contiguous_loops(self):
+        # loops of at least 32 elements use the AVX2 and AVX512F kernels
+        # when available, check them around the multiples of their width
+        for dtype in np.typecodes['AllInteger'] + 'fd':
+            for n in [32, 33, 127, 128, 129, 1000]:
+                a = (np.arange(n) % 11).astype(dtype)
+                b = (np.arange(n)[::-1] % 7).astype(dtype)
+                ai, bi = a.astype(np.int64), b.astype(np.int64)
+                two = np.array(2, dtype=dtype)
+
+                def ref(x):
+                    # integer results wrap around like the loops do
+                    return np.asarray(x).astype(dtype)
+
+                assert_equal(np.einsum('i,i->', a, b), ref(np.dot(ai, bi)))
+                assert_equal(np.einsum('i->', a), ref(ai.sum()))
+                assert_equal(np.einsum('i,i->i', a, b), ref(ai * bi))
+                assert_equal(np.einsum(',i->i', two, a), ref(2 * ai))
+                assert_equal(np.einsum('i,->i', a, two), ref(2 * ai))
+                assert_equal(np.einsum(',i->', two, b), ref(2 * bi.sum()))
+                assert_equal(np.einsum('i,->', b, two), ref(2 * bi.sum()))
+                assert_equal(np.einsum('ji->j', np.vstack([a, b])),
+                             ref([ai.sum(), bi.sum()]))
+
+    def test_einsum_pairwise_contraction(self):
+        # Three or more operands are contracted in pairs when that is
+        # cheaper, compare with the single pass, which an output forces.
+        sizes = dict(zip('abcdeijklmnq', [6, 7, 8, 9, 5, 12, 20, 16, 18, 4,
+                                          10, 3]))
+        strings = ['ij,jk,kl->il', 'ij,jk,kl', 'bij,bjk,bkl->lib',
+                   'abc,cd,de,ea->b', 'ij,jk,klm,mn->in', 'ijq,jk,kl->',
+                   'i,j,k->kji', 'ij,ij,ij->ij']
+        rng = np.random.RandomState(11)
+        for dtype in [np.float64, np.complex64, np.int32, np.uint8,
+                      np.bool_]:
+            for string in strings:
+                ops = []
+                for term in string.split('->')[0].split(','):
+                    dims = [sizes[c] for c in term]
+                    ops.append((rng.rand(*dims) * 4).astype(dtype))
+                res = np.einsum(string, *ops)
+                tgt = np.zeros_like(res)
+                np.einsum(string, *ops, out=tgt)
+                # the second call uses the cached plan
+                for i in range(2):
+                    res = np.einsum(string, *ops)
+                    assert_equal(res.dtype, tgt.dtype)
+                    if res.dtype.kind in 'fc':
+                        assert_allclose(res, tgt, rtol=1e-4)
+                    else:
+                        assert_equal(res, tgt)
+
+        # empty summed and kept dimensions, which are planned like the
+        # shapes with those dimensions of length 1
+        a, b, c = np.ones((20, 0)), np.ones((0, 30)), np.ones((30, 40))
+        assert_equal(np.einsum('ij,jk,kl->il', a, b, c), np.zeros((20, 40)))
+        assert_equal(np.einsum('ij,jk,kl->il', b, c[:, :30], c).shape,
+                     (0, 40))
+        assert_equal(np.einsum('ij,jk,kl->il', c, c.T, c[:, :0]).shape,
+                     (30, 0))
+
+        # the output has the memory layout of the single pass for each
+        # order, which a byteswapped operand forces
+        for string in ['ij,jk,kl->il', 'ij,jk,kl->li', 'abc,cd,de->eba']:
+            terms = string.split('->')[0].split(',')
+            for fortran in [(False,) * 3, (True,) * 3, (True, False, True)]:
+                ops = []
+                for term, f in zip(terms, fortran):
+                    dims = [sizes[c] for c in term]
+                    if f:
+                        ops.append(rng.rand(*dims[::-1]).T)
+                    else:
+                        ops.append(rng.rand(*dims))
+                swapped = ops[0].astype(ops[0].dtype.newbyteorder())
+                for order in 'CFAK':
+                    res = np.einsum(string, *ops, order=order)
+                    tgt = np.einsum(string, swapped, *ops[1:], order=order)
+                    assert_equal(res.strides, tgt.strides)
+                    assert_allclose(res, tgt)
+
     def optimize_compare(self, string):
         # Tests all paths of the optimization function against
         # conventional einsum
@@ -1491,6 +1491,90 @@ class TestMethods(TestCase):
         assert_equal(np.sort(d), do)
         assert_equal(d[np.argsort(d)], do)
 
+    def test_sort_stable(self):
+        # the stable sort of the integer and float types is a radix sort
+        # for more than a few hundred items, check both paths against the
+        # other sorts
+        rng = np.random.RandomState(1)
+        types = np.typecodes['AllInteger'] + 'efd?' + 'mM'
+        for n in [10, 3000]:
+            for t in types:
+                if t in 'mM':
+                    a = rng.randint(-1000, 1000, n).astype(t + '8[s]')
+                    a[::7] = a.dtype.type('NaT')
+                elif t == '?':
+                    a = rng.randint(0, 2, n).astype(t)
+                else:
+                    a = rng.randint(0, 100, n).astype(t)
+                    if np.dtype(t).kind != 'u':
+                        a[::3] *= -1
+                msg = "stable sort, dtype=%s, n=%d" % (a.dtype, n)
+                for kind in ['m', 'stable']:
+                    assert_equal(np.sort(a, kind=kind),
+                                 np.sort(a, kind='h'), msg)
+                    i = np.argsort(a, kind=kind)
+                    assert_equal(a[i], np.sort(a, kind='h'), msg)
+                    # equal items keep their order
+                    for v in np.unique(a[i][:5]):
+                        assert_(np.all(np.diff(i[a[i] == v]) > 0), msg)
+                    assert_equal(np.sort(a.byteswap().newbyteorder(),
+                                         kind=kind),
+                                 np.sort(a, kind='h'), msg)
+                    assert_equal(np.sort(a[::-1], kind=kind),
+                                 np.sort(a, kind='h'), msg)
+
+        # signed zeros compare equal, so they must keep their order, and
+        # nans go to the end
+        for t in 'fd':
+            a = np.array([0., -0., np.nan, -np.inf, np.inf, 1., -1.] * 100,
+                         dtype=t)
+            i = np.argsort(a, kind='stable')
+            assert_equal(a[i], np.sort(a, kind='q'))
+            zeros = i[a[i] == 0]
+            assert_(np.all(np.diff(zeros) > 0))
+            b = np.sort(a, kind='stable')
+            assert_equal(np.signbit(b[b == 0]), np.signbit(a[a == 0]))
+
+        # the full range of 64 bit integers
+        a = np.array([np.iinfo(np.int64).min, -1, 0, 1,
+                      np.iinfo(np.int64).max] * 200)
+        rng.shuffle(a)
+        assert_equal(np.sort(a, kind='stable'), np.sort(a, kind='q'))
+        a = a.view(np.uint64)
+        assert_equal(np.sort(a, kind='stable'), np.sort(a, kind='q'))
+
+    def test_sort_threads(self):
+        # long axes are sorted in pieces on several threads and merged,
+        # which must give the same result as sorting on one thread
+        rng = np.random.RandomState(2)
+        n = 200001
+        old = np.setthreads(4)
+        try:
+            for t in ['i1', 'i8', 'f4', 'f8', 'e', 'c16', 'M8[s]']:
+                a = rng.randint(-1000, 1000, n).astype(t)
+                if t in ['e', 'f4', 'f8']:
+                    a[::17] = np.nan
+                    a[::13] = -0.
+                for kind in ['q', 'm', 'h']:
+                    msg = "threaded sort, dtype=%s, kind=%s" % (t, kind)
+                    np.setthreads(1)
+                    s1 = np.sort(a, kind=kind)
+                    i1 = np.argsort(a, kind=kind)
+                    np.setthreads(4)
+                    s4 = np.sort(a, kind=kind)
+                    i4 = np.argsort(a, kind=kind)
+                    assert_equal(s4, s1, msg)
+                    assert_equal(a[i4], s1, msg)
+                    if kind == 'm':
+                        assert_equal(i4, i1, msg)
+                    # strided and 2-d input goes through a buffer
+                    b = np.stack([a[::-1], a])
+                    assert_equal(np.sort(b, axis=1, kind=kind)[0], s1, msg)
+                    assert_equal(np.sort(b.T, axis=0, kind=kind)[:, 1], s1,
+                                 msg)
+        finally:
+            np.setthreads(old)
+
     def test_copy(self):
         def assert_fortran(arr):
             assert_(arr.flags.fortran)
@@ -4995,6 +5079,66 @@ class TestDot(TestCase):
         assert_equal(np.dot(b, a), res)
         assert_equal(np.dot(b, b), res)
 
+    def test_dot_blocked_types(self):
+        # types without BLAS are multiplied in blocks, compare with the
+        # inner products of python integers, wrapped like the dot loops
+        rng = np.random.RandomState(7)
+        for dt in np.typecodes['AllInteger']:
+            bits = 8 * np.dtype(dt).itemsize
+            for n, m, p in [(1, 1, 1), (5, 3, 4), (66, 260, 5), (3, 10, 260),
+                            (3, 0, 2)]:
+                a = rng.randint(-100, 100, size=(n, m)).astype(dt)
+                b = rng.randint(-100, 100, size=(m, p)).astype(dt)
+                if m == 0:
+                    tgt = np.zeros((n, p), dtype=dt)
+                else:
+                    s = np.dot(a.astype(object), b.astype(object))
+                    if np.dtype(dt).kind == 'i':
+                        s = (s + 2**(bits - 1)) % 2**bits - 2**(bits - 1)
+                    tgt = (s % 2**bits if np.dtype(dt).kind == 'u'
+                           else s).astype(dt)
+                for aa in [a, np.asfortranarray(a), np.repeat(a, 2, 1)[:, ::2]]:
+                    assert_equal(np.dot(aa, b), tgt)
+                    assert_equal(np.matmul(aa, b), tgt)
+                if m > 0:
+                    assert_equal(np.dot(a[0], b), tgt[0])
+                    assert_equal(np.dot(a, b[:, 0]), tgt[:, 0])
+                    assert_equal(np.dot(a[0], b[:, 0]), tgt[0, 0])
+
+    def test_dot_blocked_bool_half(self):
+        rng = np.random.RandomState(8)
+        a = rng.rand(70, 300) < 0.01
+        b = rng.rand(300, 260) < 0.01
+        tgt = (a[:, :, None] & b[None, :, :]).any(axis=1)
+        assert_equal(np.dot(a, b), tgt)
+        assert_equal(np.matmul(a.T.copy().T, b), tgt)
+
+        # half sums the products in float in order, like the old loops
+        a = rng.rand(70, 300).astype(np.float16)
+        b = rng.rand(300, 260).astype(np.float16)
+        tgt = np.zeros((70, 260), dtype=np.float32)
+        for k in range(300):
+            tgt += a[:, k, None].astype(np.float32) * b[k].astype(np.float32)
+        assert_equal(np.dot(a, b), tgt.astype(np.float16))
+        assert_allclose(np.dot(a, b), np.einsum('ij,jk', a.astype(float),
+                                                b.astype(float)), rtol=1e-2)
+
+    def test_dot_blocked_out_threads(self):
+        a = np.arange(40 * 50).reshape(40, 50) % 7
+        tgt = np.einsum('ij,kj', a, a)
+        old = np.setthreads(3)
+        try:
+            assert_equal(np.dot(a, a.T), tgt)
+            out = np.zeros((40, 40), dtype=a.dtype)
+            assert_(np.dot(a, a.T, out=out) is out)
+            assert_equal(out, tgt)
+            b = np.arange(40 * 40).reshape(40, 40) % 7
+            tgt = np.einsum('ij,jk', b, b)
+            np.dot(b, b, out=b)
+            assert_equal(b, tgt)
+        finally:
+            np.setthreads(old)
+
     def test_dot_scalar_and_matrix_of_objects(self):
         # Ticket #2469
         arr = np.matrix([1, 2], dtype=object)
@@ -5305,6 +5449,63 @@ class TestMatmul(MatmulCommon, TestCase):
         # self.matmul(a, b, out=c[..., 0])
         # assert_array_equal(c, tgt, err_msg=msg)
 
+    def test_stacked_layouts(self):
+        # stacks are computed natively for the BLAS types, compare with
+        # einsum for small and large matrices in various layouts
+        rng = np.random.RandomState(3)
+        for dt in [np.float32, np.float64, np.complex64, np.complex128]:
+            for n, m, p in [(1, 1, 1), (3, 4, 5), (2, 70, 70), (65, 66, 67)]:
+                a = rng.rand(4, n, m).astype(dt)
+                b = rng.rand(4, m, p).astype(dt)
+                if a.dtype.kind == 'c':
+                    a.imag = rng.rand(4, n, m)
+                    b.imag = rng.rand(4, m, p)
+                tgt = np.einsum('...ij,...jk', a, b)
+                rtol = 1e-4 if dt in (np.float32, np.complex64) else 1e-12
+                for aa in [a, a.swapaxes(-1, -2).copy().swapaxes(-1, -2),
+                           np.repeat(a, 2, axis=-1)[..., ::2]]:
+                    for bb in [b, b.swapaxes(-1, -2).copy().swapaxes(-1, -2),
+                               np.repeat(b, 2, axis=-1)[..., ::2]]:
+                        assert_allclose(self.matmul(aa, bb), tgt, rtol=rtol)
+                # broadcasting of the stack and 1-d operands
+                assert_allclose(self.matmul(a[:1], b), np.einsum(
+                    '...ij,...jk', a[:1], b), rtol=rtol)
+                assert_allclose(self.matmul(a, b[0, :, 0]),
+                                np.einsum('...ij,j', a, b[0, :, 0]),
+                                rtol=rtol)
+                assert_allclose(self.matmul(a[0, 0], b),
+                                np.einsum('i,...ij', a[0, 0], b), rtol=rtol)
+
+    def test_stacked_out(self):
+        a = np.arange(2 * 3 * 4, dtype=np.float64).reshape(2, 3, 4)
+        b = np.arange(2 * 4 * 3, dtype=np.float64).reshape(2, 4, 3)
+        tgt = np.einsum('...ij,...jk', a, b)
+        out = np.zeros((2, 3, 3))
+        res = np.matmul(a, b, out=out)
+        assert_(res is out)
+        assert_equal(out, tgt)
+
+        # output overlapping an input
+        c = np.arange(2 * 3 * 3, dtype=np.float64).reshape(2, 3, 3)
+        tgt = np.einsum('...ij,...jk', c, c)
+        np.matmul(c, c, out=c)
+        assert_equal(c, tgt)
+
+        # empty stacks and empty core dimensions
+        assert_equal(np.matmul(np.ones((0, 2, 3)), np.ones((3, 4))).shape,
+                     (0, 2, 4))
+        assert_equal(np.matmul(np.ones((5, 2, 0)), np.ones((0, 4))),
+                     np.zeros((5, 2, 4)))
+
+    def test_stacked_threads(self):
+        a = np.random.RandomState(5).rand(3000, 4, 4)
+        tgt = np.einsum('...ij,...jk', a, a)
+        old = np.setthreads(4)
+        try:
+            assert_allclose(np.matmul(a, a), tgt, rtol=1e-12)
+        finally:
+            np.setthreads(old)
+
 
 if sys.version_info[:2] >= (3, 5):
     class TestMatmulOperator(MatmulCommon, TestCase):
@@ -506,6 +506,49 @@ class TestSeterr(TestCase):
             np.seterrobj(olderrobj)
 
 
+class TestAllocPolicy(TestCase):
+    def test_default(self):
+        assert_equal(np.getallocpolicy(), dict(alignment=0,
+                                               hugepage_threshold=0,
+                                               first_touch=False))
+
+    def test_set(self):
+        old = np.setallocpolicy(alignment=64)
+        try:
+            assert_equal(np.getallocpolicy()['alignment'], 64)
+            assert_equal(np.setallocpolicy(first_touch=True)['alignment'],
+                         64)
+            assert_(np.getallocpolicy()['first_touch'])
+        finally:
+            np.setallocpolicy(**old)
+        assert_equal(np.getallocpolicy(), old)
+        assert_raises(ValueError, np.setallocpolicy, alignment=48)
+        assert_raises(ValueError, np.setallocpolicy, alignment=-1)
+        assert_equal(np.getallocpolicy(), old)
+
+    def test_context(self):
+        old = np.getallocpolicy()
+        old_threads = np.setthreads(3)
+        try:
+            with np.allocpolicy(alignment=128, hugepage_threshold=2**22,
+                                first_touch=True):
+                for n in [128, 1000, 2**20, 2**19 + 3]:
+                    a = np.zeros(n)
+                    b = np.empty(n, dtype=np.uint8)
+                    assert_(not a.any())
+                    if n * 8 >= 1024 and sys.platform != 'win32':
+                        assert_equal(a.ctypes.data % 128, 0)
+                    a[:] = 1
+                    b[...] = 2
+                    assert_equal(a.sum(), n)
+                    assert_equal(b.sum(dtype=int), 2 * n)
+                a.resize(2 * a.size, refcheck=False)
+                assert_equal(a[:a.size // 2].sum(), a.size // 2)
+        finally:
+            np.setthreads(old_threads)
+        assert_equal(np.getallocpolicy(), old)
+
+
 class TestFloatExceptions(TestCase):
     def assert_raises_fpe(self, fpeerr, flop, x, y):
         ftype = type(x)
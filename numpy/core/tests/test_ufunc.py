@@ -392,6 +392,34 @@ class TestUfunc(TestCase):
             d += d
             assert_almost_equal(d, 2.)
 
+    def test_sum_vectorized_order(self):
+        # the vectorized contiguous loop adds in the same order as the
+        # strided scalar one
+        rng = np.random.RandomState(1234)
+        for dt in (np.float32, np.float64):
+            for n in list(range(1, 300)) + [1023, 1025, 4097]:
+                b = np.zeros(2 * n + 2, dtype=dt)
+                a = b[1:-1:2]
+                a[...] = rng.uniform(-1, 1, size=n)
+                assert_equal(np.sum(a.copy()), np.sum(a))
+
+    def test_sum_threads(self):
+        # splitting the pairwise summation does not change the result
+        rng = np.random.RandomState(1234)
+        old = np.setthreads(1)
+        try:
+            for dt in (np.float16, np.float32, np.float64, np.longdouble):
+                for n in (4 * 65536 + 13, 7 * 65536):
+                    a = rng.uniform(-1, 1, size=n).astype(dt)
+                    tgt = [np.sum(a), np.sum(a[::3])]
+                    for nthreads in (2, 3, 4, 7):
+                        np.setthreads(nthreads)
+                        assert_equal(np.sum(a), tgt[0])
+                        assert_equal(np.sum(a[::3]), tgt[1])
+                    np.setthreads(1)
+        finally:
+            np.setthreads(old)
+
     def test_sum_complex(self):
         for dt in (np.complex64, np.complex128, np.clongdouble):
             for v in (0, 1, 2, 7, 8, 9, 15, 16, 19, 127,
@@ -1,7 +1,9 @@
 from __future__ import division, absolute_import, print_function
 
+import os
 import sys
 import platform
+import subprocess
 import warnings
 import fnmatch
 import itertools
@@ -1357,6 +1359,264 @@ class TestAbsoluteNegative(TestCase):
         np.abs(np.ones_like(d), out=d)
 
 
+class TestSimdDispatch(TestCase):
+    # sizes are large enough to reach the blocked loops of the widest (64
+    # byte) vector kernels for all alignments
+
+    def test_isa_name(self):
+        assert_(ncu._simd_isa in ('none', 'sse2', 'avx2', 'avx512f'))
+
+    def test_max_isa_environment(self):
+        code = 'import numpy; print(numpy.core.umath._simd_isa)'
+        for cap, allowed in [('none', ('none',)),
+                             ('SSE2', ('none', 'sse2')),
+                             ('avx2', ('none', 'sse2', 'avx2'))]:
+            env = dict(os.environ, NPY_SIMD_MAX_ISA=cap)
+            out = subprocess.check_output([sys.executable, '-c', code],
+                                          env=env)
+            assert_(out.decode('ascii').strip() in allowed, cap)
+
+    def test_binary_blocked(self):
+        ops = [np.add, np.subtract, np.multiply, np.divide]
+        for dt in [np.float32, np.float64]:
+            for out, inp1, inp2, msg in _gen_alignment_data(
+                    dtype=dt, type='binary', max_size=40):
+                # avoid dividing by zero
+                inp2 += 1
+                for op in ops:
+                    tgt = [op(a, b) for a, b in zip(inp1, inp2)]
+                    assert_equal(op(inp1, inp2), tgt, err_msg=msg)
+                    tgt = [op(inp1[0], b) for b in inp2]
+                    assert_equal(op(inp1[0], inp2), tgt, err_msg=msg)
+                    tgt = [op(a, inp2[0]) for a in inp1]
+                    assert_equal(op(inp1, inp2[0]), tgt, err_msg=msg)
+
+    def test_unary_blocked(self):
+        for dt in [np.float32, np.float64]:
+            for out, inp, msg in _gen_alignment_data(
+                    dtype=dt, type='unary', max_size=40):
+                inp[::2] *= -1
+                tgt = [ncu.absolute(i) for i in inp]
+                assert_equal(np.absolute(inp), tgt, err_msg=msg)
+                tgt = [-i for i in inp]
+                assert_equal(np.negative(inp), tgt, err_msg=msg)
+                inp = np.abs(inp)
+                tgt = [ncu.sqrt(i) for i in inp]
+                assert_equal(np.sqrt(inp), tgt, err_msg=msg)
+
+    def test_comparison_blocked(self):
+        ops = [np.equal, np.not_equal, np.less, np.less_equal,
+               np.greater, np.greater_equal]
+        for dt in [np.float32, np.float64]:
+            for n in range(1, 140):
+                for o1, o2 in [(0, 0), (1, 0), (0, 1), (3, 5)]:
+                    a = np.arange(n + o1, dtype=dt)[o1:]
+                    b = np.arange(n + o2, dtype=dt)[o2:][::-1].copy()
+                    a[::3] = np.nan
+                    for op in ops:
+                        with np.errstate(invalid='ignore'):
+                            tgt = [op(x, y) for x, y in zip(a, b)]
+                            assert_equal(op(a, b), tgt)
+                            tgt = [op(a[-1], y) for y in b]
+                            assert_equal(op(a[-1], b), tgt)
+                            tgt = [op(x, b[0]) for x in a]
+                            assert_equal(op(a, b[0]), tgt)
+
+    def test_bool_blocked(self):
+        for n in range(1, 100):
+            for o in range(3):
+                a = (np.arange(n + o) % 3 == 0)[o:]
+                b = (np.arange(n + o) % 2 == 0)[o:]
+                assert_equal(np.logical_and(a, b),
+                             [x and y for x, y in zip(a, b)])
+                assert_equal(np.logical_or(a, b),
+                             [x or y for x, y in zip(a, b)])
+                assert_equal(np.logical_not(a), [not x for x in a])
+                assert_equal(np.absolute(a), a)
+                # any nonzero byte must be treated as true
+                c = np.arange(n + o, dtype=np.uint8)[o:].view(np.bool_)
+                assert_equal(np.logical_or(c, c),
+                             np.arange(n + o)[o:] != 0)
+                assert_equal(np.logical_not(c), np.arange(n + o)[o:] == 0)
+
+
+class TestSimdTranscendental(TestCase):
+    # The loops use the polynomial approximations of simd.inc.src where
+    # available, the bounds are the documented errors plus the rounding of
+    # the long double reference.
+    max_ulp = {'exp': 2, 'log': 2, 'sin': 2, 'cos': 2, 'tanh': 4}
+    ranges = {'exp': [(-87, 88), (-1, 1)],
+              'log': [(0, 10), (0.5, 2), (0, 1e30)],
+              'sin': [(-10, 10), (-8192, 8192)],
+              'cos': [(-10, 10), (-8192, 8192)],
+              'tanh': [(-10, 10), (-0.5, 0.5)]}
+    special = [np.nan, np.inf, -np.inf, 0., -0., 1e-40, -1e-40, 1e-200,
+               -1e-200, 1000., -1000., 1e30, -1e30, 1e300, -1e300]
+
+    def strided(self, f, x):
+        y = np.empty(2 * x.size, dtype=x.dtype)[::2]
+        y[...] = x
+        return f(y)
+
+    def reference(self, f, x):
+        return f(x.astype(np.longdouble)).astype(x.dtype)
+
+    def ulp_error(self, f, x):
+        res = f(x)
+        ref = self.reference(f, x)
+        assert_array_equal(np.isnan(res), np.isnan(ref))
+        finite = np.isfinite(ref)
+        assert_array_equal(res[~finite], ref[~finite])
+        res, ref = res[finite], ref[finite]
+        # differences of a few ulp are exact
+        return np.max(np.abs(res - ref) / np.spacing(np.abs(ref)))
+
+    def test_ulp(self):
+        rnd = np.random.RandomState(42)
+        for dt in [np.float32, np.float64]:
+            for name, ranges in self.ranges.items():
+                f = getattr(np, name)
+                for lo, hi in ranges:
+                    x = rnd.uniform(lo, hi, 10000).astype(dt)
+                    for o in range(3):
+                        err = self.ulp_error(f, x[o:])
+                        assert_(err <= self.max_ulp[name],
+                                (name, dt, lo, hi, err))
+
+    def test_special_values(self):
+        for dt in [np.float32, np.float64]:
+            for name in self.ranges:
+                f = getattr(np, name)
+                for v in self.special:
+                    # a single special lane among regular values
+                    x = np.linspace(0.1, 2, 67).astype(dt)
+                    x[33] = v
+                    with np.errstate(all='ignore'):
+                        res = f(x)
+                        ref = self.reference(f, x)
+                    res, ref = res[33], ref[33]
+                    msg = '%s(%r), %s' % (name, v, dt.__name__)
+                    if np.isfinite(ref) and ref != 0:
+                        err = abs(res - ref) / np.spacing(abs(ref))
+                        assert_(err <= self.max_ulp[name], msg)
+                    else:
+                        assert_equal(res, ref, err_msg=msg)
+                        if not np.isnan(ref):
+                            assert_equal(np.signbit(res), np.signbit(ref),
+                                         err_msg=msg)
+
+    def test_fp_errors(self):
+        for dt in [np.float32, np.float64]:
+            for name, ranges in self.ranges.items():
+                f = getattr(np, name)
+                # no spurious exceptions in the vector loops
+                for lo, hi in ranges:
+                    x = np.linspace(lo, hi, 1001)[1:].astype(dt)
+                    with np.errstate(all='raise', under='ignore'):
+                        f(x)
+            for f, v, err in [(np.exp, 1000., 'over'), (np.log, 0., 'divide'),
+                              (np.log, -1., 'invalid'),
+                              (np.sin, np.inf, 'invalid'),
+                              (np.cos, np.inf, 'invalid')]:
+                x = np.ones(67, dtype=dt)
+                x[33] = v
+                with np.errstate(**{err: 'raise'}):
+                    assert_raises(FloatingPointError, f, x)
+                    assert_raises(FloatingPointError, self.strided, f, x)
+
+    def test_same_result_everywhere(self):
+        # the result depends only on the value, not on the alignment,
+        # length or strides of the array
+        rnd = np.random.RandomState(7)
+        for dt in [np.float32, np.float64]:
+            bits = 'u%d' % np.dtype(dt).itemsize
+            for name, ranges in self.ranges.items():
+                f = getattr(np, name)
+                x = [rnd.uniform(lo, hi, 50) for lo, hi in ranges]
+                with np.errstate(all='ignore'):
+                    x = rnd.permutation(np.concatenate(x + [self.special]))
+                    x = x.astype(dt)
+                    ref = f(x).view(bits)
+                    for o in range(17):
+                        assert_equal(f(x[o:]).view(bits), ref[o:])
+                    for n in range(1, 40, 3):
+                        assert_equal(f(x[:n]).view(bits), ref[:n])
+                    for step in [2, 3, -1, -5]:
+                        assert_equal(f(x[::step]).view(bits), ref[::step])
+                    out = np.empty(2 * x.size, dtype=dt)[::2]
+                    f(x, out=out)
+                    assert_equal(out.view(bits), ref)
+                    y = x.copy()
+                    f(y, out=y)
+                    assert_equal(y.view(bits), ref)
+                    res = np.array([f(v) for v in x[:20]], dtype=dt)
+                    assert_equal(res.view(bits), ref[:20])
+
+
+class TestThreads(TestCase):
+    # large enough to be split over four threads
+    n = 4 * 65536 + 7
+
+    def setUp(self):
+        self.old = np.setthreads(4)
+
+    def tearDown(self):
+        np.setthreads(self.old)
+
+    def test_setthreads(self):
+        assert_equal(np.getthreads(), 4)
+        assert_equal(np.setthreads(2), 4)
+        assert_equal(np.getthreads(), 2)
+        assert_raises(ValueError, np.setthreads, 0)
+        assert_raises(TypeError, np.setthreads, 2.)
+        assert_equal(np.getthreads(), 2)
+
+    def test_trivial_loops(self):
+        a = np.arange(self.n, dtype=np.float64)
+        b = a[::-1].copy()
+        c = np.empty_like(a)
+        np.setthreads(1)
+        tgt_sqrt = np.sqrt(a)
+        tgt_add = a + b
+        np.setthreads(4)
+        assert_equal(np.sqrt(a), tgt_sqrt)
+        assert_equal(a + b, tgt_add)
+        assert_equal(np.add(a, b, out=c), tgt_add)
+        assert_equal(a + 1.5, a + np.full_like(a, 1.5))
+
+    def test_iterator_loop(self):
+        # casting and non-contiguous operands use the buffered iterator
+        a = np.arange(2 * self.n, dtype=np.float32)[::2]
+        b = np.arange(self.n, dtype=np.int16).reshape(-1, 1)
+        np.setthreads(1)
+        tgt1 = np.add(a, 1.5, dtype=np.float64)
+        tgt2 = b + b.T[:, :3]
+        np.setthreads(4)
+        assert_equal(np.add(a, 1.5, dtype=np.float64), tgt1)
+        assert_equal(b + b.T[:, :3], tgt2)
+
+    def test_inplace_overlap(self):
+        # the output trailing its input is only valid in order
+        a = np.arange(self.n, dtype=np.float64)
+        tgt = a.copy()
+        tgt[:-1] = tgt[1:] * 2
+        np.multiply(a[1:], 2, out=a[:-1])
+        assert_equal(a, tgt)
+
+    def test_floating_point_errors(self):
+        a = np.ones(self.n)
+        a[-1] = 0
+        with np.errstate(divide='raise'):
+            assert_raises(FloatingPointError, np.divide, 1., a)
+        a[-1] = -1
+        with np.errstate(invalid='raise'):
+            assert_raises(FloatingPointError, np.sqrt, a)
+
+    def test_object_loop(self):
+        a = np.arange(self.n).astype(object)
+        assert_equal(a + a, 2 * np.arange(self.n))
+
+
 class TestPositive(TestCase):
     def test_valid(self):
         valid_dtypes = [int, float, complex, object]
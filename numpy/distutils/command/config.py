@@ -16,11 +16,13 @@ from distutils.ccompiler import CompileError, LinkError
 import distutils
 from numpy.distutils.exec_command import exec_command
 from numpy.distutils.mingw32ccompiler import generate_manifest
-from numpy.distutils.command.autodist import (check_gcc_function_attribute,
-                                              check_gcc_variable_attribute,
-                                              check_inline,
-                                              check_restrict,
-                                              check_compiler_gcc4)
+from numpy.distutils.command.autodist import (
+        check_gcc_function_attribute,
+        check_gcc_function_attribute_with_intrinsics,
+        check_gcc_variable_attribute,
+        check_inline,
+        check_restrict,
+        check_compiler_gcc4)
 from numpy.distutils.compat import get_exception
 
 LANG_EXT['f77'] = '.f'
@@ -415,6 +417,11 @@ int main (void)
     def check_gcc_function_attribute(self, attribute, name):
         return check_gcc_function_attribute(self, attribute, name)
 
+    def check_gcc_function_attribute_with_intrinsics(self, attribute, name,
+                                                     code, include):
+        return check_gcc_function_attribute_with_intrinsics(
+            self, attribute, name, code, include)
+
     def check_gcc_variable_attribute(self, attribute):
         return check_gcc_variable_attribute(self, attribute)
 
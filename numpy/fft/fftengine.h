@@ -0,0 +1,110 @@
+#ifndef _NPY_FFTENGINE_H_
+#define _NPY_FFTENGINE_H_
+
+#include "numpy/npy_common.h"
+
+/*
+ * Mixed radix FFT engine behind numpy.fft.
+ *
+ * A plan holds everything needed to transform rows of a given length and
+ * precision: the factorization of the length into radix 2, 3, 4, 5, 8 and
+ * generic odd passes with their twiddle factors, or, for lengths with
+ * large prime factors, a Bluestein convolution through a plan of smooth
+ * length. Real transforms of even length run as complex transforms of half
+ * the length. Plans are immutable once created, so any number of threads
+ * may execute the same plan at the same time, each with its own buffer.
+ *
+ * The functions never touch the Python API; allocation failures are
+ * reported through their return values.
+ */
+
+/* more than enough passes for any npy_intp length */
+#define NPY_FFT_MAXFACT 64
+
+typedef struct npy_fft_cplan_tag npy_fft_cplan;
+
+/* complex transform of length n */
+struct npy_fft_cplan_tag {
+    npy_intp n;
+    int nfact;
+    npy_intp fact[NPY_FFT_MAXFACT];
+    /*
+     * twiddle factors of pass f, (fact[f] - 1) * ido complex numbers, and
+     * the fact[f]-th roots of unity for the generic odd radix passes
+     */
+    void *tw[NPY_FFT_MAXFACT];
+    void *roots[NPY_FFT_MAXFACT];
+    /*
+     * Bluestein: if blue is not NULL, the transform is a convolution of
+     * the input times the chirp with the chirp, done through the plan
+     * `blue` of smooth length m >= 2n - 1. chirp holds n complex numbers,
+     * chirpf the m point transform of the padded chirp scaled by 1/m.
+     */
+    npy_fft_cplan *blue;
+    void *chirp;
+    void *chirpf;
+};
+
+typedef struct {
+    /* transform length and element type (NPY_FLOAT or NPY_DOUBLE) */
+    npy_intp n;
+    int real;
+    int type_num;
+    /* complex plan of length n, or n/2 for real transforms of even n */
+    npy_fft_cplan c;
+    /* real transforms of even n: e^(2 pi i k / n) for k < n/2 */
+    void *rtw;
+    /* bytes of the buffer needed by npy_fft_execute_* */
+    npy_intp bufsize;
+    /* bytes of twiddle factors held by the plan */
+    size_t nbytes;
+    /* for use by the owner, e.g. reference counting in a plan cache */
+    int refcount;
+    int cached;
+} npy_fft_plan;
+
+/*
+ * Create a plan for transforms of length n > 0, complex or real. Returns
+ * NULL if out of memory.
+ */
+NPY_VISIBILITY_HIDDEN npy_fft_plan *
+npy_fft_plan_new_float(npy_intp n, int real);
+
+NPY_VISIBILITY_HIDDEN npy_fft_plan *
+npy_fft_plan_new_double(npy_intp n, int real);
+
+NPY_VISIBILITY_HIDDEN void
+npy_fft_plan_free(npy_fft_plan *plan);
+
+/*
+ * Transform `rows` rows, `in_dist` bytes apart at `in` and `out_dist`
+ * bytes apart at `out`. The first `nin` elements of each input row,
+ * `in_step` bytes apart, are read and zero padded (or truncated) to the
+ * transform length, and the result times `fct` is written to the output
+ * row with a step of `out_step` bytes. Complex plans read and write n
+ * complex numbers. Real plans read n real and write n/2 + 1 complex
+ * numbers going forward, and read n/2 + 1 complex (of which the imaginary
+ * parts of the zero and, for even n, the n/2 frequency terms are ignored)
+ * and write n real numbers going backward. Elements are of the precision
+ * of the plan. Input and output may be the same memory. The rows are
+ * gathered and scattered together, so several rows that are adjacent in
+ * memory are read and written a cache line at a time. `buf` must hold
+ * rows * plan->bufsize bytes.
+ */
+NPY_VISIBILITY_HIDDEN void
+npy_fft_execute_float(const npy_fft_plan *plan, int forward, double fct,
+                      npy_intp rows,
+                      const char *in, npy_intp in_step, npy_intp in_dist,
+                      npy_intp nin,
+                      char *out, npy_intp out_step, npy_intp out_dist,
+                      void *buf);
+
+NPY_VISIBILITY_HIDDEN void
+npy_fft_execute_double(const npy_fft_plan *plan, int forward, double fct,
+                       npy_intp rows,
+                       const char *in, npy_intp in_step, npy_intp in_dist,
+                       npy_intp nin,
+                       char *out, npy_intp out_step, npy_intp out_dist,
+                       void *buf);
+
+#endif
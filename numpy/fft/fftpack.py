@@ -26,8 +26,12 @@ n = n-dimensional transform
 (Note: 2D routines are just nD routines with different default
 behavior.)
 
-The underlying code for these functions is an f2c-translated and modified
-version of the FFTPACK routines.
+The transforms are computed by a mixed radix FFT written in C, which uses
+the Bluestein algorithm for lengths with large prime factors and computes
+batches of transforms along an axis on the threads set by
+`numpy.setthreads`. Single precision input, float32 or complex64, is
+transformed in single precision and gives single precision output; all
+other input is transformed in double precision.
 
 """
 from __future__ import division, absolute_import, print_function
@@ -35,61 +39,21 @@ from __future__ import division, absolute_import, print_function
 __all__ = ['fft', 'ifft', 'rfft', 'irfft', 'hfft', 'ihfft', 'rfftn',
            'irfftn', 'rfft2', 'irfft2', 'fft2', 'ifft2', 'fftn', 'ifftn']
 
-from numpy.core import (array, asarray, zeros, swapaxes, shape, conjugate,
-                        take, sqrt)
+from numpy.core import asarray, conjugate, take, sqrt
+from numpy.core.multiarray import normalize_axis_index
+from numpy.core.numeric import getthreads
 from . import fftpack_lite as fftpack
-from .helper import _FFTCache
 
-_fft_cache = _FFTCache(max_size_in_mb=100, max_item_count=32)
-_real_fft_cache = _FFTCache(max_size_in_mb=100, max_item_count=32)
 
-
-def _raw_fft(a, n=None, axis=-1, init_function=fftpack.cffti,
-             work_function=fftpack.cfftf, fft_cache=_fft_cache):
-    a = asarray(a)
-
-    if n is None:
-        n = a.shape[axis]
-
-    if n < 1:
-        raise ValueError("Invalid number of FFT data points (%d) specified."
-                         % n)
-
-    # We have to ensure that only a single thread can access a wsave array
-    # at any given time. Thus we remove it from the cache and insert it
-    # again after it has been used. Multiple threads might create multiple
-    # copies of the wsave array. This is intentional and a limitation of
-    # the current C code.
-    wsave = fft_cache.pop_twiddle_factors(n)
-    if wsave is None:
-        wsave = init_function(n)
-
-    if a.shape[axis] != n:
-        s = list(a.shape)
-        if s[axis] > n:
-            index = [slice(None)]*len(s)
-            index[axis] = slice(0, n)
-            a = a[index]
-        else:
-            index = [slice(None)]*len(s)
-            index[axis] = slice(0, s[axis])
-            s[axis] = n
-            z = zeros(s, a.dtype.char)
-            z[index] = a
-            a = z
-
-    if axis != -1:
-        a = swapaxes(a, axis, -1)
-    r = work_function(a, wsave)
-    if axis != -1:
-        r = swapaxes(r, axis, -1)
-
-    # As soon as we put wsave back into the cache, another thread could pick it
-    # up and start using it, so we must not do this until after we're
-    # completely done using it ourselves.
-    fft_cache.put_twiddle_factors(n, wsave)
-
-    return r
+def _raw_fft(a, n, axis, is_real, is_forward, fct, out=None):
+    """
+    Transform `a` along `axis`, cropped or zero padded to `n` points, and
+    multiply the result by `fct`. The input is neither copied nor
+    swapped around, the C code reads and writes the rows in place with
+    whatever strides they have. `out`, if given, may be `a` itself.
+    """
+    return fftpack.execute(a, is_real, is_forward, n, axis, fct,
+                           getthreads(), out)
 
 
 def _unitary(norm):
@@ -99,6 +63,16 @@ def _unitary(norm):
     return norm is not None
 
 
+def _norm_factor(n, norm, inverse):
+    """Factor applied to a transform of `n` points for the given `norm`."""
+    if n < 1:
+        raise ValueError("Invalid number of FFT data points (%d) specified."
+                         % n)
+    if _unitary(norm):
+        return 1 / sqrt(n)
+    return 1 / n if inverse else 1
+
+
 def fft(a, n=None, axis=-1, norm=None):
     """
     Compute the one-dimensional discrete Fourier Transform.
@@ -186,13 +160,12 @@ def fft(a, n=None, axis=-1, norm=None):
 
     """
 
-    a = asarray(a).astype(complex, copy=False)
+    a = asarray(a)
+    axis = normalize_axis_index(axis, a.ndim)
     if n is None:
         n = a.shape[axis]
-    output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftf, _fft_cache)
-    if _unitary(norm):
-        output *= 1 / sqrt(n)
-    return output
+    fct = _norm_factor(n, norm, False)
+    return _raw_fft(a, n, axis, False, True, fct)
 
 
 def ifft(a, n=None, axis=-1, norm=None):
@@ -279,13 +252,12 @@ def ifft(a, n=None, axis=-1, norm=None):
     >>> plt.show()
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = asarray(a)
+    axis = normalize_axis_index(axis, a.ndim)
     if n is None:
         n = a.shape[axis]
-    unitary = _unitary(norm)
-    output = _raw_fft(a, n, axis, fftpack.cffti, fftpack.cfftb, _fft_cache)
-    return output * (1 / (sqrt(n) if unitary else n))
+    fct = _norm_factor(n, norm, True)
+    return _raw_fft(a, n, axis, False, False, fct)
 
 
 def rfft(a, n=None, axis=-1, norm=None):
@@ -366,15 +338,12 @@ def rfft(a, n=None, axis=-1, norm=None):
     exploited to compute only the non-negative frequency terms.
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
-    output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftf,
-                      _real_fft_cache)
-    if _unitary(norm):
-        if n is None:
-            n = a.shape[axis]
-        output *= 1 / sqrt(n)
-    return output
+    a = asarray(a)
+    axis = normalize_axis_index(axis, a.ndim)
+    if n is None:
+        n = a.shape[axis]
+    fct = _norm_factor(n, norm, False)
+    return _raw_fft(a, n, axis, True, True, fct)
 
 
 def irfft(a, n=None, axis=-1, norm=None):
@@ -457,14 +426,12 @@ def irfft(a, n=None, axis=-1, norm=None):
     specified, and the output array is purely real.
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = asarray(a)
+    axis = normalize_axis_index(axis, a.ndim)
     if n is None:
         n = (a.shape[axis] - 1) * 2
-    unitary = _unitary(norm)
-    output = _raw_fft(a, n, axis, fftpack.rffti, fftpack.rfftb,
-                      _real_fft_cache)
-    return output * (1 / (sqrt(n) if unitary else n))
+    fct = _norm_factor(n, norm, True)
+    return _raw_fft(a, n, axis, True, False, fct)
 
 
 def hfft(a, n=None, axis=-1, norm=None):
@@ -541,12 +508,12 @@ def hfft(a, n=None, axis=-1, norm=None):
            [ 2., -2.]])
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = asarray(a)
+    axis = normalize_axis_index(axis, a.ndim)
     if n is None:
         n = (a.shape[axis] - 1) * 2
-    unitary = _unitary(norm)
-    return irfft(conjugate(a), n, axis) * (sqrt(n) if unitary else n)
+    fct = _norm_factor(n, norm, False)
+    return _raw_fft(conjugate(a), n, axis, True, False, fct)
 
 
 def ihfft(a, n=None, axis=-1, norm=None):
@@ -601,13 +568,13 @@ def ihfft(a, n=None, axis=-1, norm=None):
     array([ 1.-0.j,  2.-0.j,  3.-0.j,  4.-0.j])
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = asarray(a)
+    axis = normalize_axis_index(axis, a.ndim)
     if n is None:
         n = a.shape[axis]
-    unitary = _unitary(norm)
-    output = conjugate(rfft(a, n, axis))
-    return output * (1 / (sqrt(n) if unitary else n))
+    fct = _norm_factor(n, norm, True)
+    output = _raw_fft(a, n, axis, True, True, fct)
+    return conjugate(output, out=output)
 
 
 def _cook_nd_args(a, s=None, axes=None, invreal=0):
@@ -629,13 +596,21 @@ def _cook_nd_args(a, s=None, axes=None, invreal=0):
     return s, axes
 
 
-def _raw_fftnd(a, s=None, axes=None, function=fft, norm=None):
+def _raw_fftnd(a, s=None, axes=None, is_forward=True, norm=None,
+               owned=False):
     a = asarray(a)
     s, axes = _cook_nd_args(a, s, axes)
     itl = list(range(len(axes)))
     itl.reverse()
     for ii in itl:
-        a = function(a, n=s[ii], axis=axes[ii], norm=norm)
+        n = s[ii]
+        axis = normalize_axis_index(axes[ii], a.ndim)
+        fct = _norm_factor(n, norm, not is_forward)
+        # after the first transform, the remaining axes of the same length
+        # are transformed in place
+        out = a if owned and a.shape[axis] == n else None
+        a = _raw_fft(a, n, axis, False, is_forward, fct, out)
+        owned = True
     return a
 
 
@@ -733,7 +708,7 @@ def fftn(a, s=None, axes=None, norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, fft, norm)
+    return _raw_fftnd(a, s, axes, True, norm)
 
 
 def ifftn(a, s=None, axes=None, norm=None):
@@ -830,7 +805,7 @@ def ifftn(a, s=None, axes=None, norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, ifft, norm)
+    return _raw_fftnd(a, s, axes, False, norm)
 
 
 def fft2(a, s=None, axes=(-2, -1), norm=None):
@@ -920,7 +895,7 @@ def fft2(a, s=None, axes=(-2, -1), norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, fft, norm)
+    return _raw_fftnd(a, s, axes, True, norm)
 
 
 def ifft2(a, s=None, axes=(-2, -1), norm=None):
@@ -1007,7 +982,7 @@ def ifft2(a, s=None, axes=(-2, -1), norm=None):
 
     """
 
-    return _raw_fftnd(a, s, axes, ifft, norm)
+    return _raw_fftnd(a, s, axes, False, norm)
 
 
 def rfftn(a, s=None, axes=None, norm=None):
@@ -1093,13 +1068,10 @@ def rfftn(a, s=None, axes=None, norm=None):
             [ 0.+0.j,  0.+0.j]]])
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=float)
+    a = asarray(a)
     s, axes = _cook_nd_args(a, s, axes)
     a = rfft(a, s[-1], axes[-1], norm)
-    for ii in range(len(axes)-1):
-        a = fft(a, s[ii], axes[ii], norm)
-    return a
+    return _raw_fftnd(a, s[:-1], axes[:-1], True, norm, owned=True)
 
 
 def rfft2(a, s=None, axes=(-2, -1), norm=None):
@@ -1224,13 +1196,10 @@ def irfftn(a, s=None, axes=None, norm=None):
             [ 1.,  1.]]])
 
     """
-    # The copy may be required for multithreading.
-    a = array(a, copy=True, dtype=complex)
+    a = asarray(a)
     s, axes = _cook_nd_args(a, s, axes, invreal=1)
-    for ii in range(len(axes)-1):
-        a = ifft(a, s[ii], axes[ii], norm)
-    a = irfft(a, s[-1], axes[-1], norm)
-    return a
+    a = _raw_fftnd(a, s[:-1], axes[:-1], False, norm)
+    return irfft(a, s[-1], axes[-1], norm)
 
 
 def irfft2(a, s=None, axes=(-2, -1), norm=None):
@@ -2,315 +2,325 @@
 
 #include "Python.h"
 #include "numpy/arrayobject.h"
-#include "fftpack.h"
-
-static PyObject *ErrorObject;
-
-static const char fftpack_cfftf__doc__[] = "";
-
-static PyObject *
-fftpack_cfftf(PyObject *NPY_UNUSED(self), PyObject *args)
+#include "npy_config.h"
+#include "npy_cpu_features.h"
+#include "npy_threadpool.h"
+#include "fftengine.h"
+
+/*
+ * Plans are cached by length, kind and precision, most recently used
+ * first. The cache and the reference counts of the plans are only touched
+ * with the GIL held; a plan evicted while other threads still execute it
+ * is freed by the last of them.
+ */
+#define FFT_CACHE_SIZE 32
+#define FFT_CACHE_BYTES (100 * 1024 * 1024)
+
+static npy_fft_plan *plan_cache[FFT_CACHE_SIZE];
+static int plan_cache_count = 0;
+
+static void
+release_plan(npy_fft_plan *plan)
 {
-    PyObject *op1, *op2;
-    PyArrayObject *data;
-    PyArray_Descr *descr;
-    double *wsave, *dptr;
-    npy_intp nsave;
-    int npts, nrepeats, i;
-
-    if(!PyArg_ParseTuple(args, "OO:cfftf", &op1, &op2)) {
-        return NULL;
-    }
-    data = (PyArrayObject *)PyArray_CopyFromObject(op1,
-            NPY_CDOUBLE, 1, 0);
-    if (data == NULL) {
-        return NULL;
-    }
-    descr = PyArray_DescrFromType(NPY_DOUBLE);
-    if (PyArray_AsCArray(&op2, (void *)&wsave, &nsave, 1, descr) == -1) {
-        goto fail;
-    }
-    if (data == NULL) {
-        goto fail;
-    }
-
-    npts = PyArray_DIM(data, PyArray_NDIM(data) - 1);
-    if (nsave != npts*4 + 15) {
-        PyErr_SetString(ErrorObject, "invalid work array for fft size");
-        goto fail;
+    if (--plan->refcount == 0 && !plan->cached) {
+        npy_fft_plan_free(plan);
     }
+}
 
-    nrepeats = PyArray_SIZE(data)/npts;
-    dptr = (double *)PyArray_DATA(data);
-    Py_BEGIN_ALLOW_THREADS;
-    NPY_SIGINT_ON;
-    for (i = 0; i < nrepeats; i++) {
-        npy_cfftf(npts, dptr, wsave);
-        dptr += npts*2;
+static void
+uncache_plan(npy_fft_plan *plan)
+{
+    plan->cached = 0;
+    if (plan->refcount == 0) {
+        npy_fft_plan_free(plan);
     }
-    NPY_SIGINT_OFF;
-    Py_END_ALLOW_THREADS;
-    PyArray_Free(op2, (char *)wsave);
-    return (PyObject *)data;
-
-fail:
-    PyArray_Free(op2, (char *)wsave);
-    Py_DECREF(data);
-    return NULL;
 }
 
-static const char fftpack_cfftb__doc__[] = "";
-
-static PyObject *
-fftpack_cfftb(PyObject *NPY_UNUSED(self), PyObject *args)
+/* a new reference to the plan for length n, creating it if needed */
+static npy_fft_plan *
+get_plan(npy_intp n, int real, int type_num)
 {
-    PyObject *op1, *op2;
-    PyArrayObject *data;
-    PyArray_Descr *descr;
-    double *wsave, *dptr;
-    npy_intp nsave;
-    int npts, nrepeats, i;
-
-    if(!PyArg_ParseTuple(args, "OO:cfftb", &op1, &op2)) {
-        return NULL;
+    npy_fft_plan *plan;
+    size_t nbytes;
+    int i;
+
+    for (i = 0; i < plan_cache_count; i++) {
+        plan = plan_cache[i];
+        if (plan->n == n && plan->real == real &&
+                plan->type_num == type_num) {
+            memmove(plan_cache + 1, plan_cache, i * sizeof(npy_fft_plan *));
+            plan_cache[0] = plan;
+            plan->refcount++;
+            return plan;
+        }
     }
-    data = (PyArrayObject *)PyArray_CopyFromObject(op1,
-            NPY_CDOUBLE, 1, 0);
-    if (data == NULL) {
-        return NULL;
+
+    Py_BEGIN_ALLOW_THREADS;
+    if (type_num == NPY_FLOAT) {
+        plan = npy_fft_plan_new_float(n, real);
     }
-    descr = PyArray_DescrFromType(NPY_DOUBLE);
-    if (PyArray_AsCArray(&op2, (void *)&wsave, &nsave, 1, descr) == -1) {
-        goto fail;
+    else {
+        plan = npy_fft_plan_new_double(n, real);
     }
-    if (data == NULL) {
-        goto fail;
+    Py_END_ALLOW_THREADS;
+    if (plan == NULL) {
+        PyErr_NoMemory();
+        return NULL;
     }
+    plan->refcount = 1;
+    plan->cached = 1;
 
-    npts = PyArray_DIM(data, PyArray_NDIM(data) - 1);
-    if (nsave != npts*4 + 15) {
-        PyErr_SetString(ErrorObject, "invalid work array for fft size");
-        goto fail;
+    /* insert in front, evicting the least recently used plans */
+    if (plan_cache_count == FFT_CACHE_SIZE) {
+        uncache_plan(plan_cache[--plan_cache_count]);
     }
-
-    nrepeats = PyArray_SIZE(data)/npts;
-    dptr = (double *)PyArray_DATA(data);
-    Py_BEGIN_ALLOW_THREADS;
-    NPY_SIGINT_ON;
-    for (i = 0; i < nrepeats; i++) {
-        npy_cfftb(npts, dptr, wsave);
-        dptr += npts*2;
+    memmove(plan_cache + 1, plan_cache,
+            plan_cache_count * sizeof(npy_fft_plan *));
+    plan_cache[0] = plan;
+    plan_cache_count++;
+    nbytes = plan->nbytes;
+    for (i = 1; i < plan_cache_count; i++) {
+        nbytes += plan_cache[i]->nbytes;
+        if (nbytes > FFT_CACHE_BYTES) {
+            break;
+        }
     }
-    NPY_SIGINT_OFF;
-    Py_END_ALLOW_THREADS;
-    PyArray_Free(op2, (char *)wsave);
-    return (PyObject *)data;
-
-fail:
-    PyArray_Free(op2, (char *)wsave);
-    Py_DECREF(data);
-    return NULL;
+    while (plan_cache_count > i) {
+        uncache_plan(plan_cache[--plan_cache_count]);
+    }
+    return plan;
 }
 
-static const char fftpack_cffti__doc__[] = "";
 
-static PyObject *
-fftpack_cffti(PyObject *NPY_UNUSED(self), PyObject *args)
+/*
+ * Rows that are not contiguous along the axis are transformed up to
+ * FFT_BLOCK at a time, so that neighbouring rows, e.g. the columns of a C
+ * ordered array transformed along axis 0, share the cache lines read and
+ * written. The row buffers of a block are kept below FFT_BLOCK_BYTES.
+ */
+#define FFT_BLOCK 8
+#define FFT_BLOCK_BYTES (4 * 1024 * 1024)
+
+/* rows of a batch of transforms along one axis */
+typedef struct {
+    const npy_fft_plan *plan;
+    int forward;
+    double fct;
+    char *in, *out;
+    npy_intp in_step, out_step, nin;
+    /* shape and strides of the other axes */
+    int ndim;
+    npy_intp shape[NPY_MAXDIMS];
+    npy_intp in_strides[NPY_MAXDIMS];
+    npy_intp out_strides[NPY_MAXDIMS];
+    npy_intp nbatch;
+    /* rows transformed together along the last of the other axes */
+    npy_intp block;
+    int failed;
+} fft_job;
+
+static void
+fft_batch(void *arg, int ithread, int nthreads)
 {
-    PyArrayObject *op;
-    npy_intp dim;
-    long n;
-
-    if (!PyArg_ParseTuple(args, "l:cffti", &n)) {
-        return NULL;
+    fft_job *job = (fft_job *)arg;
+    npy_intp start, end, i, idx, c, in_off, out_off, rows;
+    npy_intp in_dist = 0, out_dist = 0, inner = 1;
+    void *buf;
+    int d;
+
+    npy_parallel_range(job->nbatch, job->block, ithread, nthreads,
+                       &start, &end);
+    if (start >= end) {
+        return;
     }
-    /*Magic size needed by npy_cffti*/
-    dim = 4*n + 15;
-    /*Create a 1 dimensional array of dimensions of type double*/
-    op = (PyArrayObject *)PyArray_SimpleNew(1, &dim, NPY_DOUBLE);
-    if (op == NULL) {
-        return NULL;
+    buf = malloc(job->block * job->plan->bufsize);
+    if (buf == NULL) {
+        job->failed = 1;
+        return;
     }
-
-    Py_BEGIN_ALLOW_THREADS;
-    NPY_SIGINT_ON;
-    npy_cffti(n, (double *)PyArray_DATA((PyArrayObject*)op));
-    NPY_SIGINT_OFF;
-    Py_END_ALLOW_THREADS;
-
-    return (PyObject *)op;
+    if (job->ndim > 0) {
+        inner = job->shape[job->ndim - 1];
+        in_dist = job->in_strides[job->ndim - 1];
+        out_dist = job->out_strides[job->ndim - 1];
+    }
+    for (i = start; i < end; i += rows) {
+        /* stop the block at the end of the last axis */
+        rows = inner - i % inner;
+        if (rows > job->block) {
+            rows = job->block;
+        }
+        if (rows > end - i) {
+            rows = end - i;
+        }
+        in_off = out_off = 0;
+        for (d = job->ndim - 1, idx = i; d >= 0; d--) {
+            c = idx % job->shape[d];
+            idx /= job->shape[d];
+            in_off += c * job->in_strides[d];
+            out_off += c * job->out_strides[d];
+        }
+        if (job->plan->type_num == NPY_FLOAT) {
+            npy_fft_execute_float(job->plan, job->forward, job->fct, rows,
+                                  job->in + in_off, job->in_step, in_dist,
+                                  job->nin, job->out + out_off,
+                                  job->out_step, out_dist, buf);
+        }
+        else {
+            npy_fft_execute_double(job->plan, job->forward, job->fct, rows,
+                                   job->in + in_off, job->in_step, in_dist,
+                                   job->nin, job->out + out_off,
+                                   job->out_step, out_dist, buf);
+        }
+    }
+    free(buf);
 }
 
-static const char fftpack_rfftf__doc__[] = "";
+
+static const char fftpack_execute__doc__[] =
+    "execute(a, real, forward, n, axis, fct, nthreads, out=None)\n\n"
+    "Transform `a` along `axis`, zero padding or truncating it to `n`\n"
+    "points, and return the result times `fct`. Real forward transforms\n"
+    "produce n // 2 + 1 complex points, real backward transforms read\n"
+    "n // 2 + 1 complex points and produce n real ones. Arrays of single\n"
+    "precision, float32 or complex64, are transformed in single precision,\n"
+    "everything else in double precision. `out` may be `a` itself to\n"
+    "transform in place.";
 
 static PyObject *
-fftpack_rfftf(PyObject *NPY_UNUSED(self), PyObject *args)
+fftpack_execute(PyObject *NPY_UNUSED(self), PyObject *args)
 {
-    PyObject *op1, *op2;
-    PyArrayObject *data, *ret;
-    PyArray_Descr *descr;
-    double *wsave = NULL, *dptr, *rptr;
-    npy_intp nsave;
-    int npts, nrepeats, i, rstep;
-
-    if(!PyArg_ParseTuple(args, "OO:rfftf", &op1, &op2)) {
+    PyObject *op, *out_op = Py_None;
+    PyArrayObject *a = NULL, *out = NULL;
+    int real, forward, axis, nthreads, ndim, d, k;
+    int type_num, in_type, out_type;
+    npy_intp n, nout, dims[NPY_MAXDIMS];
+    double fct;
+    fft_job job;
+
+    if (!PyArg_ParseTuple(args, "Oiinidi|O:execute", &op, &real, &forward,
+                          &n, &axis, &fct, &nthreads, &out_op)) {
         return NULL;
     }
-    data = (PyArrayObject *)PyArray_ContiguousFromObject(op1,
-            NPY_DOUBLE, 1, 0);
-    if (data == NULL) {
-        return NULL;
+    type_num = NPY_DOUBLE;
+    if (PyArray_Check(op)) {
+        d = PyArray_TYPE((PyArrayObject *)op);
+        if (d == NPY_FLOAT || d == NPY_CFLOAT) {
+            type_num = NPY_FLOAT;
+        }
     }
-    /* FIXME, direct access changing contents of data->dimensions */
-    npts = PyArray_DIM(data, PyArray_NDIM(data) - 1);
-    PyArray_DIMS(data)[PyArray_NDIM(data) - 1] = npts/2 + 1;
-    ret = (PyArrayObject *)PyArray_Zeros(PyArray_NDIM(data),
-            PyArray_DIMS(data), PyArray_DescrFromType(NPY_CDOUBLE), 0);
-    if (ret == NULL) {
-        goto fail;
+    if (type_num == NPY_FLOAT) {
+        in_type = (real && forward) ? NPY_FLOAT : NPY_CFLOAT;
+        out_type = (real && !forward) ? NPY_FLOAT : NPY_CFLOAT;
+    }
+    else {
+        in_type = (real && forward) ? NPY_DOUBLE : NPY_CDOUBLE;
+        out_type = (real && !forward) ? NPY_DOUBLE : NPY_CDOUBLE;
     }
-    PyArray_DIMS(data)[PyArray_NDIM(data) - 1] = npts;
-    rstep = PyArray_DIM(ret, PyArray_NDIM(ret) - 1)*2;
 
-    descr = PyArray_DescrFromType(NPY_DOUBLE);
-    if (PyArray_AsCArray(&op2, (void *)&wsave, &nsave, 1, descr) == -1) {
-        goto fail;
+    a = (PyArrayObject *)PyArray_FromAny(op, PyArray_DescrFromType(in_type),
+                                         1, 0, NPY_ARRAY_ALIGNED |
+                                         NPY_ARRAY_FORCECAST, NULL);
+    if (a == NULL) {
+        return NULL;
     }
-    if (data == NULL || ret == NULL) {
+    ndim = PyArray_NDIM(a);
+    if (n < 1 || axis < 0 || axis >= ndim) {
+        PyErr_SetString(PyExc_ValueError, "invalid transform length or axis");
         goto fail;
     }
-    if (nsave != npts*2+15) {
-        PyErr_SetString(ErrorObject, "invalid work array for fft size");
-        goto fail;
+    nout = (real && forward) ? n / 2 + 1 : n;
+    memcpy(dims, PyArray_DIMS(a), ndim * sizeof(npy_intp));
+    dims[axis] = nout;
+
+    if (out_op == Py_None) {
+        out = (PyArrayObject *)PyArray_SimpleNew(ndim, dims, out_type);
+        if (out == NULL) {
+            goto fail;
+        }
     }
-
-    nrepeats = PyArray_SIZE(data)/npts;
-    rptr = (double *)PyArray_DATA(ret);
-    dptr = (double *)PyArray_DATA(data);
-
-    Py_BEGIN_ALLOW_THREADS;
-    NPY_SIGINT_ON;
-    for (i = 0; i < nrepeats; i++) {
-        memcpy((char *)(rptr+1), dptr, npts*sizeof(double));
-        npy_rfftf(npts, rptr+1, wsave);
-        rptr[0] = rptr[1];
-        rptr[1] = 0.0;
-        rptr += rstep;
-        dptr += npts;
+    else {
+        if (!PyArray_Check(out_op) ||
+                PyArray_TYPE((PyArrayObject *)out_op) != out_type ||
+                !PyArray_ISBEHAVED((PyArrayObject *)out_op) ||
+                !PyArray_CompareLists(PyArray_DIMS((PyArrayObject *)out_op),
+                                      dims, ndim)) {
+            PyErr_SetString(PyExc_ValueError, "invalid output array");
+            goto fail;
+        }
+        out = (PyArrayObject *)out_op;
+        Py_INCREF(out);
     }
-    NPY_SIGINT_OFF;
-    Py_END_ALLOW_THREADS;
-    PyArray_Free(op2, (char *)wsave);
-    Py_DECREF(data);
-    return (PyObject *)ret;
-
-fail:
-    PyArray_Free(op2, (char *)wsave);
-    Py_XDECREF(data);
-    Py_XDECREF(ret);
-    return NULL;
-}
-
-static const char fftpack_rfftb__doc__[] = "";
-
-static PyObject *
-fftpack_rfftb(PyObject *NPY_UNUSED(self), PyObject *args)
-{
-    PyObject *op1, *op2;
-    PyArrayObject *data, *ret;
-    PyArray_Descr *descr;
-    double *wsave, *dptr, *rptr;
-    npy_intp nsave;
-    int npts, nrepeats, i;
-
-    if(!PyArg_ParseTuple(args, "OO:rfftb", &op1, &op2)) {
-        return NULL;
+    if (PyArray_SIZE(out) == 0) {
+        Py_DECREF(a);
+        return (PyObject *)out;
     }
-    data = (PyArrayObject *)PyArray_ContiguousFromObject(op1,
-            NPY_CDOUBLE, 1, 0);
-    if (data == NULL) {
-        return NULL;
+
+    job.forward = forward;
+    job.fct = fct;
+    job.in = PyArray_DATA(a);
+    job.out = PyArray_DATA(out);
+    job.in_step = PyArray_STRIDE(a, axis);
+    job.out_step = PyArray_STRIDE(out, axis);
+    job.nin = PyArray_DIM(a, axis);
+    job.ndim = ndim - 1;
+    job.nbatch = 1;
+    job.failed = 0;
+    for (d = 0, k = 0; d < ndim; d++) {
+        if (d != axis) {
+            job.shape[k] = PyArray_DIM(a, d);
+            job.in_strides[k] = PyArray_STRIDE(a, d);
+            job.out_strides[k] = PyArray_STRIDE(out, d);
+            job.nbatch *= job.shape[k];
+            k++;
+        }
     }
-    npts = PyArray_DIM(data, PyArray_NDIM(data) - 1);
-    ret = (PyArrayObject *)PyArray_Zeros(PyArray_NDIM(data), PyArray_DIMS(data),
-            PyArray_DescrFromType(NPY_DOUBLE), 0);
 
-    descr = PyArray_DescrFromType(NPY_DOUBLE);
-    if (PyArray_AsCArray(&op2, (void *)&wsave, &nsave, 1, descr) == -1) {
+    if (nthreads != npy_get_num_threads() &&
+            npy_set_num_threads(nthreads) < 0) {
         goto fail;
     }
-    if (data == NULL || ret == NULL) {
+    job.plan = get_plan(n, real, type_num);
+    if (job.plan == NULL) {
         goto fail;
     }
-    if (nsave != npts*2 + 15) {
-        PyErr_SetString(ErrorObject, "invalid work array for fft size");
-        goto fail;
+    job.block = 1;
+    if (job.ndim > 0 &&
+            (job.in_step != PyArray_ITEMSIZE(a) ||
+             job.out_step != PyArray_ITEMSIZE(out))) {
+        job.block = FFT_BLOCK_BYTES / job.plan->bufsize;
+        if (job.block > FFT_BLOCK) {
+            job.block = FFT_BLOCK;
+        }
+        else if (job.block < 1) {
+            job.block = 1;
+        }
     }
-
-    nrepeats = PyArray_SIZE(ret)/npts;
-    rptr = (double *)PyArray_DATA(ret);
-    dptr = (double *)PyArray_DATA(data);
-
-    Py_BEGIN_ALLOW_THREADS;
-    NPY_SIGINT_ON;
-    for (i = 0; i < nrepeats; i++) {
-        memcpy((char *)(rptr + 1), (dptr + 2), (npts - 1)*sizeof(double));
-        rptr[0] = dptr[0];
-        npy_rfftb(npts, rptr, wsave);
-        rptr += npts;
-        dptr += npts*2;
+    nthreads = npy_parallel_threads(job.nbatch * n);
+    if (nthreads > job.nbatch) {
+        nthreads = (int)job.nbatch;
     }
-    NPY_SIGINT_OFF;
+    Py_BEGIN_ALLOW_THREADS;
+    npy_parallel_run(nthreads, &fft_batch, &job);
     Py_END_ALLOW_THREADS;
-    PyArray_Free(op2, (char *)wsave);
-    Py_DECREF(data);
-    return (PyObject *)ret;
+    release_plan((npy_fft_plan *)job.plan);
+    if (job.failed) {
+        PyErr_NoMemory();
+        goto fail;
+    }
+    Py_DECREF(a);
+    return (PyObject *)out;
 
 fail:
-    PyArray_Free(op2, (char *)wsave);
-    Py_XDECREF(data);
-    Py_XDECREF(ret);
+    Py_XDECREF(a);
+    Py_XDECREF(out);
     return NULL;
 }
 
-static const char fftpack_rffti__doc__[] = "";
-
-static PyObject *
-fftpack_rffti(PyObject *NPY_UNUSED(self), PyObject *args)
-{
-  PyArrayObject *op;
-  npy_intp dim;
-  long n;
-
-  if (!PyArg_ParseTuple(args, "l:rffti", &n)) {
-      return NULL;
-  }
-  /*Magic size needed by npy_rffti*/
-  dim = 2*n + 15;
-  /*Create a 1 dimensional array of dimensions of type double*/
-  op = (PyArrayObject *)PyArray_SimpleNew(1, &dim, NPY_DOUBLE);
-  if (op == NULL) {
-      return NULL;
-  }
-  Py_BEGIN_ALLOW_THREADS;
-  NPY_SIGINT_ON;
-  npy_rffti(n, (double *)PyArray_DATA((PyArrayObject*)op));
-  NPY_SIGINT_OFF;
-  Py_END_ALLOW_THREADS;
-
-  return (PyObject *)op;
-}
-
 
 /* List of methods defined in the module */
 
 static struct PyMethodDef fftpack_methods[] = {
-    {"cfftf",   fftpack_cfftf,  1,      fftpack_cfftf__doc__},
-    {"cfftb",   fftpack_cfftb,  1,      fftpack_cfftb__doc__},
-    {"cffti",   fftpack_cffti,  1,      fftpack_cffti__doc__},
-    {"rfftf",   fftpack_rfftf,  1,      fftpack_rfftf__doc__},
-    {"rfftb",   fftpack_rfftb,  1,      fftpack_rfftb__doc__},
-    {"rffti",   fftpack_rffti,  1,      fftpack_rffti__doc__},
+    {"execute", fftpack_execute, METH_VARARGS, fftpack_execute__doc__},
     {NULL, NULL, 0, NULL}          /* sentinel */
 };
 
@@ -338,7 +348,7 @@ PyMODINIT_FUNC
 initfftpack_lite(void)
 #endif
 {
-    PyObject *m,*d;
+    PyObject *m;
 #if PY_MAJOR_VERSION >= 3
     m = PyModule_Create(&moduledef);
 #else
@@ -348,16 +358,19 @@ initfftpack_lite(void)
             fftpack_module_documentation,
             (PyObject*)NULL,PYTHON_API_VERSION);
 #endif
+    if (m == NULL) {
+        return RETVAL;
+    }
 
     /* Import the array object */
     import_array();
 
-    /* Add some symbolic constants to the module */
-    d = PyModule_GetDict(m);
-    ErrorObject = PyErr_NewException("fftpack.error", NULL, NULL);
-    PyDict_SetItemString(d, "error", ErrorObject);
-
-    /* XXXX Add constants here */
-
+    /* Select the simd passes for this cpu */
+    if (npy_cpu_init() < 0) {
+#if PY_MAJOR_VERSION >= 3
+        Py_DECREF(m);
+        m = NULL;
+#endif
+    }
     return RETVAL;
 }
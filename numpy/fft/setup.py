@@ -1,5 +1,7 @@
 from __future__ import division, print_function
 
+from os.path import join
+
 
 def configuration(parent_package='',top_path=None):
     from numpy.distutils.misc_util import Configuration
@@ -7,9 +9,17 @@ def configuration(parent_package='',top_path=None):
 
     config.add_data_dir('tests')
 
-    # Configure fftpack_lite
+    # Configure fftpack_lite, with its own copy of the cpu feature
+    # detection and the thread pool of numpy.core
+    private_dir = join('..', 'core', 'src', 'private')
     config.add_extension('fftpack_lite',
-                         sources=['fftpack_litemodule.c', 'fftpack.c']
+                         sources=['fftpack_litemodule.c', 'fftengine.c.src',
+                                  join(private_dir, 'npy_cpu_features.c'),
+                                  join(private_dir, 'npy_threadpool.c')],
+                         depends=['fftengine.h',
+                                  join(private_dir, 'npy_cpu_features.h'),
+                                  join(private_dir, 'npy_threadpool.h')],
+                         libraries=['npymath'],
                          )
 
     return config
@@ -3,7 +3,7 @@ from __future__ import division, absolute_import, print_function
 import numpy as np
 from numpy.random import random
 from numpy.testing import TestCase, run_module_suite, assert_array_almost_equal
-from numpy.testing import assert_array_equal
+from numpy.testing import assert_array_equal, assert_
 import threading
 import sys
 if sys.version_info[0] >= 3:
@@ -145,6 +145,90 @@ class TestFFT1D(TestCase):
                     assert_array_almost_equal(x_norm,
                                               np.linalg.norm(tmp))
 
+    def test_lengths(self):
+        # every kind of pass, including generic odd radices and the
+        # Bluestein algorithm for lengths with large prime factors
+        for n in [1, 2, 3, 5, 7, 8, 12, 16, 45, 49, 64, 97, 121, 210, 243,
+                  2 * 101, 1009]:
+            x = random(n) + 1j*random(n)
+            assert_array_almost_equal(fft1(x), np.fft.fft(x))
+            assert_array_almost_equal(x, np.fft.ifft(np.fft.fft(x)))
+            assert_array_almost_equal(fft1(x.real)[:n // 2 + 1],
+                                      np.fft.rfft(x.real))
+            assert_array_almost_equal(x.real, np.fft.irfft(np.fft.rfft(x.real),
+                                                           n))
+
+    def test_pad_truncate(self):
+        x = random(20) + 1j*random(20)
+        y = np.concatenate((x, np.zeros(12)))
+        assert_array_almost_equal(np.fft.fft(y), np.fft.fft(x, 32))
+        assert_array_almost_equal(np.fft.fft(x[:13]), np.fft.fft(x, 13))
+        assert_array_almost_equal(np.fft.rfft(y.real), np.fft.rfft(x.real, 32))
+        assert_array_almost_equal(np.fft.irfft(x[:7], 12),
+                                  np.fft.irfft(x, 12))
+
+    def test_strided_axis(self):
+        x = random((12, 30, 6)) + 1j*random((12, 30, 6))
+        for a in [x, x[::2, ::-3, 1::2], x.transpose(2, 0, 1)]:
+            for axis in range(a.ndim):
+                expect = np.fft.fft(np.ascontiguousarray(a), axis=axis)
+                assert_array_almost_equal(expect, np.fft.fft(a, axis=axis))
+                assert_array_almost_equal(
+                    np.fft.rfft(np.ascontiguousarray(a.real), axis=axis),
+                    np.fft.rfft(a.real, axis=axis))
+
+    def test_blocked_columns(self):
+        # columns of a C ordered array are transformed several at a time,
+        # including a partial block at the end of each row
+        x = random((3, 40, 13)) + 1j*random((3, 40, 13))
+        for a in [x, x[:, :, ::-1], x.astype(np.complex64)]:
+            c = np.ascontiguousarray(a.transpose(0, 2, 1))
+            dec = 4 if a.dtype == np.complex64 else 6
+            assert_array_almost_equal(np.fft.fft(c).transpose(0, 2, 1),
+                                      np.fft.fft(a, axis=1), dec)
+            assert_array_almost_equal(np.fft.ifft(c, 50).transpose(0, 2, 1),
+                                      np.fft.ifft(a, 50, axis=1), dec)
+            assert_array_almost_equal(
+                np.fft.rfft(c.real).transpose(0, 2, 1),
+                np.fft.rfft(a.real, axis=1), dec)
+            assert_array_almost_equal(
+                np.fft.irfft(c, 30).transpose(0, 2, 1),
+                np.fft.irfft(a, 30, axis=1), dec)
+
+    def test_threads(self):
+        x = random((64, 100)) + 1j*random((64, 100))
+        expect = np.fft.fft(x, axis=0)
+        old = np.getthreads()
+        try:
+            for n in [1, 2, 5]:
+                np.setthreads(n)
+                assert_array_equal(expect, np.fft.fft(x, axis=0))
+                assert_array_almost_equal(x, np.fft.ifft(expect, axis=0))
+        finally:
+            np.setthreads(old)
+
+    def test_single_precision(self):
+        # float32 and complex64 are transformed without upcasting
+        for n in [8, 30, 97, 1024]:
+            x = random(n) + 1j*random(n)
+            xs = x.astype(np.complex64)
+            y = np.fft.fft(xs)
+            assert_(y.dtype == np.complex64)
+            assert_array_almost_equal(np.fft.fft(xs.astype(complex)), y, 3)
+            assert_array_almost_equal(xs, np.fft.ifft(y), 5)
+            r = xs.real
+            y = np.fft.rfft(r)
+            assert_(y.dtype == np.complex64)
+            assert_array_almost_equal(np.fft.rfft(r.astype(float)), y, 3)
+            z = np.fft.irfft(y, n)
+            assert_(z.dtype == np.float32)
+            assert_array_almost_equal(r, z, 5)
+        x = random((6, 10, 12)).astype(np.float32)
+        assert_(np.fft.fftn(x).dtype == np.complex64)
+        assert_(np.fft.irfftn(np.fft.rfftn(x), x.shape).dtype == np.float32)
+        assert_array_almost_equal(np.fft.fftn(x.astype(float)),
+                                  np.fft.fftn(x), 3)
+
 class TestFFTThreadSafe(TestCase):
     threads = 16
     input_shape = (800, 200)
@@ -1,5 +1,5 @@
 """
-Set operations for arrays based on sorting.
+Set operations for arrays based on sorting or hashing.
 
 :Contains:
   unique,
@@ -28,6 +28,7 @@ To do: Optionally return indices analogously to unique for all functions.
 from __future__ import division, absolute_import, print_function
 
 import numpy as np
+from numpy.core.multiarray import _unique_hash, _in1d_hash
 
 
 __all__ = [
@@ -110,8 +111,20 @@ def ediff1d(ary, to_end=None, to_begin=None):
     return result
 
 
+def _hashable(dtype):
+    """
+    Whether items of `dtype` are equal exactly when their bytes are, so
+    that the hash based set operations can be used.
+    """
+    if dtype.char in np.typecodes['AllInteger'] + np.typecodes['Datetime']:
+        return True
+    if dtype.char in 'SU':
+        return True
+    return dtype.char == 'V' and dtype.names is None and dtype.subdtype is None
+
+
 def unique(ar, return_index=False, return_inverse=False,
-           return_counts=False, axis=None):
+           return_counts=False, axis=None, method='sort'):
     """
     Find the unique elements of an array.
 
@@ -143,13 +156,19 @@ def unique(ar, return_index=False, return_inverse=False,
         Object arrays or structured arrays that contain objects are not
         supported if the `axis` kwarg is used.
         .. versionadded:: 1.13.0
-
-
+    method : {'sort', 'hash'}, optional
+        With the default 'sort', the input is sorted to find the unique
+        values, which are returned in sorted order. 'hash' uses a hash
+        table instead, which is faster for large inputs and returns the
+        unique values in order of first appearance. It supports integer,
+        datetime, string and unstructured void types, and with `axis` the
+        types that are compared as raw bytes.
+        .. versionadded:: 1.13.0
 
     Returns
     -------
     unique : ndarray
-        The sorted unique values.
+        The unique values, sorted unless `method` is 'hash'.
     unique_indices : ndarray, optional
         The indices of the first occurrences of the unique values in the
         original array. Only provided if `return_index` is True.
@@ -204,10 +223,18 @@ def unique(ar, return_index=False, return_inverse=False,
     >>> u[indices]
     array([1, 2, 6, 4, 2, 3, 2])
 
+    Find the unique values in order of appearance with a hash table:
+
+    >>> np.unique([3, 1, 3, 2, 1], method='hash')
+    array([3, 1, 2])
+
     """
+    if method not in ('sort', 'hash'):
+        raise ValueError("method must be 'sort' or 'hash', got %r" % (method,))
     ar = np.asanyarray(ar)
     if axis is None:
-        return _unique1d(ar, return_index, return_inverse, return_counts)
+        return _unique1d(ar, return_index, return_inverse, return_counts,
+                         method)
     if not (-ar.ndim <= axis < ar.ndim):
         raise ValueError('Invalid axis kwarg specified for unique')
 
@@ -232,6 +259,9 @@ def unique(ar, return_index=False, return_inverse=False,
         # There's no good way to do this for object arrays, etc...
         msg = 'The axis argument to unique is not supported for dtype {dt}'
         raise TypeError(msg.format(dt=ar.dtype))
+    if method == 'hash' and not _hashable(consolidated.dtype):
+        raise TypeError("method='hash' with an axis is not supported for "
+                        "dtype %s" % (orig_dtype,))
 
     def reshape_uniq(uniq):
         uniq = uniq.view(orig_dtype)
@@ -240,7 +270,7 @@ def unique(ar, return_index=False, return_inverse=False,
         return uniq
 
     output = _unique1d(consolidated, return_index,
-                       return_inverse, return_counts)
+                       return_inverse, return_counts, method)
     if not (return_index or return_inverse or return_counts):
         return reshape_uniq(output)
     else:
@@ -248,10 +278,28 @@ def unique(ar, return_index=False, return_inverse=False,
         return (uniq,) + output[1:]
 
 def _unique1d(ar, return_index=False, return_inverse=False,
-              return_counts=False):
+              return_counts=False, method='sort'):
     """
     Find the unique elements of an array, ignoring shape.
     """
+    if method == 'hash':
+        ar = np.asanyarray(ar).ravel()
+        if not _hashable(ar.dtype):
+            raise TypeError("method='hash' is not supported for dtype %s"
+                            % (ar.dtype,))
+        first, inv_idx, counts = _unique_hash(ar, return_inverse,
+                                              return_counts)
+        if not (return_index or return_inverse or return_counts):
+            return ar[first]
+        ret = (ar[first],)
+        if return_index:
+            ret += (first,)
+        if return_inverse:
+            ret += (inv_idx,)
+        if return_counts:
+            ret += (counts,)
+        return ret
+
     ar = np.asanyarray(ar).flatten()
 
     optional_indices = return_index or return_inverse
@@ -329,6 +377,18 @@ def intersect1d(ar1, ar2, assume_unique=False):
     >>> reduce(np.intersect1d, ([1, 3, 4, 3], [3, 1, 2, 1], [6, 3, 4, 2]))
     array([3])
     """
+    ar1 = np.asanyarray(ar1).ravel()
+    ar2 = np.asanyarray(ar2).ravel()
+    dtype = np.result_type(ar1, ar2)
+    if _hashable(dtype):
+        # only the intersection needs sorting
+        ar1 = ar1.astype(dtype, copy=False)
+        if not assume_unique:
+            ar1 = unique(ar1, method='hash')
+        aux = ar1[in1d(ar1, ar2, method='hash')]
+        aux.sort()
+        return aux
+
     if not assume_unique:
         # Might be faster than unique( intersect1d( ar1, ar2 ) )?
         ar1 = unique(ar1)
@@ -382,7 +442,7 @@ def setxor1d(ar1, ar2, assume_unique=False):
     return aux[flag2]
 
 
-def in1d(ar1, ar2, assume_unique=False, invert=False):
+def in1d(ar1, ar2, assume_unique=False, invert=False, method=None):
     """
     Test whether each element of a 1-D array is also present in a second array.
 
@@ -407,6 +467,13 @@ def in1d(ar1, ar2, assume_unique=False, invert=False):
         to (but is faster than) ``np.invert(in1d(a, b))``.
 
         .. versionadded:: 1.8.0
+    method : {None, 'sort', 'hash'}, optional
+        Whether to find the common values by sorting both arrays or with a
+        hash table of the values of `ar2`. The default None uses the hash
+        table for integer, datetime, string and unstructured void types,
+        and sorting otherwise. The result is the same.
+
+        .. versionadded:: 1.13.0
 
     Returns
     -------
@@ -447,10 +514,21 @@ def in1d(ar1, ar2, assume_unique=False, invert=False):
     >>> test[mask]
     array([1, 5])
     """
+    if method not in (None, 'sort', 'hash'):
+        raise ValueError("method must be None, 'sort' or 'hash', got %r"
+                         % (method,))
     # Ravel both arrays, behavior for the first array could be different
     ar1 = np.asarray(ar1).ravel()
     ar2 = np.asarray(ar2).ravel()
 
+    if method == 'hash':
+        dtype = np.result_type(ar1, ar2)
+        if not _hashable(dtype):
+            raise TypeError("method='hash' is not supported for dtype %s"
+                            % (dtype,))
+        return _in1d_hash(ar1.astype(dtype, copy=False),
+                          ar2.astype(dtype, copy=False), invert)
+
     # This code is significantly faster when the condition is satisfied.
     if len(ar2) < 10 * len(ar1) ** 0.145:
         if invert:
@@ -463,6 +541,9 @@ def in1d(ar1, ar2, assume_unique=False, invert=False):
                 mask |= (ar1 == a)
         return mask
 
+    if method is None and _hashable(np.result_type(ar1, ar2)):
+        return in1d(ar1, ar2, invert=invert, method='hash')
+
     # Otherwise use sorting
     if not assume_unique:
         ar1, rev_idx = np.unique(ar1, return_inverse=True)
@@ -649,6 +730,12 @@ def setdiff1d(ar1, ar2, assume_unique=False):
     """
     if assume_unique:
         ar1 = np.asarray(ar1).ravel()
+    elif _hashable(np.asarray(ar1).dtype):
+        # only the difference needs sorting
+        ar1 = unique(ar1, method='hash')
+        aux = ar1[in1d(ar1, ar2, invert=True)]
+        aux.sort()
+        return aux
     else:
         ar1 = unique(ar1)
         ar2 = unique(ar2)
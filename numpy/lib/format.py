@@ -141,6 +141,30 @@ The description of the fourth element of the header therefore has become:
 "The next 4 bytes form a little-endian unsigned int: the length of the header
 data HEADER_LEN."
 
+Format Version 3.0
+------------------
+
+The version 3.0 format stores the array data compressed, in chunks that can
+be compressed and decompressed independently, on several threads, and so
+that a part of the array can be read without decompressing the rest.  The
+header has the 4 byte length of version 2.0 and three more keys:
+
+    "compression" : str
+      The codec of the chunks. ``'zlib'`` is the zlib format of the data
+      bytes, ``'shuffle-zlib'`` the zlib format of the bytes reordered so
+      that the first bytes of all elements come first, then all the second
+      bytes and so on, which often compresses numeric data better.
+    "chunksize" : int
+      The number of elements in each chunk, except for the last one.
+    "chunks" : list of int
+      The compressed size of each chunk in bytes.
+
+The chunks follow the header, one after the other.  Their uncompressed
+data is that of the version 1.0 format, split into pieces of "chunksize"
+elements.  Arrays that contain Python objects cannot be stored in this
+format, and it cannot be memory-mapped.  It is only written when asked
+for, with the `compression` argument of `write_array`.
+
 Notes
 -----
 The ``.npy`` format, including reasons for creating it and a comparison of
@@ -151,8 +175,11 @@ from __future__ import division, absolute_import, print_function
 
 import numpy
 import sys
+import os
 import io
+import errno
 import warnings
+import weakref
 from numpy.lib.utils import safe_eval
 from numpy.compat import asbytes, asstr, isfileobj, long, basestring
 
@@ -164,13 +191,18 @@ else:
 MAGIC_PREFIX = b'\x93NUMPY'
 MAGIC_LEN = len(MAGIC_PREFIX) + 2
 BUFFER_SIZE = 2**18  # size of buffer for reading npz files in bytes
+CHUNK_SIZE = 2**20  # default size of the chunks of version 3.0 in bytes
+DIRECT_ALIGNMENT = 4096  # alignment of the reads of read_array(direct=True)
+COMPRESSIONS = ('zlib', 'shuffle-zlib')
 
 # difference between version 1.0 and 2.0 is a 4 byte (I) header length
-# instead of 2 bytes (H) allowing storage of large structured arrays
+# instead of 2 bytes (H) allowing storage of large structured arrays.
+# version 3.0 has the header of 2.0 with a chunk index, followed by the
+# compressed chunks
 
 def _check_version(version):
-    if version not in [(1, 0), (2, 0), None]:
-        msg = "we only support format version (1,0) and (2, 0), not %s"
+    if version not in [(1, 0), (2, 0), (3, 0), None]:
+        msg = "we only support format version (1,0), (2, 0) and (3, 0), not %s"
         raise ValueError(msg % (version,))
 
 def magic(major, minor):
@@ -320,6 +352,8 @@ def _write_array_header(fp, d, version=None):
     elif hlen < 2**32 and version in (None, (2, 0)):
         version = (2, 0)
         header_prefix = magic(2, 0) + struct.pack('<I', hlen)
+    elif hlen < 2**32 and version == (3, 0):
+        header_prefix = magic(3, 0) + struct.pack('<I', hlen)
     else:
         msg = "Header length %s too big for version=%s"
         msg %= (hlen, version)
@@ -464,6 +498,14 @@ def _read_array_header(fp, version):
     """
     see read_array_header_1_0
     """
+    d, dtype = _read_header(fp, version)
+    return d['shape'], d['fortran_order'], dtype
+
+
+def _read_header(fp, version):
+    """
+    Read and check the header dictionary, returns it and the dtype.
+    """
     # Read an unsigned, little-endian short int which has the length of the
     # header.
     import struct
@@ -471,7 +513,7 @@ def _read_array_header(fp, version):
         hlength_str = _read_bytes(fp, 2, "array header length")
         header_length = struct.unpack('<H', hlength_str)[0]
         header = _read_bytes(fp, header_length, "array header")
-    elif version == (2, 0):
+    elif version in ((2, 0), (3, 0)):
         hlength_str = _read_bytes(fp, 4, "array header length")
         header_length = struct.unpack('<I', hlength_str)[0]
         header = _read_bytes(fp, header_length, "array header")
@@ -494,7 +536,12 @@ def _read_array_header(fp, version):
         msg = "Header is not a dictionary: %r"
         raise ValueError(msg % d)
     keys = sorted(d.keys())
-    if keys != ['descr', 'fortran_order', 'shape']:
+    if version == (3, 0):
+        expected = ['chunks', 'chunksize', 'compression', 'descr',
+                    'fortran_order', 'shape']
+    else:
+        expected = ['descr', 'fortran_order', 'shape']
+    if keys != expected:
         msg = "Header does not contain the correct keys: %r"
         raise ValueError(msg % (keys,))
 
@@ -512,9 +559,451 @@ def _read_array_header(fp, version):
         msg = "descr is not a valid dtype descriptor: %r"
         raise ValueError(msg % (d['descr'],))
 
-    return d['shape'], d['fortran_order'], dtype
+    if version == (3, 0):
+        if dtype.hasobject:
+            msg = "Object arrays cannot be stored in format 3.0: %r"
+            raise ValueError(msg % (d['descr'],))
+        if d['compression'] not in COMPRESSIONS:
+            msg = "compression is not supported: %r"
+            raise ValueError(msg % (d['compression'],))
+        if not isinstance(d['chunksize'], (int, long)) or d['chunksize'] < 1:
+            msg = "chunksize is not valid: %r"
+            raise ValueError(msg % (d['chunksize'],))
+        count = _count(d['shape'])
+        nchunks = -(-count // d['chunksize']) if dtype.itemsize else 0
+        if (not isinstance(d['chunks'], list) or
+                len(d['chunks']) != nchunks or
+                not all([isinstance(x, (int, long)) and x >= 0
+                         for x in d['chunks']])):
+            msg = "chunks is not a valid chunk index for %d chunks"
+            raise ValueError(msg % (nchunks,))
+    return d, dtype
+
+
+def _count(shape):
+    """ The number of elements of an array of the given shape. """
+    count = 1
+    for n in shape:
+        count *= n
+    return count
+
+
+def _cpu_count():
+    try:
+        import multiprocessing
+        return multiprocessing.cpu_count()
+    except (ImportError, NotImplementedError):
+        return 1
+
+
+def _map_threads(func, items, threads=None):
+    """
+    Return ``[func(x) for x in items]``, evaluated on up to `threads`
+    threads, by default as many as there are CPUs.  Calls that release the
+    GIL, such as those of zlib, run in parallel.
+    """
+    import threading
+    items = list(items)
+    if threads is None:
+        threads = _cpu_count()
+    threads = min(threads, len(items))
+    if threads <= 1:
+        return [func(x) for x in items]
+
+    results = [None] * len(items)
+    errors = []
+    todo = iter(range(len(items)))
+    lock = threading.Lock()
+
+    def worker():
+        while not errors:
+            with lock:
+                i = next(todo, None)
+            if i is None:
+                return
+            try:
+                results[i] = func(items[i])
+            except BaseException as e:
+                errors.append(e)
+
+    workers = [threading.Thread(target=worker) for _ in range(threads)]
+    for t in workers:
+        t.start()
+    for t in workers:
+        t.join()
+    if errors:
+        raise errors[0]
+    return results
+
+
+def _compress_chunk(data, compression):
+    """ Compress the contiguous 1-d array `data`. """
+    import zlib
+    itemsize = data.itemsize
+    data = data.view(numpy.uint8)
+    if compression == 'shuffle-zlib':
+        data = data.reshape(-1, itemsize).T.copy()
+    return zlib.compress(data)
+
+
+def _decompress_chunk(chunk, out, compression):
+    """ Decompress `chunk` into the contiguous 1-d array `out`. """
+    import zlib
+    itemsize = out.itemsize
+    out = out.view(numpy.uint8)
+    try:
+        data = zlib.decompress(chunk)
+    except zlib.error as e:
+        raise ValueError("compressed array data is invalid: %s" % (e,))
+    if len(data) != out.size:
+        msg = "compressed array data has %d bytes, expected %d"
+        raise ValueError(msg % (len(data), out.size))
+    data = numpy.frombuffer(data, dtype=numpy.uint8)
+    if compression == 'shuffle-zlib':
+        data = data.reshape(itemsize, -1).T
+        out = out.reshape(-1, itemsize)
+    out[...] = data
+
+
+def _row_range(index, n):
+    """
+    The rows ``lo:hi`` of the first axis that `index` selects and the index
+    that selects the same elements from those rows, or None if the first
+    element of `index` is not an integer, a slice or an integer array.
+    """
+    if isinstance(index, tuple):
+        if len(index) == 0:
+            return None
+        first, rest = index[0], index[1:]
+    else:
+        first, rest = index, ()
+
+    if isinstance(first, slice):
+        start, stop, step = first.indices(n)
+        if step > 0:
+            length = max(0, (stop - start + step - 1) // step)
+        else:
+            length = max(0, (start - stop - step - 1) // -step)
+        if length == 0:
+            return 0, 0, (slice(0, 0),) + rest
+        last = start + (length - 1) * step
+        lo, hi = min(start, last), max(start, last) + 1
+        stop = last - lo + step
+        sl = slice(start - lo, stop if stop >= 0 else None, step)
+        return lo, hi, (sl,) + rest
+    if isinstance(first, bool):
+        return None
+    if isinstance(first, (int, long, numpy.integer)):
+        i = int(first)
+        if i < 0:
+            i += n
+        if not 0 <= i < n:
+            msg = "index %d is out of bounds for axis 0 with size %d"
+            raise IndexError(msg % (first, n))
+        return i, i + 1, (0,) + rest
+    if first is None or first is Ellipsis:
+        return None
+    first = numpy.asarray(first)
+    if first.dtype.kind not in 'iu':
+        return None
+    if first.size == 0:
+        return 0, 0, (first,) + rest
+    first = numpy.where(first < 0, first + n, first)
+    lo, hi = int(first.min()), int(first.max()) + 1
+    if lo < 0 or hi > n:
+        msg = "index %d is out of bounds for axis 0 with size %d"
+        raise IndexError(msg % (hi - 1 if hi > n else lo - n, n))
+    return lo, hi, (first - lo,) + rest
+
+
+def _skip_bytes(fp, size):
+    """ Move forward by size bytes, seeking where possible. """
+    if size == 0:
+        return
+    try:
+        fp.seek(size, 1)
+        return
+    except (AttributeError, IOError, ValueError, io.UnsupportedOperation):
+        pass
+    while size > 0:
+        n = min(size, BUFFER_SIZE)
+        _read_bytes(fp, n, "array data")
+        size -= n
+
+
+def _write_compressed(fp, array, d, compression, chunksize, threads):
+    """ Write the header and data of the version 3.0 format. """
+    if compression not in COMPRESSIONS:
+        msg = "compression must be one of %s, not %r"
+        raise ValueError(msg % (', '.join(COMPRESSIONS), compression))
+    if array.dtype.hasobject:
+        raise ValueError("Object arrays cannot be saved compressed")
+    itemsize = array.dtype.itemsize
+    if chunksize is None:
+        chunksize = max(CHUNK_SIZE // max(itemsize, 1), 1)
+    elif chunksize < 1:
+        raise ValueError("chunksize must be positive")
+    chunksize = int(chunksize)
+
+    data = numpy.asarray(array).ravel(order='F' if d['fortran_order'] else 'C')
+    if itemsize == 0:
+        starts = []
+    else:
+        starts = range(0, data.size, chunksize)
+    chunks = _map_threads(
+        lambda i: _compress_chunk(data[i:i + chunksize], compression),
+        starts, threads)
+
+    d['compression'] = compression
+    d['chunksize'] = chunksize
+    d['chunks'] = [len(c) for c in chunks]
+    _write_array_header(fp, d, (3, 0))
+    for c in chunks:
+        fp.write(c)
+
+
+def _read_compressed(fp, d, dtype, index, threads, out=None):
+    """
+    Read the data of the version 3.0 format, only the chunks needed for
+    `index` if it is not None, into `out` if it is not None.
+    """
+    shape = d['shape']
+    fortran_order = d['fortran_order']
+    chunksize = d['chunksize']
+    sizes = d['chunks']
+    count = _count(shape)
+
+    # the range lo:hi of the elements in storage order to decompress
+    lo, hi = 0, count
+    if index is not None and not fortran_order and len(shape) > 0:
+        rows = _row_range(index, shape[0])
+        if rows is not None:
+            rowlen = count // shape[0] if shape[0] else 0
+            lo, hi, index = rows[0] * rowlen, rows[1] * rowlen, rows[2]
+            shape = (rows[1] - rows[0],) + tuple(shape[1:])
+
+    if hi > lo and sizes:
+        first, last = lo // chunksize, -(-hi // chunksize)
+    else:
+        first = last = 0
+    offsets = [0]
+    for size in sizes:
+        offsets.append(offsets[-1] + size)
+    _skip_bytes(fp, offsets[first])
+    data = _read_bytes(fp, offsets[last] - offsets[first], "array data")
+    _skip_bytes(fp, offsets[-1] - offsets[last])
+
+    # the elements from start on, with no chunks if the itemsize is 0
+    start = first * chunksize
+    if out is not None:
+        array = _out_data(out, shape, fortran_order, dtype)
+    elif dtype.itemsize == 0:
+        array = numpy.ndarray(hi - lo, dtype=dtype)
+        start = lo
+    else:
+        array = numpy.ndarray(min(last * chunksize, count) - start,
+                              dtype=dtype)
+
+    def decompress(k):
+        i = k * chunksize - start
+        _decompress_chunk(data[offsets[k] - offsets[first]:
+                               offsets[k + 1] - offsets[first]],
+                          array[i:i + chunksize], d['compression'])
+
+    _map_threads(decompress, range(first, last), threads)
+    if out is not None:
+        return out
+    array = array[lo - start:hi - start]
+
+    if fortran_order:
+        array.shape = shape[::-1]
+        array = array.transpose()
+    else:
+        array.shape = shape
+    if index is not None:
+        array = array[index]
+    return array
+
 
-def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
+def _out_data(out, shape, fortran_order, dtype):
+    """
+    Check that the array data of the file can be read into `out`, returns
+    the 1-d view of `out` in the order of the file.
+    """
+    if not isinstance(out, numpy.ndarray):
+        raise TypeError("out must be an ndarray")
+    if out.shape != tuple(shape) or out.dtype != dtype:
+        msg = "out must have shape %s and dtype %s, not %s and %s"
+        raise ValueError(msg % (tuple(shape), dtype, out.shape, out.dtype))
+    if not out.flags.writeable:
+        raise ValueError("out must be writeable")
+    if fortran_order:
+        if not out.flags.f_contiguous:
+            raise ValueError("out must be Fortran contiguous")
+        return out.T.reshape(-1)
+    if not out.flags.c_contiguous:
+        raise ValueError("out must be C contiguous")
+    return out.reshape(-1)
+
+
+def _read_into(fp, data):
+    """
+    Fill the contiguous uint8 array `data` from fp, with readinto where the
+    file has it, so that the bytes are not copied.
+    """
+    size = data.size
+    pos = 0
+    if hasattr(fp, 'readinto'):
+        view = memoryview(data)
+        while pos < size:
+            try:
+                n = fp.readinto(view[pos:])
+            except io.BlockingIOError:
+                continue
+            if not n:
+                break
+            pos += n
+    else:
+        while pos < size:
+            try:
+                r = fp.read(min(size - pos, BUFFER_SIZE))
+            except io.BlockingIOError:
+                continue
+            if not r:
+                break
+            data[pos:pos + len(r)] = numpy.frombuffer(r, dtype=numpy.uint8)
+            pos += len(r)
+    if pos != size:
+        msg = "EOF: reading %s, expected %d bytes got %d"
+        raise ValueError(msg % ("array data", size, pos))
+
+
+# buffers allocated by _read_direct, which may be read into beyond the
+# array data they hold, by id
+_direct_buffers = weakref.WeakValueDictionary()
+
+
+def _aligned_empty(size, alignment):
+    """ A uint8 array of `size` bytes starting at a multiple of alignment. """
+    buf = numpy.empty(size + alignment, dtype=numpy.uint8)
+    shift = -buf.ctypes.data % alignment
+    return buf[shift:shift + size]
+
+
+def _direct_region(data, head, size, alignment):
+    """
+    The `size` bytes from `head` bytes before the array `data` if they are
+    aligned and part of a buffer of _read_direct, else None.
+    """
+    root = data
+    while isinstance(root.base, numpy.ndarray):
+        root = root.base
+    if _direct_buffers.get(id(root)) is not root:
+        return None
+    address = data.ctypes.data - head
+    start = address - root.ctypes.data
+    if address % alignment or start < 0 or start + size > root.size:
+        return None
+    return root[start:start + size]
+
+
+def _pread_into(fd, buf, offset):
+    """ Read into the uint8 array buf from offset, returns the bytes read. """
+    raw = io.FileIO(fd, 'r', closefd=False)
+    raw.seek(offset)
+    view = memoryview(buf)
+    pos = 0
+    while pos < buf.size:
+        n = raw.readinto(view[pos:])
+        if not n:
+            break
+        pos += n
+    return pos
+
+
+def _set_direct(fd, direct):
+    """
+    Turn O_DIRECT on or off for fd, returns whether it changed.
+    """
+    try:
+        import fcntl
+        flags = fcntl.fcntl(fd, fcntl.F_GETFL)
+        new = flags | os.O_DIRECT if direct else flags & ~os.O_DIRECT
+        if new == flags:
+            return False
+        fcntl.fcntl(fd, fcntl.F_SETFL, new)
+        return True
+    except (ImportError, AttributeError, IOError, OSError):
+        return False
+
+
+def _read_direct(fp, data, nbytes, alignment=DIRECT_ALIGNMENT):
+    """
+    Read the next `nbytes` of the real file fp with O_DIRECT where the
+    platform and file system allow it, into the uint8 array `data` or a new
+    one.  All reads start and end at multiples of alignment, so the bytes
+    go straight into the buffer if it has room for the aligned range
+    around them, which the buffers returned here have.
+    """
+    offset = fp.tell()
+    start = offset - offset % alignment
+    end = -(-(offset + nbytes) // alignment) * alignment
+    if data is None:
+        region = _aligned_empty(end - start, alignment)
+        _direct_buffers[id(region.base)] = region.base
+        data = region[offset - start:offset - start + nbytes]
+    else:
+        region = _direct_region(data, offset - start, end - start, alignment)
+
+    fd = fp.fileno()
+    direct = _set_direct(fd, True)
+    try:
+        try:
+            got = _read_aligned(fd, data, region, start, offset, end,
+                                alignment)
+        except (IOError, OSError) as e:
+            if not direct or e.errno != errno.EINVAL:
+                raise
+            # the file system does not take direct reads of this alignment
+            direct = not _set_direct(fd, False)
+            got = _read_aligned(fd, data, region, start, offset, end,
+                                alignment)
+    finally:
+        if direct:
+            _set_direct(fd, False)
+    if got != nbytes:
+        msg = "EOF: reading %s, expected %d bytes got %d"
+        raise ValueError(msg % ("array data", nbytes, got))
+    fp.seek(offset + nbytes)
+    return data
+
+
+def _read_aligned(fd, data, region, start, offset, end, alignment):
+    """
+    Read the bytes from offset into data with aligned reads of the range
+    start:end, into region if given, else through a bounce buffer.  Returns
+    the number of bytes of data read.
+    """
+    nbytes = data.size
+    if region is not None:
+        got = _pread_into(fd, region, start) - (offset - start)
+        return max(0, min(got, nbytes))
+    bounce = _aligned_empty(min(end - start, 16 * 1024**2), alignment)
+    pos = start
+    while pos < offset + nbytes:
+        size = min(bounce.size, end - pos)
+        n = _pread_into(fd, bounce[:size], pos)
+        lo, hi = max(pos, offset), min(pos + n, offset + nbytes)
+        if hi > lo:
+            data[lo - offset:hi - offset] = bounce[lo - pos:hi - pos]
+        if n < size:
+            return max(0, hi - offset)
+        pos += n
+    return nbytes
+
+
+def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None,
+                compression=None, chunksize=None, threads=None):
     """
     Write an array to an NPY file, including a header.
 
@@ -538,12 +1027,29 @@ def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
         Additional keyword arguments to pass to pickle.dump, excluding
         'protocol'. These are only useful when pickling objects in object
         arrays on Python 3 to Python 2 compatible format.
+    compression : {None, 'zlib', 'shuffle-zlib'}, optional
+        If given, the array is stored compressed in chunks with this codec,
+        in format version 3.0.  Default is 'zlib' for version (3, 0) and
+        None, not compressed, else.
+
+        .. versionadded:: 1.13.0
+    chunksize : int, optional
+        The number of elements in each compressed chunk.  Default: as many
+        as fit into `CHUNK_SIZE` bytes.
+
+        .. versionadded:: 1.13.0
+    threads : int, optional
+        The number of threads that compress the chunks.  Default: the
+        number of CPUs.
+
+        .. versionadded:: 1.13.0
 
     Raises
     ------
     ValueError
         If the array cannot be persisted. This includes the case of
-        allow_pickle=False and array being an object array.
+        allow_pickle=False and array being an object array, and of
+        compression with an object array.
     Various other errors
         If the array contains Python objects as part of its dtype, the
         process of pickling them may raise various errors if the objects
@@ -551,6 +1057,15 @@ def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
 
     """
     _check_version(version)
+    if version == (3, 0) and compression is None:
+        compression = 'zlib'
+    if compression is not None:
+        if version not in (None, (3, 0)):
+            msg = "compression requires format version (3, 0), not %s"
+            raise ValueError(msg % (version,))
+        _write_compressed(fp, array, header_data_from_array_1_0(array),
+                          compression, chunksize, threads)
+        return
     used_ver = _write_array_header(fp, header_data_from_array_1_0(array),
                                    version)
     # this warning can be removed when 1.9 has aged enough
@@ -592,7 +1107,8 @@ def write_array(fp, array, version=None, allow_pickle=True, pickle_kwargs=None):
                 fp.write(chunk.tobytes('C'))
 
 
-def read_array(fp, allow_pickle=True, pickle_kwargs=None):
+def read_array(fp, allow_pickle=True, pickle_kwargs=None, index=None,
+               threads=None, out=None, direct=False):
     """
     Read an array from an NPY file.
 
@@ -607,6 +1123,36 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
         Additional keyword arguments to pass to pickle.load. These are only
         useful when loading object arrays saved on Python 2 when using
         Python 3.
+    index : index expression, optional
+        If given, only ``array[index]`` is returned.  For compressed files
+        in C order, only the chunks that hold the rows selected by an
+        integer, slice or integer array first in `index` are read and
+        decompressed.
+
+        .. versionadded:: 1.13.0
+    threads : int, optional
+        The number of threads that decompress a compressed file.  Default:
+        the number of CPUs.
+
+        .. versionadded:: 1.13.0
+    out : ndarray, optional
+        An array of the shape and dtype of the file, contiguous in its
+        order, to read the data into instead of a new array, which is then
+        returned.  The bytes are read directly into it where the file
+        object has a ``readinto`` method.  Cannot be used with `index` or
+        object arrays.
+
+        .. versionadded:: 1.13.0
+    direct : bool, optional
+        Read the data of an uncompressed real file with reads aligned to
+        `DIRECT_ALIGNMENT` bytes, and with ``O_DIRECT``, bypassing the page
+        cache, where the platform and file system support it.  Without
+        `out` the array is allocated such that the aligned reads go
+        straight into its buffer, and so do later reads into it as `out`,
+        e.g. of a new version of the same file.  Other `out` arrays are
+        filled through an aligned buffer.  Default: False
+
+        .. versionadded:: 1.13.0
 
     Returns
     -------
@@ -617,12 +1163,17 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
     ------
     ValueError
         If the data is invalid, or allow_pickle=False and the file contains
-        an object array.
+        an object array, or `out` does not fit the array in the file.
 
     """
     version = read_magic(fp)
     _check_version(version)
-    shape, fortran_order, dtype = _read_array_header(fp, version)
+    d, dtype = _read_header(fp, version)
+    if out is not None and index is not None:
+        raise ValueError("out cannot be combined with index")
+    if version == (3, 0):
+        return _read_compressed(fp, d, dtype, index, threads, out)
+    shape, fortran_order = d['shape'], d['fortran_order']
     if len(shape) == 0:
         count = 1
     else:
@@ -631,6 +1182,8 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
     # Now read the actual data.
     if dtype.hasobject:
         # The array contained Python objects. We need to unpickle the data.
+        if out is not None:
+            raise ValueError("Object arrays cannot be loaded into out")
         if not allow_pickle:
             raise ValueError("Object arrays cannot be loaded when "
                              "allow_pickle=False")
@@ -646,7 +1199,20 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
                                    "to numpy.load" % (err,))
             raise
     else:
-        if isfileobj(fp):
+        if out is not None:
+            array = _out_data(out, shape, fortran_order, dtype)
+            data = array.view(numpy.uint8) if dtype.itemsize else None
+        else:
+            data = None
+        if direct and isfileobj(fp):
+            data = _read_direct(fp, data, int(count * dtype.itemsize))
+            if out is None:
+                array = (data.view(dtype) if dtype.itemsize else
+                         numpy.ndarray(count, dtype=dtype))
+        elif out is not None:
+            if data is not None:
+                _read_into(fp, data)
+        elif isfileobj(fp):
             # We can use the fast fromfile() function.
             array = numpy.fromfile(fp, dtype=dtype, count=count)
         else:
@@ -674,12 +1240,16 @@ def read_array(fp, allow_pickle=True, pickle_kwargs=None):
                     array[i:i+read_count] = numpy.frombuffer(data, dtype=dtype,
                                                              count=read_count)
 
+        if out is not None:
+            return out
         if fortran_order:
             array.shape = shape[::-1]
             array = array.transpose()
         else:
             array.shape = shape
 
+    if index is not None:
+        array = array[index]
     return array
 
 
@@ -741,6 +1311,8 @@ def open_memmap(filename, mode='r+', dtype=None, shape=None,
         # We are creating the file, not reading it.
         # Check if we ought to create the file.
         _check_version(version)
+        if version == (3, 0):
+            raise ValueError("Compressed arrays can't be memory-mapped.")
         # Ensure that the given dtype is an authentic dtype object rather
         # than just something that can be interpreted as a dtype object.
         dtype = numpy.dtype(dtype)
@@ -769,6 +1341,8 @@ def open_memmap(filename, mode='r+', dtype=None, shape=None,
         try:
             version = read_magic(fp)
             _check_version(version)
+            if version == (3, 0):
+                raise ValueError("Compressed arrays can't be memory-mapped.")
 
             shape, fortran_order, dtype = _read_array_header(fp, version)
             if dtype.hasobject:
@@ -26,7 +26,8 @@ from numpy.lib.twodim_base import diag
 from .utils import deprecate
 from numpy.core.multiarray import (
     _insert, add_docstring, digitize, bincount, normalize_axis_index,
-    interp as compiled_interp, interp_complex as compiled_interp_complex
+    _histogram_uniform, interp as compiled_interp,
+    interp_complex as compiled_interp_complex
     )
 from numpy.core.umath import _add_newdoc_ufunc as add_newdoc_ufunc
 from numpy.compat import long
@@ -733,51 +734,59 @@ def histogram(a, bins=10, range=None, normed=False, weights=None,
         # Compute the bin edges for potential correction.
         bin_edges = linspace(mn, mx, bins + 1, endpoint=True)
 
-        # We iterate over blocks here for two reasons: the first is that for
-        # large arrays, it is actually faster (for example for a 10^8 array it
-        # is 2x as fast) and it results in a memory footprint 3x lower in the
-        # limit of large arrays.
-        for i in arange(0, len(a), BLOCK):
-            tmp_a = a[i:i+BLOCK]
-            if weights is None:
-                tmp_w = None
-            else:
-                tmp_w = weights[i:i + BLOCK]
-
-            # Only include values in the right range
-            keep = (tmp_a >= mn)
-            keep &= (tmp_a <= mx)
-            if not np.logical_and.reduce(keep):
-                tmp_a = tmp_a[keep]
-                if tmp_w is not None:
-                    tmp_w = tmp_w[keep]
-            tmp_a_data = tmp_a.astype(float)
-            tmp_a = tmp_a_data - mn
-            tmp_a *= norm
-
-            # Compute the bin indices, and for values that lie exactly on mx we
-            # need to subtract one
-            indices = tmp_a.astype(np.intp)
-            indices[indices == bins] -= 1
-
-            # The index computation is not guaranteed to give exactly
-            # consistent results within ~1 ULP of the bin edges.
-            decrement = tmp_a_data < bin_edges[indices]
-            indices[decrement] -= 1
-            # The last bin includes the right edge. The other bins do not.
-            increment = ((tmp_a_data >= bin_edges[indices + 1])
-                         & (indices != bins - 1))
-            indices[increment] += 1
-
-            # We now compute the histogram using bincount
-            if ntype.kind == 'c':
-                n.real += np.bincount(indices, weights=tmp_w.real,
-                                      minlength=bins)
-                n.imag += np.bincount(indices, weights=tmp_w.imag,
-                                      minlength=bins)
-            else:
-                n += np.bincount(indices, weights=tmp_w,
-                                 minlength=bins).astype(ntype)
+        # Real samples are binned and counted in C, without the temporaries
+        # of the blocked loop below.
+        if (a.dtype.kind in 'biuf' and a.dtype != np.longdouble and
+                (weights is None or weights.dtype.kind in 'biufc') and
+                bins < 2**31 - 1):
+            n = _histogram_uniform(a, bin_edges, norm, weights)
+            n = n.astype(ntype, copy=False)
+        else:
+            # We iterate over blocks here for two reasons: the first is that
+            # for large arrays, it is actually faster (for example for a 10^8
+            # array it is 2x as fast) and it results in a memory footprint 3x
+            # lower in the limit of large arrays.
+            for i in arange(0, len(a), BLOCK):
+                tmp_a = a[i:i+BLOCK]
+                if weights is None:
+                    tmp_w = None
+                else:
+                    tmp_w = weights[i:i + BLOCK]
+
+                # Only include values in the right range
+                keep = (tmp_a >= mn)
+                keep &= (tmp_a <= mx)
+                if not np.logical_and.reduce(keep):
+                    tmp_a = tmp_a[keep]
+                    if tmp_w is not None:
+                        tmp_w = tmp_w[keep]
+                tmp_a_data = tmp_a.astype(float)
+                tmp_a = tmp_a_data - mn
+                tmp_a *= norm
+
+                # Compute the bin indices, and for values that lie exactly on
+                # mx we need to subtract one
+                indices = tmp_a.astype(np.intp)
+                indices[indices == bins] -= 1
+
+                # The index computation is not guaranteed to give exactly
+                # consistent results within ~1 ULP of the bin edges.
+                decrement = tmp_a_data < bin_edges[indices]
+                indices[decrement] -= 1
+                # The last bin includes the right edge. The other bins do not.
+                increment = ((tmp_a_data >= bin_edges[indices + 1])
+                             & (indices != bins - 1))
+                indices[increment] += 1
+
+                # We now compute the histogram using bincount
+                if ntype.kind == 'c':
+                    n.real += np.bincount(indices, weights=tmp_w.real,
+                                          minlength=bins)
+                    n.imag += np.bincount(indices, weights=tmp_w.imag,
+                                          minlength=bins)
+                else:
+                    n += np.bincount(indices, weights=tmp_w,
+                                     minlength=bins).astype(ntype)
 
         # Rename the bin edges for return.
         bins = bin_edges
@@ -11,7 +11,9 @@ from operator import itemgetter, index as opindex
 import numpy as np
 from . import format
 from ._datasource import DataSource
-from numpy.core.multiarray import packbits, unpackbits
+from numpy.core.multiarray import (
+    packbits, unpackbits, _load_from_filelike, _TextReader, _format_rows
+    )
 from ._iotools import (
     LineSplitter, NameValidator, StringConverter, ConverterError,
     ConverterLockError, ConversionWarning, _is_string_like,
@@ -31,8 +33,8 @@ else:
 loads = pickle.loads
 
 __all__ = [
-    'savetxt', 'loadtxt', 'genfromtxt', 'ndfromtxt', 'mafromtxt',
-    'recfromtxt', 'recfromcsv', 'load', 'loads', 'save', 'savez',
+    'savetxt', 'loadtxt', 'iter_loadtxt', 'genfromtxt', 'ndfromtxt',
+    'mafromtxt', 'recfromtxt', 'recfromcsv', 'load', 'loads', 'save', 'savez',
     'savez_compressed', 'packbits', 'unpackbits', 'fromregex', 'DataSource'
     ]
 
@@ -745,9 +747,162 @@ def _getconv(dtype):
         return asstr
 
 
+def _textreader_fields(dtype, ncols):
+    """Row dtype and (dtype, offset) of each value for the C text reader.
+
+    A non-structured `dtype` gives rows of `ncols` values, a structured one
+    a value for each scalar in it, in the order of `flatten_dtype`.
+    Returns None if the reader cannot fill `dtype`, as for objects, strings
+    without a length or a dtype that is itself a subarray.
+    """
+    def flat(dt, offset):
+        if dt.names is None:
+            base = dt.base
+            return [(base, offset + i * base.itemsize)
+                    for i in range(int(np.prod(dt.shape)))]
+        items = []
+        for name in dt.names:
+            tp, off = dt.fields[name][:2]
+            items.extend(flat(tp, offset + off))
+        return items
+
+    if dtype.names is None:
+        if dtype.shape:
+            return None
+        fields = [(dtype, i * dtype.itemsize) for i in range(ncols)]
+        rowtype = np.dtype((dtype, (ncols,))) if ncols > 1 else dtype
+    else:
+        fields = flat(dtype, 0)
+        rowtype = dtype
+    if rowtype.hasobject or rowtype.itemsize == 0:
+        return None
+    for dt, offset in fields:
+        if dt.itemsize == 0 or dt.kind == 'V':
+            return None
+    return rowtype, fields
+
+
+def _split_quoted(line, comments, delimiter, quotechar):
+    """Chop off comments, strip and split `line` outside of quotes.
+
+    Delimiters and comments between quotes are part of the value, and a
+    doubled `quotechar` in quotes stands for itself, as in the C reader.
+    """
+    n = len(line)
+    end = n
+    quoted = False
+    for i in range(n):
+        c = line[i:i + 1]
+        if c == quotechar:
+            quoted = not quoted
+        elif not quoted and any(line.startswith(cm, i)
+                                for cm in comments or ()):
+            end = i
+            break
+    line = line[:end].strip(b'\r\n')
+    if not line:
+        return []
+    values = []
+    value = None
+    quoted = False
+    i = 0
+    n = len(line)
+    while i < n:
+        c = line[i:i + 1]
+        if c == quotechar:
+            value = value or []
+            if quoted and line[i + 1:i + 2] == quotechar:
+                value.append(c)
+                i += 1
+            else:
+                quoted = not quoted
+        elif quoted:
+            value.append(c)
+        elif delimiter is None and c.isspace():
+            if value is not None:
+                values.append(b''.join(value))
+                value = None
+        elif delimiter is not None and line.startswith(delimiter, i):
+            values.append(b''.join(value or []))
+            value = []
+            i += len(delimiter) - 1
+        else:
+            value = value or []
+            value.append(c)
+        i += 1
+    if delimiter is not None or value is not None:
+        values.append(b''.join(value or []))
+    return values
+
+
+def _loadtxt_options(comments, delimiter, quotechar, usecols):
+    """Bring the `loadtxt` options into the form its readers use.
+
+    Comments become a list of bytes, the delimiter and quotechar bytes and
+    usecols a list.
+    """
+    # Type conversions for Py3 convenience
+    if comments is not None:
+        if isinstance(comments, (basestring, bytes)):
+            comments = [asbytes(comments)]
+        else:
+            comments = [asbytes(comment) for comment in comments]
+    if delimiter is not None:
+        delimiter = asbytes(delimiter)
+    if quotechar is not None:
+        quotechar = asbytes(quotechar)
+        if len(quotechar) != 1:
+            raise ValueError('quotechar must be a single character')
+
+    if usecols is not None:
+        # Allow usecols to be a single int or a sequence of ints
+        try:
+            usecols_as_list = list(usecols)
+        except TypeError:
+            usecols_as_list = [usecols]
+        for col_idx in usecols_as_list:
+            try:
+                opindex(col_idx)
+            except TypeError as e:
+                e.args = (
+                    "usecols must be an int or a sequence of ints but "
+                    "it contains at least one element of type %s" %
+                    type(col_idx),
+                    )
+                raise
+        # Fall back to existing code
+        usecols = usecols_as_list
+    return comments, delimiter, quotechar, usecols
+
+
+def _loadtxt_open(fname):
+    """Line iterator over `fname` and whether it has to be closed."""
+    fown = False
+    try:
+        if is_pathlib_path(fname):
+            fname = str(fname)
+        if _is_string_like(fname):
+            fown = True
+            if fname.endswith('.gz'):
+                import gzip
+                fh = iter(gzip.GzipFile(fname))
+            elif fname.endswith('.bz2'):
+                import bz2
+                fh = iter(bz2.BZ2File(fname))
+            elif sys.version_info[0] == 2:
+                fh = iter(open(fname, 'U'))
+            else:
+                fh = iter(open(fname))
+        else:
+            fh = iter(fname)
+    except TypeError:
+        raise ValueError('fname must be a string, file handle, or generator')
+    return fh, fown
+
+
 def loadtxt(fname, dtype=float, comments='#', delimiter=None,
             converters=None, skiprows=0, usecols=None, unpack=False,
-            ndmin=0):
+            ndmin=0, quotechar=None):
     """
     Load data from a text file.
 
@@ -802,6 +957,12 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
         Legal values: 0 (default), 1 or 2.
 
         .. versionadded:: 1.6.0
+    quotechar : str, optional
+        The character used to quote values.  Delimiters and comments
+        between quotes are part of the value, and a doubled `quotechar`
+        between quotes stands for a single one.  Default: None, no quoting.
+
+        .. versionadded:: 1.13.0
 
     Returns
     -------
@@ -847,59 +1008,15 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
     array([ 2.,  4.])
 
     """
-    # Type conversions for Py3 convenience
+    comments, delimiter, quotechar, usecols = _loadtxt_options(
+        comments, delimiter, quotechar, usecols)
     if comments is not None:
-        if isinstance(comments, (basestring, bytes)):
-            comments = [asbytes(comments)]
-        else:
-            comments = [asbytes(comment) for comment in comments]
-
         # Compile regex for comments beforehand
-        comments = (re.escape(comment) for comment in comments)
-        regex_comments = re.compile(b'|'.join(comments))
+        regex_comments = re.compile(
+            b'|'.join(re.escape(comment) for comment in comments))
     user_converters = converters
-    if delimiter is not None:
-        delimiter = asbytes(delimiter)
-
-    if usecols is not None:
-        # Allow usecols to be a single int or a sequence of ints
-        try:
-            usecols_as_list = list(usecols)
-        except TypeError:
-            usecols_as_list = [usecols]
-        for col_idx in usecols_as_list:
-            try:
-                opindex(col_idx)
-            except TypeError as e:
-                e.args = (
-                    "usecols must be an int or a sequence of ints but "
-                    "it contains at least one element of type %s" %
-                    type(col_idx),
-                    )
-                raise
-        # Fall back to existing code
-        usecols = usecols_as_list
 
-    fown = False
-    try:
-        if is_pathlib_path(fname):
-            fname = str(fname)
-        if _is_string_like(fname):
-            fown = True
-            if fname.endswith('.gz'):
-                import gzip
-                fh = iter(gzip.GzipFile(fname))
-            elif fname.endswith('.bz2'):
-                import bz2
-                fh = iter(bz2.BZ2File(fname))
-            elif sys.version_info[0] == 2:
-                fh = iter(open(fname, 'U'))
-            else:
-                fh = iter(open(fname))
-        else:
-            fh = iter(fname)
-    except TypeError:
-        raise ValueError('fname must be a string, file handle, or generator')
+    fh, fown = _loadtxt_open(fname)
     X = []
 
     # not to be confused with the flatten_dtype we import...
@@ -956,6 +1073,8 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
 
         """
         line = asbytes(line)
+        if quotechar is not None:
+            return _split_quoted(line, comments, delimiter, quotechar)
         if comments is not None:
             line = regex_comments.split(asbytes(line), maxsplit=1)[0]
         line = line.strip(b'\r\n')
@@ -999,6 +1118,7 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
                 packing = [(N, tuple)]
 
         # By preference, use the converters specified by the user
+        fast = [True] * len(converters)
         for i, conv in (user_converters or {}).items():
             if usecols:
                 try:
@@ -1007,29 +1127,48 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
                     # Unused converter specified
                     continue
             converters[i] = conv
+            fast[i] = False
 
-        # Parse each line, including the first
-        for i, line in enumerate(itertools.chain([first_line], fh)):
-            vals = split_line(line)
-            if len(vals) == 0:
-                continue
-            if usecols:
-                vals = [vals[i] for i in usecols]
-            if len(vals) != N:
-                line_num = i + skiprows + 1
-                raise ValueError("Wrong number of columns at line %d"
-                                 % line_num)
-
-            # Convert each value according to its column and store
-            items = [conv(val) for (conv, val) in zip(converters, vals)]
-            # Then pack it according to the dtype's nesting
-            items = pack_items(items, packing)
-            X.append(items)
+        # Parse the lines in C if it can fill the dtype, the converters
+        # are only called for values it does not parse itself
+        reader = _textreader_fields(dtype, N)
+        if (reader is not None and len(reader[1]) <= N and
+                not (comments is not None and b'' in comments)):
+            if sys.version_info[0] == 2:
+                fast = [f and dt.kind != 'U'
+                        for f, (dt, offset) in zip(fast, reader[1])]
+            fields = [(dt, offset, conv, f) for ((dt, offset), conv, f)
+                      in zip(reader[1], converters, fast)]
+            X = _load_from_filelike(
+                fh, reader[0], fields, first_line=first_line,
+                delimiter=delimiter, comments=comments,
+                quotechar=quotechar, usecols=usecols or None, ncols=N,
+                lineno=skiprows + 1)
+            if len(X) == 0:
+                X = []
+        else:
+            # Parse each line, including the first
+            for i, line in enumerate(itertools.chain([first_line], fh)):
+                vals = split_line(line)
+                if len(vals) == 0:
+                    continue
+                if usecols:
+                    vals = [vals[i] for i in usecols]
+                if len(vals) != N:
+                    line_num = i + skiprows + 1
+                    raise ValueError("Wrong number of columns at line %d"
+                                     % line_num)
+
+                # Convert each value according to its column and store
+                items = [conv(val) for (conv, val) in zip(converters, vals)]
+                # Then pack it according to the dtype's nesting
+                items = pack_items(items, packing)
+                X.append(items)
     finally:
         if fown:
             fh.close()
 
-    X = np.array(X, dtype)
+    X = np.array(X, dtype, copy=False)
     # Multicolumn data are returned with shape (1, N, M), i.e.
     # (1, 1, M) for a single row - remove the singleton dimension there
     if X.ndim == 3 and X.shape[:2] == (1, 1):
@@ -1060,6 +1199,118 @@ def loadtxt(fname, dtype=float, comments='#', delimiter=None,
         return X
 
 
+def iter_loadtxt(fname, chunksize=65536, dtype=float, comments='#',
+                 delimiter=None, converters=None, skiprows=0, usecols=None,
+                 quotechar=None, reuse_buffer=False):
+    """
+    Iterate over the data of a text file in arrays of `chunksize` rows.
+
+    The file is read as by `loadtxt`, but only as far as needed for the
+    next array, so that files much larger than the memory can be processed
+    a piece at a time.
+
+    .. versionadded:: 1.13.0
+
+    Parameters
+    ----------
+    fname : file, str, or pathlib.Path
+        File, filename, or generator to read.  If the filename extension is
+        ``.gz`` or ``.bz2``, the file is first decompressed.
+    chunksize : int, optional
+        The number of rows of each array but the last one, which holds the
+        remaining rows.  Default: 65536.
+    dtype, comments, delimiter, converters, skiprows, usecols, quotechar
+        As for `loadtxt`.  `dtype` must not contain objects or strings
+        without a length.
+    reuse_buffer : bool, optional
+        If True, all arrays are views of one buffer of `chunksize` rows,
+        which is overwritten by the next one.  Copy the arrays to keep them
+        beyond the next iteration.  Default: False.
+
+    Yields
+    ------
+    out : ndarray
+        The next rows, as a 2-D array if each row has several values of a
+        non-structured `dtype`, else as a 1-D array.
+
+    See Also
+    --------
+    loadtxt
+
+    Examples
+    --------
+    >>> from io import StringIO
+    >>> c = StringIO("0 1\\n2 3\\n4 5")
+    >>> for a in np.iter_loadtxt(c, chunksize=2):
+    ...     print(a.sum(axis=0))
+    [ 2.  4.]
+    [ 4.  5.]
+
+    """
+    comments, delimiter, quotechar, usecols = _loadtxt_options(
+        comments, delimiter, quotechar, usecols)
+    chunksize = opindex(chunksize)
+    if chunksize < 1:
+        raise ValueError('chunksize must be at least 1')
+    dtype = np.dtype(dtype)
+
+    fh, fown = _loadtxt_open(fname)
+    try:
+        # Skip the first `skiprows` lines and find the first line with
+        # values, which gives the number of columns
+        for line in itertools.islice(fh, skiprows):
+            pass
+        first_vals = []
+        for first_line in fh:
+            first_vals = _split_quoted(asbytes(first_line), comments,
+                                       delimiter, quotechar)
+            if first_vals:
+                break
+        else:
+            warnings.warn('iter_loadtxt: Empty input file: "%s"' % fname,
+                          stacklevel=2)
+            return
+        N = len(usecols or first_vals)
+
+        reader = _textreader_fields(dtype, N)
+        if reader is None:
+            raise TypeError('iter_loadtxt cannot read data of type %s'
+                            % (dtype,))
+        rowtype, fields = reader
+        if len(fields) > N:
+            raise ValueError('%d columns are read, but the dtype has %d '
+                             'fields' % (N, len(fields)))
+
+        convs = [_getconv(dt) for dt, offset in fields]
+        fast = [sys.version_info[0] > 2 or dt.kind != 'U'
+                for dt, offset in fields]
+        for i, conv in (converters or {}).items():
+            if usecols:
+                try:
+                    i = usecols.index(i)
+                except ValueError:
+                    # Unused converter specified
+                    continue
+            convs[i] = conv
+            fast[i] = False
+        fields = [(dt, offset, conv, f) for ((dt, offset), conv, f)
+                  in zip(fields, convs, fast)]
+
+        textreader = _TextReader(
+            fh, rowtype, fields, first_line=first_line, delimiter=delimiter,
+            comments=comments, quotechar=quotechar, usecols=usecols or None,
+            ncols=N, lineno=skiprows + 1)
+        out = np.empty(chunksize, rowtype) if reuse_buffer else None
+        while True:
+            X = textreader.read(chunksize, out)
+            if len(X) == 0:
+                break
+            yield X
+    finally:
+        if fown:
+            fh.close()
+
+
 def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
             footer='', comments='# '):
     """
@@ -1150,6 +1401,13 @@ def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
 
         ``o`` : signed octal
 
+        ``r`` : the shortest string that reads back as the same value of
+        the array's precision (``float16``, ``float32`` or ``float64``)
+
+        .. versionchanged:: 1.13.0
+           ``r`` used the repr of the array scalars, with 17 significant
+           digits for ``float64``.
+
         ``s`` : string of characters
 
         ``u`` : unsigned decimal integer
@@ -1159,6 +1417,10 @@ def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
     This explanation of ``fmt`` is not complete, for an exhaustive
     specification see [1]_.
 
+    Numeric arrays are formatted in C when `fmt` only uses the ``d, i, u,
+    e, E, f, F, g, G`` and ``r`` specifiers, with the same result as the
+    Python ``%`` operator.
+
     References
     ----------
     .. [1] `Format Specification Mini-Language
@@ -1242,20 +1504,28 @@ def savetxt(fname, X, fmt='%.18e', delimiter=' ', newline='\n', header='',
             header = header.replace('\n', '\n' + comments)
             fh.write(asbytes(comments + header + newline))
         if iscomplex_X:
-            for row in X:
-                row2 = []
-                for number in row:
-                    row2.append(number.real)
-                    row2.append(number.imag)
-                fh.write(asbytes(format % tuple(row2) + newline))
+            # the real and imaginary parts of each row side by side
+            Xr = np.ascontiguousarray(X)
+            Xr = Xr.view(Xr.real.dtype)
         else:
-            for row in X:
-                try:
-                    fh.write(asbytes(format % tuple(row) + newline))
-                except TypeError:
-                    raise TypeError("Mismatch between array dtype ('%s') and "
-                                    "format specifier ('%s')"
-                                    % (str(X.dtype), format))
+            Xr = X
+        if _format_rows(Xr, format, newline, fh) is NotImplemented:
+            # formats the C formatter does not handle
+            if iscomplex_X:
+                for row in X:
+                    row2 = []
+                    for number in row:
+                        row2.append(number.real)
+                        row2.append(number.imag)
+                    fh.write(asbytes(format % tuple(row2) + newline))
+            else:
+                for row in X:
+                    try:
+                        fh.write(asbytes(format % tuple(row) + newline))
+                    except TypeError:
+                        raise TypeError("Mismatch between array dtype ('%s') "
+                                        "and format specifier ('%s')"
+                                        % (str(X.dtype), format))
         if len(footer) > 0:
             footer = footer.replace('\n', '\n' + comments)
             fh.write(asbytes(comments + footer + newline))
@@ -1352,6 +1622,21 @@ def fromregex(file, regexp, dtype):
 #####--------------------------------------------------------------------------
 
 
+def _report_invalid_rows(invalid, nbcols, invalid_raise):
+    """Raise or warn about the (line, number of columns) in `invalid`."""
+    template = "    Line #%%i (got %%i columns instead of %i)" % nbcols
+    errmsg = [template % (i, nb) for (i, nb) in invalid]
+    if len(errmsg):
+        errmsg.insert(0, "Some errors were detected !")
+        errmsg = "\n".join(errmsg)
+        # Raise an exception ?
+        if invalid_raise:
+            raise ValueError(errmsg)
+        # Issue a warning ?
+        else:
+            warnings.warn(errmsg, ConversionWarning, stacklevel=3)
+
+
 def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
                skip_header=0, skip_footer=0, converters=None,
                missing_values=None, filling_values=None, usecols=None,
@@ -1557,8 +1842,9 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
             "fname must be a string, filehandle, list of strings, "
             "or generator. Got %s instead." % type(fname))
 
-    split_line = LineSplitter(delimiter=delimiter, comments=comments,
-                              autostrip=autostrip)._handyman
+    splitter = LineSplitter(delimiter=delimiter, comments=comments,
+                            autostrip=autostrip)
+    split_line = splitter._handyman
     validate_names = NameValidator(excludelist=excludelist,
                                    deletechars=deletechars,
                                    case_sensitive=case_sensitive,
@@ -1783,6 +2069,45 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
     # Fixme: possible error as following variable never used.
     #miss_chars = [_.missing_values for _ in converters]
 
+    # Parse the lines in C when the values go straight into the dtype, the
+    # converters are only called for values it does not parse itself
+    reader = None
+    if (dtype is not None and not usemask and not skip_footer and
+            not user_converters and comments != b'' and
+            (splitter.delimiter is None or
+             isinstance(splitter.delimiter, bytes))):
+        reader = _textreader_fields(dtype, nbcols)
+        if reader is not None and len(reader[1]) != len(converters):
+            reader = None
+    if reader is not None:
+        if names and dtype.names:
+            dtype.names = names
+        calls = [conv._loose_call if loose else conv._strict_call
+                 for conv in converters]
+        fields = [(dt, offset, call, dt.kind in 'iuf')
+                  for ((dt, offset), call) in zip(reader[1], calls)]
+        invalid = []
+        try:
+            output = _load_from_filelike(
+                # iterate over the lines to leave the rest of the file alone
+                fhd if max_rows is None else (line for line in fhd),
+                reader[0], fields, first_line=first_line,
+                delimiter=splitter.delimiter,
+                comments=None if comments is None else [comments],
+                usecols=usecols or None, ncols=nbcols,
+                lineno=skip_header + 1, strip_spaces=True,
+                strip_fields=autostrip, invalid=invalid,
+                max_rows=-1 if max_rows is None else max_rows)
+        finally:
+            if own_fhd:
+                fhd.close()
+        _report_invalid_rows(invalid, nbcols, invalid_raise)
+        if len(output) == 0:
+            output = np.array([], dtype)
+        if unpack:
+            return output.squeeze().T
+        return output.squeeze()
+
     # Initialize the output lists ...
     # ... rows
     rows = []
@@ -1845,8 +2170,6 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
     nbinvalid = len(invalid)
     if nbinvalid > 0:
         nbrows = len(rows) + nbinvalid - skip_footer
-        # Construct the error message
-        template = "    Line #%%i (got %%i columns instead of %i)" % nbcols
         if skip_footer > 0:
             nbinvalid_skipped = len([_ for _ in invalid
                                      if _[0] > nbrows + skip_header])
@@ -1857,17 +2180,7 @@ def genfromtxt(fname, dtype=float, comments='#', delimiter=None,
 #            errmsg = [template % (i, nb)
 #                      for (i, nb) in invalid if i < nbrows]
 #        else:
-        errmsg = [template % (i, nb)
-                  for (i, nb) in invalid]
-        if len(errmsg):
-            errmsg.insert(0, "Some errors were detected !")
-            errmsg = "\n".join(errmsg)
-            # Raise an exception ?
-            if invalid_raise:
-                raise ValueError(errmsg)
-            # Issue a warning ?
-            else:
-                warnings.warn(errmsg, ConversionWarning, stacklevel=2)
+        _report_invalid_rows(invalid, nbcols, invalid_raise)
 
     # Strip the last skip_footer data
     if skip_footer > 0:
@@ -208,6 +208,34 @@ class TestSetOps(TestCase):
         assert_array_equal(in1d(a, long_b, assume_unique=True), ec)
         assert_array_equal(in1d(a, long_b, assume_unique=False), ec)
 
+    def test_in1d_hash(self):
+        rng = np.random.RandomState(0)
+        a = rng.randint(0, 300, 1000)
+        b = rng.randint(0, 300, 200)
+        for dt1, dt2 in [('i8', 'i8'), ('u1', 'i2'), ('>i4', '<i8'),
+                         ('S3', 'S5'), ('U2', 'U4'),
+                         ('m8[s]', 'm8[ms]'), ('V8', 'V8')]:
+            a1 = a.astype(dt1) if dt1[0] != 'V' else a.view(dt1)
+            b1 = b.astype(dt2) if dt2[0] != 'V' else b.view(dt2)
+            msg = "in1d of %s and %s" % (dt1, dt2)
+            for invert in [False, True]:
+                expected = in1d(a1, b1, invert=invert, method='sort')
+                assert_array_equal(in1d(a1, b1, invert=invert), expected, msg)
+                assert_array_equal(in1d(a1, b1, invert=invert,
+                                        method='hash'), expected, msg)
+            assert_array_equal(intersect1d(a1, b1),
+                               unique(a1)[in1d(unique(a1), b1,
+                                               method='sort')], msg)
+            assert_array_equal(setdiff1d(a1, b1),
+                               unique(a1)[in1d(unique(a1), b1, invert=True,
+                                               method='sort')], msg)
+
+        assert_array_equal(in1d(np.array([], int), [1, 2], method='hash'), [])
+        assert_array_equal(in1d([1, 2], np.array([], int), method='hash'),
+                           [False, False])
+        assert_raises(TypeError, in1d, [1.], [1.], method='hash')
+        assert_raises(ValueError, in1d, [1], [1], method='bogus')
+
     def test_union1d(self):
         a = np.array([5, 4, 7, 1, 2])
         b = np.array([2, 4, 3, 3, 2, 1, 5])
@@ -355,6 +383,35 @@ class TestUnique(TestCase):
         a2, a2_inv = np.unique(a, return_inverse=True)
         assert_array_equal(a2_inv, np.zeros(5))
 
+    def test_unique_hash(self):
+        rng = np.random.RandomState(0)
+        for dt in np.typecodes['AllInteger'] + 'mM' + 'SU' + 'V':
+            a = rng.randint(0, 100, 1000)
+            if dt == 'V':
+                a = a.view('V8')
+            elif dt in 'mM':
+                a = a.astype(dt + '8[D]')
+            else:
+                a = a.astype(dt)
+            msg = "unique with method='hash' for dtype %s" % a.dtype
+            u, i, inv, c = unique(a, True, True, True, method='hash')
+            # the values are in order of first appearance
+            assert_array_equal(i, np.sort(i), msg)
+            assert_array_equal(a[i], u, msg)
+            assert_array_equal(u[inv], a, msg)
+            assert_array_equal(c, [np.sum(a == x) for x in u], msg)
+            assert_array_equal(np.sort(u), unique(a), msg)
+            assert_array_equal(unique(a, method='hash'), u, msg)
+
+        assert_array_equal(unique(np.array([], int), method='hash'), [])
+        a = np.array([[3, 1], [3, 1], [0, 1]])
+        u, inv = unique(a, return_inverse=True, axis=0, method='hash')
+        assert_array_equal(u, [[3, 1], [0, 1]])
+        assert_array_equal(inv, [0, 0, 1])
+        assert_raises(TypeError, unique, [1., 2.], method='hash')
+        assert_raises(TypeError, unique, [[1., 2.]], axis=0, method='hash')
+        assert_raises(ValueError, unique, [1], method='bogus')
+
     def test_unique_axis_errors(self):
         assert_raises(TypeError, self._run_axis_tests, object)
         assert_raises(TypeError, self._run_axis_tests,
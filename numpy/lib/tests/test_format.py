@@ -285,8 +285,8 @@ from io import BytesIO
 
 import numpy as np
 from numpy.testing import (
-    run_module_suite, assert_, assert_array_equal, assert_raises, raises,
-    dec, SkipTest
+    run_module_suite, assert_, assert_equal, assert_array_equal, assert_raises,
+    raises, dec, SkipTest
     )
 from numpy.lib import format
 
@@ -623,6 +623,162 @@ def test_version_2_0():
     assert_raises(ValueError, format.write_array, f, d, (1, 0))
 
 
+def test_version_3_0():
+    for arr in basic_arrays + record_arrays:
+        if arr.dtype.hasobject:
+            continue
+        for compression in format.COMPRESSIONS:
+            for chunksize in [None, 1, 7]:
+                f = BytesIO()
+                format.write_array(f, arr, compression=compression,
+                                   chunksize=chunksize, threads=2)
+                format.write_array(f, arr, version=(3, 0))
+                f.seek(0)
+                assert_(format.read_magic(f) == (3, 0))
+                f.seek(0)
+                assert_array_equal(format.read_array(f, threads=2), arr)
+                assert_array_equal(format.read_array(f), arr)
+                assert_(f.read() == b'')
+
+
+def test_version_3_0_index():
+    arr = np.arange(3000.).reshape(100, 3, 10)
+    f = BytesIO()
+    format.write_array(f, arr, compression='shuffle-zlib', chunksize=64)
+    for index in [0, -1, 57, slice(None), slice(10, 20), slice(90, 5, -7),
+                  slice(3, 3), (slice(4, 8), 1, slice(None, None, 2)),
+                  [5, 0, -1], (np.array([[1, 2], [3, 4]]), 0),
+                  Ellipsis, (Ellipsis, 2), (None, 3)]:
+        f.seek(0)
+        assert_array_equal(format.read_array(f, index=index), arr[index])
+    f.seek(0)
+    assert_raises(IndexError, format.read_array, f, index=100)
+    f.seek(0)
+    assert_raises(IndexError, format.read_array, f, index=[1, -101])
+
+
+def test_version_3_0_errors():
+    f = BytesIO()
+    arr = np.arange(10)
+    assert_raises(ValueError, format.write_array, f, arr, compression='lz4')
+    assert_raises(ValueError, format.write_array, f, arr, version=(2, 0),
+                  compression='zlib')
+    assert_raises(ValueError, format.write_array, f, arr, chunksize=0,
+                  compression='zlib')
+    assert_raises(ValueError, format.write_array, f,
+                  np.array([None], dtype=object), compression='zlib')
+
+    # object arrays, which are never written as 3.0
+    f = BytesIO()
+    d = {'descr': '|O', 'fortran_order': False, 'shape': (1,),
+         'compression': 'zlib', 'chunksize': 1, 'chunks': [0]}
+    format._write_array_header(f, d, (3, 0))
+    f.seek(0)
+    assert_raises(ValueError, format.read_array, f)
+
+    # truncated and corrupted data
+    f = BytesIO()
+    format.write_array(f, arr, compression='zlib', chunksize=4)
+    data = f.getvalue()
+    assert_raises(ValueError, format.read_array, BytesIO(data[:-1]))
+    assert_raises(ValueError, format.read_array,
+                  BytesIO(data[:-3] + b'abc'))
+
+    tf = tempfile.mktemp('', 'mmap', dir=tempdir)
+    with open(tf, 'wb') as fp:
+        fp.write(data)
+    assert_raises(ValueError, format.open_memmap, tf, mode='r')
+    assert_raises(ValueError, format.open_memmap, tf, mode='w+',
+                  dtype=arr.dtype, shape=arr.shape, version=(3, 0))
+
+
+def test_read_array_out():
+    for arr in basic_arrays + record_arrays:
+        if arr.dtype.hasobject:
+            continue
+        for version in [None, (3, 0)]:
+            f = BytesIO()
+            format.write_array(f, arr, version=version)
+            format.write_array(f, arr, version=version)
+            f.seek(0)
+            if arr.flags.f_contiguous and not arr.flags.c_contiguous:
+                out = np.empty(arr.shape, arr.dtype, order='F')
+            else:
+                out = np.empty(arr.shape, arr.dtype)
+            assert_(format.read_array(f, out=out) is out)
+            assert_array_equal(out, arr)
+            out[...] = 0
+            assert_(format.read_array(f, out=out) is out)
+            assert_array_equal(out, arr)
+            assert_(f.read() == b'')
+
+    f = BytesIO()
+    format.write_array(f, np.ones((3, 4)))
+    for out in [np.empty((3, 5)), np.empty((3, 4), np.float32),
+                np.empty((3, 4), order='F'), np.empty((3, 8))[:, ::2]]:
+        f.seek(0)
+        assert_raises(ValueError, format.read_array, f, out=out)
+    f.seek(0)
+    assert_raises(ValueError, format.read_array, f, out=np.empty((3, 4)),
+                  index=0)
+
+    f = BytesIO()
+    format.write_array(f, np.array([None], dtype=object))
+    f.seek(0)
+    assert_raises(ValueError, format.read_array, f,
+                  out=np.empty(1, dtype=object))
+
+
+def test_read_array_direct():
+    tf = tempfile.mktemp('', 'direct', dir=tempdir)
+    a = np.arange(5000.).reshape(100, 50)
+    b = np.asfortranarray(a[::-1])
+    with open(tf, 'wb') as fp:
+        fp.write(b'abc')
+        format.write_array(fp, a)
+        format.write_array(fp, b)
+    with open(tf, 'rb') as fp:
+        fp.seek(3)
+        x = format.read_array(fp, direct=True)
+        y = format.read_array(fp, direct=True)
+        assert_(fp.read() == b'')
+    assert_array_equal(x, a)
+    assert_array_equal(y, b)
+
+    # reading into the arrays again, which goes straight into the aligned
+    # buffer of x, and into other arrays, which goes through a copy
+    regions = []
+    read_aligned = format._read_aligned
+
+    def record(fd, data, region, *args):
+        regions.append(region is not None)
+        return read_aligned(fd, data, region, *args)
+
+    format._read_aligned = record
+    try:
+        with open(tf, 'rb') as fp:
+            fp.seek(3)
+            x[...] = 0
+            out = np.empty_like(b, order='F')
+            assert_(format.read_array(fp, out=x, direct=True) is x)
+            assert_(format.read_array(fp, out=out, direct=True) is out)
+    finally:
+        format._read_aligned = read_aligned
+    assert_equal(regions, [True, False])
+    assert_array_equal(x, a)
+    assert_array_equal(out, b)
+
+    # truncated data
+    with open(tf, 'rb') as fp:
+        data = fp.read()
+    with open(tf, 'wb') as fp:
+        fp.write(data[:-1])
+    with open(tf, 'rb') as fp:
+        fp.seek(3)
+        format.read_array(fp, direct=True)
+        assert_raises(ValueError, format.read_array, fp, direct=True)
+
+
 @dec.slow
 def test_version_2_0_memmap():
     # requires more than 2 byte for header
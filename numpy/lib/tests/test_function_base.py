@@ -1761,6 +1761,42 @@ class TestHistogram(TestCase):
         hist, edges = np.histogram(arr, bins=30, range=(-0.5, 5))
         self.assertEqual(hist[-1], 1)
 
+    def test_uniform_bins_match_edges(self):
+        # Counting with equal bins must agree with searching the edges,
+        # including samples on the edges, out of range and nan.
+        rng = np.random.RandomState(1)
+        x = rng.uniform(-1, 11, 100003)
+        x[::17] = np.round(x[::17])
+        w = rng.standard_normal(x.size)
+        for dt in [np.int16, np.uint8, np.int64, np.float32, np.float64]:
+            a = x.astype(dt)
+            if a.dtype.kind == 'f':
+                a[::101] = np.nan
+            _, edges = np.histogram(a, bins=7, range=(0, 10))
+            for weights in [None, w, (w * 10).astype(int), w + 1j * w]:
+                h, _ = np.histogram(a, bins=7, range=(0, 10),
+                                    weights=weights)
+                expected, _ = np.histogram(a, bins=edges, range=(0, 10),
+                                           weights=weights)
+                assert_equal(h.dtype, expected.dtype)
+                assert_allclose(h, expected)
+
+    def test_uniform_bins_threads(self):
+        rng = np.random.RandomState(2)
+        a = rng.standard_normal(300000)
+        w = rng.uniform(size=a.size)
+        expected = [np.histogram(a, bins=50, weights=weights)[0]
+                    for weights in [None, w]]
+        old = np.getthreads()
+        try:
+            np.setthreads(4)
+            h = [np.histogram(a, bins=50, weights=weights)[0]
+                 for weights in [None, w]]
+        finally:
+            np.setthreads(old)
+        assert_equal(h[0], expected[0])
+        assert_allclose(h[1], expected[1])
+
 
 class TestHistogramOptimBinNums(TestCase):
     """
@@ -448,6 +448,35 @@ class TestSaveTxt(TestCase):
             [b'(3.142e+00+2.718e+00j) (3.142e+00+2.718e+00j)\n',
              b'(3.142e+00+2.718e+00j) (3.142e+00+2.718e+00j)\n'])
 
+    def test_format_like_python(self):
+        # the formatting in C gives the same text as the % operator
+        vals = [0., -0., 0.5, 1.5, 2.5, -0.125, 9.5, 0.095, 1/3., -2/3.,
+                123456.789, 1e-7, -1e-300, 5e-324, 1e22,
+                1.7976931348623157e308, 19050., -105., np.nan, np.inf,
+                -np.inf]
+        a = np.array(vals)
+        for fmt in ['%.18e', '%e', '%.0e', '%#.0e', '%12.3E', '%f', '%.0f',
+                    '%#.0f', '%-10.2f', '%+08.3f', '% .4F', '%g', '%.2g',
+                    '%.3g', '%#.3g', '%.17G', '%d', '%5i']:
+            if fmt[-1] in 'di':
+                X = a[np.isfinite(a) & (abs(a) < 1e18)]
+            else:
+                X = a
+            c = BytesIO()
+            np.savetxt(c, X, fmt=fmt)
+            lines = [fmt % x + '\n' for x in X.tolist()]
+            assert_equal(c.getvalue(), asbytes(''.join(lines)))
+
+    def test_format_repr(self):
+        # %r gives the shortest text that reads back as the same value
+        a = np.array([[0.1, 1/3.], [1e-300, -2.5]])
+        for dt in [np.float16, np.float32, np.float64]:
+            c = BytesIO()
+            np.savetxt(c, a.astype(dt), fmt='%r')
+            c.seek(0)
+            assert_equal(np.loadtxt(c, dtype=dt), a.astype(dt))
+            assert_(c.getvalue().startswith(b'0.1 '))
+
     def test_custom_writer(self):
 
         class CustomWriter(list):
@@ -863,6 +892,99 @@ class TestLoadTxt(TestCase):
         dt = np.dtype([('x', int), ('a', 'S10'), ('y', int)])
         np.loadtxt(c, delimiter=',', dtype=dt, comments=None)  # Should succeed
 
+    def test_quotechar(self):
+        txt = '"a, #b",1 # c\n"c""d" ,2\n'
+        dt = np.dtype([('s', 'S8'), ('i', int)])
+        tgt = np.array([(b'a, #b', 1), (b'c"d ', 2)], dtype=dt)
+        x = np.loadtxt(TextIO(txt), delimiter=',', dtype=dt, quotechar='"')
+        assert_array_equal(x, tgt)
+        # object fields are read in Python, with the same splitting
+        x = np.loadtxt(TextIO(txt), delimiter=',', quotechar='"',
+                       dtype=[('s', object), ('i', int)])
+        assert_equal(x['s'].tolist(), ['a, #b', 'c"d '])
+        x = np.loadtxt(TextIO('"a b" 1\n"" 2'), quotechar='"',
+                       dtype=dt)
+        assert_array_equal(x, np.array([(b'a b', 1), (b'', 2)], dtype=dt))
+        assert_raises(ValueError, np.loadtxt, TextIO(txt), quotechar='""')
+
+    def test_values_left_to_converters(self):
+        c = TextIO('nan -inf 0x1p3 1_0\n1.5 2e0 +3. .5')
+        x = np.loadtxt(c)
+        assert_array_equal(x, [[np.nan, -np.inf, 8, 10],
+                               [1.5, 2, 3, 0.5]])
+        x = np.loadtxt(TextIO('1.5 -2e3 7'), dtype=np.int16)
+        assert_array_equal(x, [1, -2000, 7])
+        c = TextIO('1,2\n3,x\n')
+        assert_raises_regex(ValueError, "could not convert", np.loadtxt, c,
+                            delimiter=',')
+        c = TextIO('1,2\n3,4\n')
+        x = np.loadtxt(c, delimiter=',', converters={1: lambda s: -float(s)})
+        assert_array_equal(x, [[1, -2], [3, -4]])
+
+    def test_across_chunks(self):
+        # rows going over the chunks the file is read in
+        rows = ['%d,%s' % (i, 'x' * (i % 97)) for i in range(30000)]
+        rows[1000] = '1000,' + 'y' * (3 << 20)
+        c = TextIO('\n'.join(rows))
+        dt = np.dtype([('i', int), ('s', 'S4')])
+        x = np.loadtxt(c, delimiter=',', dtype=dt)
+        assert_array_equal(x['i'], np.arange(30000))
+        assert_equal(x['s'][1000], b'yyyy')
+        assert_equal(x['s'][1001], b'xxxx')
+
+        with temppath() as name:
+            with open(name, 'w') as f:
+                f.write('\n'.join('%d %r' % (i, i / 3.) for i in range(50000)))
+            x = np.loadtxt(name)
+        assert_array_equal(x[:, 1], np.arange(50000) / 3.)
+
+
+class TestIterLoadTxt(TestCase):
+    def test_chunks(self):
+        data = '# header\n' + '\n'.join('%d %d' % (i, -i) for i in range(10))
+        chunks = list(np.iter_loadtxt(TextIO(data), chunksize=4, dtype=int))
+        assert_equal([len(x) for x in chunks], [4, 4, 2])
+        assert_array_equal(np.concatenate(chunks),
+                           np.loadtxt(TextIO(data), dtype=int))
+
+        dt = np.dtype([('a', 'S2'), ('b', float)])
+        chunks = list(np.iter_loadtxt(TextIO('x,1\ny,2\nz,3'), chunksize=2,
+                                      dtype=dt, delimiter=',',
+                                      converters={1: lambda s: 2 * float(s)}))
+        assert_array_equal(np.concatenate(chunks),
+                           np.array([(b'x', 2), (b'y', 4), (b'z', 6)], dt))
+
+        chunks = list(np.iter_loadtxt(TextIO('1 2 3\n4 5 6'), usecols=1))
+        assert_equal(len(chunks), 1)
+        assert_array_equal(chunks[0], [2, 5])
+
+    def test_reuse_buffer(self):
+        data = '\n'.join('%d,%d' % (i, i) for i in range(7))
+        chunks = [x.copy() for x in np.iter_loadtxt(TextIO(data), chunksize=3,
+                                                    delimiter=',',
+                                                    reuse_buffer=True)]
+        assert_array_equal(np.concatenate(chunks),
+                           np.loadtxt(TextIO(data), delimiter=','))
+        it = np.iter_loadtxt(TextIO(data), chunksize=3, delimiter=',',
+                             reuse_buffer=True)
+        a, b = next(it), next(it)
+        assert_(np.may_share_memory(a, b))
+
+    def test_errors(self):
+        with suppress_warnings() as sup:
+            sup.filter(message='iter_loadtxt: Empty input file:')
+            assert_equal(list(np.iter_loadtxt(TextIO('# only a comment'))),
+                         [])
+        c = TextIO('1 2\n3 4\n5\n')
+        it = np.iter_loadtxt(c, chunksize=1)
+        assert_array_equal(next(it), [[1, 2]])
+        assert_array_equal(next(it), [[3, 4]])
+        assert_raises_regex(ValueError, 'at line 3', next, it)
+        assert_raises(TypeError, list,
+                      np.iter_loadtxt(TextIO('a'), dtype=object))
+        assert_raises(ValueError, list,
+                      np.iter_loadtxt(TextIO('1'), chunksize=0))
+
 
 class Testfromregex(TestCase):
     # np.fromregex expects files opened in binary mode.
@@ -1729,6 +1851,21 @@ M   33  21.99
         self.assertTrue(isinstance(test, np.recarray))
         assert_equal(test, control)
 
+    def test_invalid_and_missing_values(self):
+        data = '#x y\n\n1, 2\n3,\n4, 5, 6\n , z\n7\n  8 ,9  # c\n'
+        with suppress_warnings() as sup:
+            sup.filter(ConversionWarning)
+            test = np.genfromtxt(TextIO(data), delimiter=',',
+                                 invalid_raise=False)
+        assert_equal(test, [[1, 2], [3, np.nan], [np.nan, np.nan], [8, 9]])
+        test = np.genfromtxt(TextIO(data), delimiter=',', dtype=int,
+                             invalid_raise=False, usecols=(0,))
+        assert_equal(test, [1, 3, 4, -1, 7, 8])
+        # counted from the first line with values
+        assert_raises_regex(ValueError, r"Line #3 \(got 3 columns.*\n.*"
+                            r"Line #5 \(got 1 columns", np.genfromtxt,
+                            TextIO(data), delimiter=',')
+
     def test_max_rows(self):
         # Test the `max_rows` keyword argument.
         data = '1 2\n3 4\n5 6\n7 8\n9 10\n'
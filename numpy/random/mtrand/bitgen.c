@@ -0,0 +1,502 @@
+/*
+ * Bit generators other than the Mersenne Twister, see randomkit.h.
+ *
+ * PCG64 is the XSL RR 128/64 permuted congruential generator of
+ * M. E. O'Neill, "PCG: A Family of Simple Fast Space-Efficient
+ * Statistically Good Algorithms for Random Number Generation", 2014.
+ * Philox4x64-10 is the counter based generator of J. K. Salmon et al.,
+ * "Parallel Random Numbers: As Easy as 1, 2, 3", SC11, 2011; its output
+ * is a function of the counter, so streams are advanced in O(1).
+ * xoroshiro128** and its jump polynomial are from D. Blackman and
+ * S. Vigna, "Scrambled Linear Pseudorandom Number Generators", 2018.
+ * SFC64 is from Chris Doty-Humphrey's PractRand.
+ *
+ * Seeds of any length are mixed with splitmix64, so that nearby seeds,
+ * e.g. (seed, 0), (seed, 1), ... give unrelated states.
+ */
+#include <stddef.h>
+#include <string.h>
+#include <time.h>
+
+#include "randomkit.h"
+
+/* 128 bit integers as {high, low} */
+#ifdef __SIZEOF_INT128__
+
+static NPY_INLINE npy_uint64
+rk_umul128(npy_uint64 a, npy_uint64 b, npy_uint64 *hi)
+{
+    __uint128_t r = (__uint128_t)a * b;
+
+    *hi = (npy_uint64)(r >> 64);
+    return (npy_uint64)r;
+}
+
+#else
+
+static NPY_INLINE npy_uint64
+rk_umul128(npy_uint64 a, npy_uint64 b, npy_uint64 *hi)
+{
+    npy_uint64 al = a & 0xffffffffULL, ah = a >> 32;
+    npy_uint64 bl = b & 0xffffffffULL, bh = b >> 32;
+    npy_uint64 ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    npy_uint64 mid = (ll >> 32) + (lh & 0xffffffffULL) + (hl & 0xffffffffULL);
+
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+    return (mid << 32) | (ll & 0xffffffffULL);
+}
+
+#endif
+
+/* r = a * b + c modulo 2**128 */
+static NPY_INLINE void
+rk_u128_muladd(const npy_uint64 *a, const npy_uint64 *b, const npy_uint64 *c,
+               npy_uint64 *r)
+{
+    npy_uint64 hi, lo = rk_umul128(a[1], b[1], &hi);
+
+    hi += a[0] * b[1] + a[1] * b[0];
+    r[1] = lo + c[1];
+    r[0] = hi + c[0] + (r[1] < lo);
+}
+
+static NPY_INLINE npy_uint64
+rk_rotl64(npy_uint64 x, int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+static NPY_INLINE npy_uint64
+rk_rotr64(npy_uint64 x, unsigned int k)
+{
+    return (x >> k) | (x << ((-k) & 63));
+}
+
+static NPY_INLINE npy_uint64
+rk_splitmix64(npy_uint64 *x)
+{
+    npy_uint64 z = (*x += 0x9e3779b97f4a7c15ULL);
+
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+
+static const npy_uint64 pcg64_mult[2] = {
+    0x2360ed051fc65da4ULL, 0x4385df649fccf645ULL
+};
+static const npy_uint64 u128_zero[2] = {0, 0}, u128_one[2] = {0, 1};
+
+static NPY_INLINE npy_uint64
+pcg64_next(rk_pcg64_state *st)
+{
+    npy_uint64 hi, lo;
+
+    rk_u128_muladd(st->state, pcg64_mult, st->inc, st->state);
+    hi = st->state[0];
+    lo = st->state[1];
+    return rk_rotr64(hi ^ lo, (unsigned int)(hi >> 58));
+}
+
+/* Brown's algorithm, the state after delta steps in O(log delta) */
+static void
+pcg64_advance(rk_pcg64_state *st, npy_uint64 delta_hi, npy_uint64 delta_lo)
+{
+    npy_uint64 acc_mult[2] = {0, 1}, acc_plus[2] = {0, 0};
+    npy_uint64 cur_mult[2], cur_plus[2], t[2];
+
+    memcpy(cur_mult, pcg64_mult, sizeof(cur_mult));
+    memcpy(cur_plus, st->inc, sizeof(cur_plus));
+    while (delta_hi != 0 || delta_lo != 0) {
+        if (delta_lo & 1) {
+            rk_u128_muladd(acc_mult, cur_mult, u128_zero, acc_mult);
+            rk_u128_muladd(acc_plus, cur_mult, cur_plus, acc_plus);
+        }
+        /* cur_plus = (cur_mult + 1) * cur_plus */
+        t[1] = cur_mult[1] + 1;
+        t[0] = cur_mult[0] + (t[1] == 0);
+        rk_u128_muladd(t, cur_plus, u128_zero, cur_plus);
+        rk_u128_muladd(cur_mult, cur_mult, u128_zero, cur_mult);
+        delta_lo = (delta_lo >> 1) | (delta_hi << 63);
+        delta_hi >>= 1;
+    }
+    rk_u128_muladd(acc_mult, st->state, acc_plus, st->state);
+}
+
+
+#define PHILOX_M0 0xd2e7470ee14c6c93ULL
+#define PHILOX_M1 0xca5a826395121157ULL
+#define PHILOX_W0 0x9e3779b97f4a7c15ULL
+#define PHILOX_W1 0xbb67ae8584caa73bULL
+
+static NPY_INLINE void
+philox_round(npy_uint64 *x, const npy_uint64 *k)
+{
+    npy_uint64 hi0, hi1, lo0, lo1;
+
+    lo0 = rk_umul128(PHILOX_M0, x[0], &hi0);
+    lo1 = rk_umul128(PHILOX_M1, x[2], &hi1);
+    x[0] = hi1 ^ x[1] ^ k[0];
+    x[1] = lo1;
+    x[2] = hi0 ^ x[3] ^ k[1];
+    x[3] = lo0;
+}
+
+/* the four outputs for counter ctr */
+static void
+philox_block(const npy_uint64 *ctr, const npy_uint64 *key, npy_uint64 *out)
+{
+    npy_uint64 k[2];
+    int r;
+
+    memcpy(out, ctr, 4 * sizeof(npy_uint64));
+    memcpy(k, key, sizeof(k));
+    for (r = 0; r < 10; r++) {
+        if (r > 0) {
+            k[0] += PHILOX_W0;
+            k[1] += PHILOX_W1;
+        }
+        philox_round(out, k);
+    }
+}
+
+/* add delta to the 256 bit counter starting at word i */
+static void
+philox_add(npy_uint64 *ctr, int i, npy_uint64 delta)
+{
+    for (; i < 4 && delta != 0; i++) {
+        ctr[i] += delta;
+        delta = ctr[i] < delta;
+    }
+}
+
+static NPY_INLINE npy_uint64
+philox_next(rk_philox_state *st)
+{
+    if (st->pos == 4) {
+        philox_block(st->ctr, st->key, st->buffer);
+        philox_add(st->ctr, 0, 1);
+        st->pos = 0;
+    }
+    return st->buffer[st->pos++];
+}
+
+
+static NPY_INLINE npy_uint64
+xoroshiro_next(rk_xoroshiro_state *st)
+{
+    npy_uint64 s0 = st->s[0], s1 = st->s[1];
+    npy_uint64 r = rk_rotl64(s0 * 5, 7) * 9;
+
+    s1 ^= s0;
+    st->s[0] = rk_rotl64(s0, 24) ^ s1 ^ (s1 << 16);
+    st->s[1] = rk_rotl64(s1, 37);
+    return r;
+}
+
+static void
+xoroshiro_jump(rk_xoroshiro_state *st)
+{
+    static const npy_uint64 jump[2] = {
+        0xdf900294d8f554a5ULL, 0x170865df4b3201fcULL
+    };
+    npy_uint64 s0 = 0, s1 = 0;
+    int i, b;
+
+    for (i = 0; i < 2; i++) {
+        for (b = 0; b < 64; b++) {
+            if (jump[i] & (1ULL << b)) {
+                s0 ^= st->s[0];
+                s1 ^= st->s[1];
+            }
+            xoroshiro_next(st);
+        }
+    }
+    st->s[0] = s0;
+    st->s[1] = s1;
+}
+
+
+static NPY_INLINE npy_uint64
+sfc64_next(rk_sfc64_state *st)
+{
+    npy_uint64 r = st->a + st->b + st->w++;
+
+    st->a = st->b ^ (st->b >> 11);
+    st->b = st->c + (st->c << 3);
+    st->c = rk_rotl64(st->c, 24) + r;
+    return r;
+}
+
+
+npy_uint64
+rk_brng_next64(rk_state *state)
+{
+    switch (state->brng) {
+        case RK_PCG64:
+            return pcg64_next(&state->bits.pcg64);
+        case RK_PHILOX4X64:
+            return philox_next(&state->bits.philox);
+        case RK_XOROSHIRO128:
+            return xoroshiro_next(&state->bits.xoroshiro);
+        default:
+            return sfc64_next(&state->bits.sfc64);
+    }
+}
+
+void
+rk_brng_fill64(npy_intp cnt, npy_uint64 *out, rk_state *state)
+{
+    npy_intp i;
+
+    switch (state->brng) {
+        case RK_PCG64:
+            for (i = 0; i < cnt; i++) {
+                out[i] = pcg64_next(&state->bits.pcg64);
+            }
+            break;
+        case RK_PHILOX4X64:
+            for (i = 0; i < cnt; i++) {
+                out[i] = philox_next(&state->bits.philox);
+            }
+            break;
+        case RK_XOROSHIRO128:
+            for (i = 0; i < cnt; i++) {
+                out[i] = xoroshiro_next(&state->bits.xoroshiro);
+            }
+            break;
+        default:
+            for (i = 0; i < cnt; i++) {
+                out[i] = sfc64_next(&state->bits.sfc64);
+            }
+            break;
+    }
+}
+
+static void
+rk_brng_reset(rk_state *state)
+{
+    state->has_uint32 = 0;
+    state->gauss = 0;
+    state->has_gauss = 0;
+    state->has_binomial = 0;
+}
+
+void
+rk_seed_brng(rk_brng brng, const npy_uint64 *seed, npy_intp n,
+             rk_state *state)
+{
+    npy_uint64 x = 0, w[4];
+    npy_intp i;
+    int k;
+
+    for (i = 0; i < n; i++) {
+        x ^= seed[i];
+        x = rk_splitmix64(&x);
+    }
+    for (k = 0; k < 4; k++) {
+        w[k] = rk_splitmix64(&x);
+    }
+    state->brng = brng;
+    rk_brng_reset(state);
+    switch (brng) {
+        case RK_PCG64: {
+            rk_pcg64_state *st = &state->bits.pcg64;
+            npy_uint64 init[2];
+
+            /* pcg64_srandom_r with initstate w[0:2], initseq w[2:4] */
+            init[0] = w[0];
+            init[1] = w[1];
+            st->inc[0] = (w[2] << 1) | (w[3] >> 63);
+            st->inc[1] = (w[3] << 1) | 1;
+            st->state[0] = st->state[1] = 0;
+            pcg64_next(st);
+            rk_u128_muladd(st->state, u128_one, init, st->state);
+            pcg64_next(st);
+            break;
+        }
+        case RK_PHILOX4X64: {
+            rk_philox_state *st = &state->bits.philox;
+
+            memset(st->ctr, 0, sizeof(st->ctr));
+            st->key[0] = w[0];
+            st->key[1] = w[1];
+            st->pos = 4;
+            break;
+        }
+        case RK_XOROSHIRO128: {
+            rk_xoroshiro_state *st = &state->bits.xoroshiro;
+
+            st->s[0] = w[0];
+            /* the all zero state is a fixed point */
+            st->s[1] = (w[0] | w[1]) ? w[1] : 1;
+            break;
+        }
+        default: {
+            rk_sfc64_state *st = &state->bits.sfc64;
+
+            st->a = w[0];
+            st->b = w[1];
+            st->c = w[2];
+            st->w = 1;
+            for (k = 0; k < 12; k++) {
+                sfc64_next(st);
+            }
+            break;
+        }
+    }
+}
+
+rk_error
+rk_randomseed_brng(rk_brng brng, rk_state *state)
+{
+    npy_uint64 seed[4];
+    rk_error err;
+
+    err = rk_devfill(seed, sizeof(seed), 0);
+    if (err != RK_NOERR) {
+        /* an MT19937 seeded from the clock */
+        rk_randomseed(state);
+        seed[0] = rk_random64(state);
+        seed[1] = rk_random64(state);
+        seed[2] = (npy_uint64)time(NULL);
+        seed[3] = (npy_uint64)clock();
+    }
+    rk_seed_brng(brng, seed, 4, state);
+    return err;
+}
+
+int
+rk_advance(npy_uint64 delta_hi, npy_uint64 delta_lo, rk_state *state)
+{
+    switch (state->brng) {
+        case RK_PCG64:
+            pcg64_advance(&state->bits.pcg64, delta_hi, delta_lo);
+            break;
+        case RK_PHILOX4X64:
+            philox_add(state->bits.philox.ctr, 0, delta_lo);
+            philox_add(state->bits.philox.ctr, 1, delta_hi);
+            state->bits.philox.pos = 4;
+            break;
+        default:
+            return -1;
+    }
+    rk_brng_reset(state);
+    return 0;
+}
+
+int
+rk_jump(rk_state *state)
+{
+    switch (state->brng) {
+        case RK_PCG64:
+            pcg64_advance(&state->bits.pcg64, 1, 0);
+            break;
+        case RK_PHILOX4X64:
+            philox_add(state->bits.philox.ctr, 2, 1);
+            state->bits.philox.pos = 4;
+            break;
+        case RK_XOROSHIRO128:
+            xoroshiro_jump(&state->bits.xoroshiro);
+            break;
+        default:
+            return -1;
+    }
+    rk_brng_reset(state);
+    return 0;
+}
+
+npy_intp
+rk_brng_state_size(rk_brng brng)
+{
+    /* the generator, has_uint32 and uinteger */
+    switch (brng) {
+        case RK_PCG64:
+            return 4 + 2;
+        case RK_PHILOX4X64:
+            return 11 + 2;
+        case RK_XOROSHIRO128:
+            return 2 + 2;
+        case RK_SFC64:
+            return 4 + 2;
+        default:
+            return 0;
+    }
+}
+
+void
+rk_brng_get_state(rk_state *state, npy_uint64 *words)
+{
+    npy_intp n = rk_brng_state_size(state->brng) - 2;
+
+    switch (state->brng) {
+        case RK_PCG64:
+            memcpy(words, state->bits.pcg64.state, 2 * sizeof(npy_uint64));
+            memcpy(words + 2, state->bits.pcg64.inc, 2 * sizeof(npy_uint64));
+            break;
+        case RK_PHILOX4X64:
+            memcpy(words, state->bits.philox.ctr, 4 * sizeof(npy_uint64));
+            memcpy(words + 4, state->bits.philox.key, 2 * sizeof(npy_uint64));
+            memcpy(words + 6, state->bits.philox.buffer,
+                   4 * sizeof(npy_uint64));
+            words[10] = state->bits.philox.pos;
+            break;
+        case RK_XOROSHIRO128:
+            memcpy(words, state->bits.xoroshiro.s, 2 * sizeof(npy_uint64));
+            break;
+        default:
+            words[0] = state->bits.sfc64.a;
+            words[1] = state->bits.sfc64.b;
+            words[2] = state->bits.sfc64.c;
+            words[3] = state->bits.sfc64.w;
+            break;
+    }
+    words[n] = state->has_uint32;
+    words[n + 1] = state->uinteger;
+}
+
+int
+rk_brng_set_state(rk_brng brng, const npy_uint64 *words, rk_state *state)
+{
+    npy_intp n = rk_brng_state_size(brng) - 2;
+
+    if (n < 0 || words[n] > 1 || words[n + 1] > 0xffffffffULL) {
+        return -1;
+    }
+    switch (brng) {
+        case RK_PCG64:
+            if ((words[3] & 1) == 0) {
+                return -1;
+            }
+            memcpy(state->bits.pcg64.state, words, 2 * sizeof(npy_uint64));
+            memcpy(state->bits.pcg64.inc, words + 2, 2 * sizeof(npy_uint64));
+            break;
+        case RK_PHILOX4X64:
+            if (words[10] > 4) {
+                return -1;
+            }
+            memcpy(state->bits.philox.ctr, words, 4 * sizeof(npy_uint64));
+            memcpy(state->bits.philox.key, words + 4, 2 * sizeof(npy_uint64));
+            memcpy(state->bits.philox.buffer, words + 6,
+                   4 * sizeof(npy_uint64));
+            state->bits.philox.pos = (int)words[10];
+            break;
+        case RK_XOROSHIRO128:
+            if (words[0] == 0 && words[1] == 0) {
+                return -1;
+            }
+            memcpy(state->bits.xoroshiro.s, words, 2 * sizeof(npy_uint64));
+            break;
+        default:
+            state->bits.sfc64.a = words[0];
+            state->bits.sfc64.b = words[1];
+            state->bits.sfc64.c = words[2];
+            state->bits.sfc64.w = words[3];
+            break;
+    }
+    state->brng = brng;
+    state->has_uint32 = (int)words[n];
+    state->uinteger = (npy_uint32)words[n + 1];
+    return 0;
+}
@@ -44,6 +44,7 @@
 #include <math.h>
 #include <stdlib.h>
 #include "distributions.h"
+#include "ziggurat.h"
 #include <stdio.h>
 
 #ifndef min
@@ -112,6 +113,17 @@ double rk_standard_exponential(rk_state *state)
     return -log(1.0 - rk_double(state));
 }
 
+void rk_fill_standard_exponential(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+
+    rk_fill_double(cnt, out, state);
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = -log(1.0 - out[i]);
+    }
+}
+
 double rk_exponential(rk_state *state, double scale)
 {
     return scale * rk_standard_exponential(state);
@@ -176,6 +188,313 @@ double rk_standard_gamma(rk_state *state, double shape)
     }
 }
 
+/*
+ * Ziggurat samplers.  The low bits of a random word select the layer, the
+ * rest give the abscissa, which is accepted outright when it falls inside
+ * the rectangle under the density.  Only the wedges and the tail need the
+ * density or more uniform draws.
+ */
+
+static float rk_float(rk_state *state)
+{
+    return (rk_random(state) >> 8) * (1.0f / 16777216.0f);
+}
+
+double rk_gauss_zig(rk_state *state)
+{
+    npy_uint64 r, rabs;
+    int idx, sign;
+    double x, xx, yy;
+
+    for (;;)
+    {
+        r = rk_random64(state);
+        idx = r & 0xff;
+        sign = (r >> 8) & 0x1;
+        rabs = (r >> 9) & 0x000fffffffffffffULL;
+        x = (double)(npy_int64)rabs * wn_double[idx];
+        if (sign)
+        {
+            x = -x;
+        }
+        if (rabs < kn_double[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            /* tail beyond ZIGGURAT_NOR_R, (Marsaglia 1964) */
+            for (;;)
+            {
+                xx = -ZIGGURAT_NOR_INV_R * log(1.0 - rk_double(state));
+                yy = -log(1.0 - rk_double(state));
+                if (yy + yy > xx * xx)
+                {
+                    return sign ? -(ZIGGURAT_NOR_R + xx) : ZIGGURAT_NOR_R + xx;
+                }
+            }
+        }
+        if ((fn_double[idx - 1] - fn_double[idx]) * rk_double(state) +
+                fn_double[idx] < exp(-0.5 * x * x))
+        {
+            return x;
+        }
+    }
+}
+
+double rk_standard_exponential_zig(rk_state *state)
+{
+    npy_uint64 r;
+    int idx;
+    double x;
+
+    for (;;)
+    {
+        r = rk_random64(state) >> 3;
+        idx = r & 0xff;
+        r >>= 8;
+        x = (double)(npy_int64)r * we_double[idx];
+        if (r < ke_double[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            /* the tail is again exponential */
+            return ZIGGURAT_EXP_R - log(1.0 - rk_double(state));
+        }
+        if ((fe_double[idx - 1] - fe_double[idx]) * rk_double(state) +
+                fe_double[idx] < exp(-x))
+        {
+            return x;
+        }
+    }
+}
+
+double rk_standard_gamma_zig(rk_state *state, double shape)
+{
+    double b, c;
+    double U, V, X, Y;
+
+    if (shape == 1.0)
+    {
+        return rk_standard_exponential_zig(state);
+    }
+    else if (shape < 1.0)
+    {
+        for (;;)
+        {
+            U = rk_double(state);
+            V = rk_standard_exponential_zig(state);
+            if (U <= 1.0 - shape)
+            {
+                X = pow(U, 1./shape);
+                if (X <= V)
+                {
+                    return X;
+                }
+            }
+            else
+            {
+                Y = -log((1-U)/shape);
+                X = pow(1.0 - shape + shape*Y, 1./shape);
+                if (X <= (V + Y))
+                {
+                    return X;
+                }
+            }
+        }
+    }
+    else
+    {
+        b = shape - 1./3.;
+        c = 1./sqrt(9*b);
+        for (;;)
+        {
+            do
+            {
+                X = rk_gauss_zig(state);
+                V = 1.0 + c*X;
+            } while (V <= 0.0);
+
+            V = V*V*V;
+            U = rk_double(state);
+            if (U < 1.0 - 0.0331*(X*X)*(X*X)) return (b*V);
+            if (log(U) < 0.5*X*X + b*(1. - V + log(V))) return (b*V);
+        }
+    }
+}
+
+float rk_gauss_zig_f(rk_state *state)
+{
+    npy_uint32 r, rabs;
+    int idx, sign;
+    float x, xx, yy;
+
+    for (;;)
+    {
+        r = (npy_uint32)rk_random(state);
+        idx = r & 0xff;
+        sign = (r >> 8) & 0x1;
+        rabs = r >> 9;
+        x = (float)(npy_int32)rabs * wn_float[idx];
+        if (sign)
+        {
+            x = -x;
+        }
+        if (rabs < kn_float[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            for (;;)
+            {
+                xx = -(float)ZIGGURAT_NOR_INV_R * logf(1.0f - rk_float(state));
+                yy = -logf(1.0f - rk_float(state));
+                if (yy + yy > xx * xx)
+                {
+                    return sign ? -((float)ZIGGURAT_NOR_R + xx)
+                                : (float)ZIGGURAT_NOR_R + xx;
+                }
+            }
+        }
+        if ((fn_float[idx - 1] - fn_float[idx]) * rk_float(state) +
+                fn_float[idx] < expf(-0.5f * x * x))
+        {
+            return x;
+        }
+    }
+}
+
+float rk_standard_exponential_zig_f(rk_state *state)
+{
+    npy_uint32 r;
+    int idx;
+    float x;
+
+    for (;;)
+    {
+        r = (npy_uint32)rk_random(state) >> 1;
+        idx = r & 0xff;
+        r >>= 8;
+        x = (float)(npy_int32)r * we_float[idx];
+        if (r < ke_float[idx])
+        {
+            return x;
+        }
+        if (idx == 0)
+        {
+            return (float)ZIGGURAT_EXP_R - logf(1.0f - rk_float(state));
+        }
+        if ((fe_float[idx - 1] - fe_float[idx]) * rk_float(state) +
+                fe_float[idx] < expf(-x))
+        {
+            return x;
+        }
+    }
+}
+
+float rk_standard_gamma_zig_f(rk_state *state, float shape)
+{
+    float b, c;
+    float U, V, X, Y;
+
+    if (shape == 1.0f)
+    {
+        return rk_standard_exponential_zig_f(state);
+    }
+    else if (shape < 1.0f)
+    {
+        for (;;)
+        {
+            U = rk_float(state);
+            V = rk_standard_exponential_zig_f(state);
+            if (U <= 1.0f - shape)
+            {
+                X = powf(U, 1.0f/shape);
+                if (X <= V)
+                {
+                    return X;
+                }
+            }
+            else
+            {
+                Y = -logf((1.0f - U)/shape);
+                X = powf(1.0f - shape + shape*Y, 1.0f/shape);
+                if (X <= (V + Y))
+                {
+                    return X;
+                }
+            }
+        }
+    }
+    else
+    {
+        b = shape - 1.0f/3.0f;
+        c = 1.0f/sqrtf(9.0f*b);
+        for (;;)
+        {
+            do
+            {
+                X = rk_gauss_zig_f(state);
+                V = 1.0f + c*X;
+            } while (V <= 0.0f);
+
+            V = V*V*V;
+            U = rk_float(state);
+            if (U < 1.0f - 0.0331f*(X*X)*(X*X)) return (b*V);
+            if (logf(U) < 0.5f*X*X + b*(1.0f - V + logf(V))) return (b*V);
+        }
+    }
+}
+
+/*
+ * The fillers call the samplers above in a loop the compiler can inline
+ * them into, which gives the same stream as calling them one by one.
+ */
+void rk_fill_gauss_zig(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = rk_gauss_zig(state);
+    }
+}
+
+void rk_fill_standard_exponential_zig(npy_intp cnt, double *out,
+                                      rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = rk_standard_exponential_zig(state);
+    }
+}
+
+void rk_fill_gauss_zig_f(npy_intp cnt, float *out, rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = rk_gauss_zig_f(state);
+    }
+}
+
+void rk_fill_standard_exponential_zig_f(npy_intp cnt, float *out,
+                                        rk_state *state)
+{
+    npy_intp i;
+
+    for (i = 0; i < cnt; i++)
+    {
+        out[i] = rk_standard_exponential_zig_f(state);
+    }
+}
+
 double rk_gamma(rk_state *state, double shape, double scale)
 {
     return scale * rk_standard_gamma(state, shape);
@@ -45,6 +45,9 @@ extern "C" {
  * Marsaglia, G. and Tsang, W. W. A Simple Method for Generating Gamma
  * Variables. ACM Transactions on Mathematical Software, Vol. 26, No. 3,
  * September 2000, Pages 363–372.
+ *
+ * Marsaglia, G. and Tsang, W. W. The Ziggurat Method for Generating Random
+ * Variables. Journal of Statistical Software, Vol. 5, Issue 8, 2000.
  */
 
 /* Normal distribution with mean=loc and standard deviation=scale. */
@@ -54,6 +57,12 @@ extern double rk_normal(rk_state *state, double loc, double scale);
  * CDF. */
 extern double rk_standard_exponential(rk_state *state);
 
+/* Fill out with cnt standard exponential variates, the same values as cnt
+ * calls of rk_standard_exponential.  The fillers below likewise match their
+ * samplers. */
+extern void rk_fill_standard_exponential(npy_intp cnt, double *out,
+                                         rk_state *state);
+
 /* Exponential distribution with mean=scale. */
 extern double rk_exponential(rk_state *state, double scale);
 
@@ -68,6 +77,29 @@ extern double rk_uniform(rk_state *state, double loc, double scale);
  */
 extern double rk_standard_gamma(rk_state *state, double shape);
 
+/* Standard normal, standard exponential and standard gamma distributions
+ * using the 256 layer ziggurat of (Marsaglia and Tsang 2000).  They are
+ * several times faster than rk_gauss and rk_standard_exponential but draw a
+ * different stream.  The standard gamma uses the same algorithms as
+ * rk_standard_gamma on top of the ziggurat variates.
+ */
+extern double rk_gauss_zig(rk_state *state);
+extern double rk_standard_exponential_zig(rk_state *state);
+extern double rk_standard_gamma_zig(rk_state *state, double shape);
+
+/* Single precision versions of the ziggurat samplers, drawing one 32 bit
+ * word per sample in the common case. */
+extern float rk_gauss_zig_f(rk_state *state);
+extern float rk_standard_exponential_zig_f(rk_state *state);
+extern float rk_standard_gamma_zig_f(rk_state *state, float shape);
+
+extern void rk_fill_gauss_zig(npy_intp cnt, double *out, rk_state *state);
+extern void rk_fill_standard_exponential_zig(npy_intp cnt, double *out,
+                                             rk_state *state);
+extern void rk_fill_gauss_zig_f(npy_intp cnt, float *out, rk_state *state);
+extern void rk_fill_standard_exponential_zig_f(npy_intp cnt, float *out,
+                                               rk_state *state);
+
 /* Gamma distribution with shape and scale. */
 extern double rk_gamma(rk_state *state, double shape, double scale);
 
@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+"""
+Generate ziggurat.h, the tables of the 256 layer ziggurat samplers in
+distributions.c.
+
+The layers follow Marsaglia and Tsang, "The Ziggurat Method for Generating
+Random Variables", Journal of Statistical Software 5 (2000).  The double
+tables are indexed with 52 (normal) or 53 (exponential) random bits, the
+float tables with 23 bits.
+
+Usage: python generate_ziggurat.py > ziggurat.h
+"""
+from __future__ import division, absolute_import, print_function
+
+import math
+
+NLAYERS = 256
+
+# Right edge of the base layer for 256 layers.
+NOR_R = 3.6541528853610087963519472518
+EXP_R = 7.6971174701310497140446280481
+
+
+def nor_f(x):
+    return math.exp(-0.5 * x * x)
+
+
+def nor_finv(y):
+    return math.sqrt(-2.0 * math.log(y))
+
+
+def exp_f(x):
+    return math.exp(-x)
+
+
+def exp_finv(y):
+    return -math.log(y)
+
+
+def tables(r, v, f, finv, m):
+    """k, w and f tables of a ziggurat with base edge r and layer area v.
+
+    Layer ``i`` accepts ``j * w[i]`` outright when ``j < k[i]``, where ``j``
+    is an integer below ``m``.  ``f`` is the density at the layer edges,
+    decreasing from ``f[0] = 1``.
+    """
+    k = [0] * NLAYERS
+    w = [0.0] * NLAYERS
+    fs = [0.0] * NLAYERS
+    q = v / f(r)
+    k[0] = int((r / q) * m)
+    k[1] = 0
+    w[0] = q / m
+    w[NLAYERS - 1] = r / m
+    fs[0] = 1.0
+    fs[NLAYERS - 1] = f(r)
+    x = t = r
+    for i in range(NLAYERS - 2, 0, -1):
+        x = finv(v / x + f(x))
+        k[i + 1] = int((x / t) * m)
+        t = x
+        fs[i] = f(x)
+        w[i] = x / m
+    # the top layer must close the ziggurat at the mode
+    assert abs(x * (1.0 - f(x)) - v) < 1e-12 * NLAYERS
+    return k, w, fs
+
+
+def emit(ctype, name, values, fmt, per_line):
+    print("static const %s %s[%d] = {" % (ctype, name, len(values)))
+    for i in range(0, len(values), per_line):
+        chunk = values[i:i + per_line]
+        print("    " + ", ".join(fmt(x) for x in chunk) +
+              ("," if i + per_line < len(values) else ""))
+    print("};")
+    print()
+
+
+def main():
+    nor_v = NOR_R * nor_f(NOR_R) + \
+        math.sqrt(math.pi / 2) * math.erfc(NOR_R / math.sqrt(2))
+    exp_v = (EXP_R + 1.0) * exp_f(EXP_R)
+
+    print("/*")
+    print(" * Tables of the ziggurat normal and exponential samplers.")
+    print(" *")
+    print(" * Generated by generate_ziggurat.py, do not edit.")
+    print(" */")
+    print("#ifndef _RK_ZIGGURAT_")
+    print("#define _RK_ZIGGURAT_")
+    print()
+    print("#define ZIGGURAT_NOR_R %.17g" % NOR_R)
+    print("#define ZIGGURAT_NOR_INV_R %.17g" % (1.0 / NOR_R))
+    print("#define ZIGGURAT_EXP_R %.17g" % EXP_R)
+    print()
+
+    u64 = lambda x: "0x%016xULL" % x
+    u32 = lambda x: "0x%08xUL" % x
+    dbl = lambda x: "%.17e" % x
+    flt = lambda x: "%.9ef" % x
+
+    for kind, r, v, f, finv, bits in (
+            ("nor", NOR_R, nor_v, nor_f, nor_finv, (52, 23)),
+            ("exp", EXP_R, exp_v, exp_f, exp_finv, (53, 23))):
+        k, w, fs = tables(r, v, f, finv, 2.0**bits[0])
+        emit("npy_uint64", "k%s_double" % kind[0], k, u64, 3)
+        emit("double", "w%s_double" % kind[0], w, dbl, 3)
+        emit("double", "f%s_double" % kind[0], fs, dbl, 3)
+        k, w, fs = tables(r, v, f, finv, 2.0**bits[1])
+        emit("npy_uint32", "k%s_float" % kind[0], k, u32, 5)
+        emit("float", "w%s_float" % kind[0], w, flt, 4)
+        emit("float", "f%s_float" % kind[0], fs, flt, 4)
+
+    print("#endif")
+
+
+if __name__ == '__main__':
+    main()
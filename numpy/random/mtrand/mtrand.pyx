@@ -43,11 +43,20 @@ cdef extern from "mtrand_py_helper.h":
 
 cdef extern from "randomkit.h":
 
+    ctypedef enum rk_brng:
+        RK_MT19937 = 0
+        RK_PCG64 = 1
+        RK_PHILOX4X64 = 2
+        RK_XOROSHIRO128 = 3
+        RK_SFC64 = 4
+
     ctypedef struct rk_state:
         unsigned long key[624]
         int pos
         int has_gauss
         double gauss
+        int brng
+        int has_uint32
 
     ctypedef enum rk_error:
         RK_NOERR = 0
@@ -61,6 +70,15 @@ cdef extern from "randomkit.h":
 
     void rk_seed(unsigned long seed, rk_state *state)
     rk_error rk_randomseed(rk_state *state)
+    void rk_seed_brng(rk_brng brng, npy_uint64 *seed, npy_intp n,
+                      rk_state *state)
+    rk_error rk_randomseed_brng(rk_brng brng, rk_state *state)
+    int rk_advance(npy_uint64 delta_hi, npy_uint64 delta_lo,
+                   rk_state *state) nogil
+    int rk_jump(rk_state *state) nogil
+    npy_intp rk_brng_state_size(rk_brng brng)
+    void rk_brng_get_state(rk_state *state, npy_uint64 *words)
+    int rk_brng_set_state(rk_brng brng, npy_uint64 *words, rk_state *state)
     unsigned long rk_random(rk_state *state)
     long rk_long(rk_state *state) nogil
     unsigned long rk_ulong(rk_state *state) nogil
@@ -71,6 +89,8 @@ cdef extern from "randomkit.h":
     rk_error rk_altfill(void *buffer, size_t size, int strong,
             rk_state *state) nogil
     double rk_gauss(rk_state *state) nogil
+    void rk_fill_double(npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_gauss(npy_intp cnt, double *out, rk_state *state) nogil
     void rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
                           npy_uint64 *out, rk_state *state) nogil
     void rk_random_uint32(npy_uint32 off, npy_uint32 rng, npy_intp cnt,
@@ -92,6 +112,20 @@ cdef extern from "distributions.h":
     double rk_uniform(rk_state *state, double loc, double scale) nogil
     double rk_standard_gamma(rk_state *state, double shape) nogil
     double rk_gamma(rk_state *state, double shape, double scale) nogil
+    double rk_gauss_zig(rk_state *state) nogil
+    double rk_standard_exponential_zig(rk_state *state) nogil
+    double rk_standard_gamma_zig(rk_state *state, double shape) nogil
+    float rk_gauss_zig_f(rk_state *state) nogil
+    float rk_standard_exponential_zig_f(rk_state *state) nogil
+    float rk_standard_gamma_zig_f(rk_state *state, float shape) nogil
+    void rk_fill_standard_exponential(npy_intp cnt, double *out,
+                                      rk_state *state) nogil
+    void rk_fill_gauss_zig(npy_intp cnt, double *out, rk_state *state) nogil
+    void rk_fill_standard_exponential_zig(npy_intp cnt, double *out,
+                                          rk_state *state) nogil
+    void rk_fill_gauss_zig_f(npy_intp cnt, float *out, rk_state *state) nogil
+    void rk_fill_standard_exponential_zig_f(npy_intp cnt, float *out,
+                                            rk_state *state) nogil
     double rk_beta(rk_state *state, double a, double b) nogil
     double rk_chisquare(rk_state *state, double df) nogil
     double rk_noncentral_chisquare(rk_state *state, double df, double nonc) nogil
@@ -128,6 +162,11 @@ ctypedef double (* rk_cont1)(rk_state *state, double a) nogil
 ctypedef double (* rk_cont2)(rk_state *state, double a, double b) nogil
 ctypedef double (* rk_cont3)(rk_state *state, double a, double b, double c) nogil
 
+ctypedef float (* rk_cont1_f)(rk_state *state, float a) nogil
+
+ctypedef void (* rk_fill0)(npy_intp cnt, double *out, rk_state *state) nogil
+ctypedef void (* rk_fill0_f)(npy_intp cnt, float *out, rk_state *state) nogil
+
 ctypedef long (* rk_disc0)(rk_state *state) nogil
 ctypedef long (* rk_discnp)(rk_state *state, long n, double p) nogil
 ctypedef long (* rk_discdd)(rk_state *state, double n, double p) nogil
@@ -139,9 +178,15 @@ cdef extern from "initarray.h":
    void init_by_array(rk_state *self, unsigned long *init_key,
                       npy_intp key_length)
 
+cdef extern from "npy_cpu_features.h":
+    int npy_cpu_init() except -1
+
 # Initialize numpy
 import_array()
 
+# Select the simd loops of the Mersenne Twister for this cpu
+npy_cpu_init()
+
 cimport cython
 import numpy as np
 import operator
@@ -152,6 +197,52 @@ try:
 except ImportError:
     from dummy_threading import Lock
 
+# names of the bit generators, indexed by rk_brng
+_brng_names = ('MT19937', 'PCG64', 'Philox4x64', 'Xoroshiro128', 'SFC64')
+
+cdef int _brng_index(name) except -1:
+    try:
+        key = name.lower()
+    except AttributeError:
+        key = None
+    for i, brng in enumerate(_brng_names):
+        if key == brng.lower():
+            return i
+    raise ValueError("bit generator must be one of %s, not %r"
+                     % (", ".join(_brng_names), name))
+
+cdef object _seed_words(seed):
+    """The seed of a bit generator other than MT19937 as uint64 words."""
+    try:
+        seeds = [operator.index(seed)]
+    except TypeError:
+        seeds = [operator.index(x) for x in
+                 np.asarray(seed, dtype=object).ravel()]
+    words = []
+    for x in seeds:
+        if x < 0:
+            raise ValueError("Seed must be non-negative")
+        words.append(x & 0xffffffffffffffff)
+        x >>= 64
+        while x:
+            words.append(x & 0xffffffffffffffff)
+            x >>= 64
+    return np.array(words, dtype=np.uint64)
+
+cdef int _use_ziggurat(method) except -1:
+    if method == 'legacy':
+        return 0
+    elif method == 'zig':
+        return 1
+    raise ValueError("method must be 'legacy' or 'zig', not %r" % (method,))
+
+cdef object _float_dtype(dtype):
+    dtype = np.dtype(dtype)
+    if dtype != np.float64 and dtype != np.float32:
+        raise TypeError("Unsupported dtype %r, must be float64 or float32"
+                        % (dtype,))
+    return dtype
+
 cdef object cont0_array(rk_state *state, rk_cont0 func, object size,
                         object lock):
     cdef double *array_data
@@ -227,6 +318,123 @@ cdef object cont1_array(rk_state *state, rk_cont1 func, object size,
                 PyArray_MultiIter_NEXTi(multi, 1)
     return array
 
+cdef object cont0_fill(rk_state *state, rk_fill0 func, object size,
+                       object lock):
+    cdef double *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+    cdef double rv
+
+    if size is None:
+        with lock, nogil:
+            func(1, &rv, state)
+        return rv
+    else:
+        array = <ndarray>np.empty(size, np.float64)
+        length = PyArray_SIZE(array)
+        array_data = <double *>PyArray_DATA(array)
+        with lock, nogil:
+            func(length, array_data, state)
+        return array
+
+cdef object cont2_fill_sc(rk_state *state, rk_fill0 func, object size,
+                          double loc, double scale, object lock):
+    # loc + scale*x of the filled variates, as rk_normal and rk_uniform
+    cdef double *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+    cdef npy_intp i
+    cdef double rv
+
+    if size is None:
+        with lock, nogil:
+            func(1, &rv, state)
+        return loc + scale*rv
+    else:
+        array = <ndarray>np.empty(size, np.float64)
+        length = PyArray_SIZE(array)
+        array_data = <double *>PyArray_DATA(array)
+        with lock, nogil:
+            func(length, array_data, state)
+        with nogil:
+            for i from 0 <= i < length:
+                array_data[i] = loc + scale*array_data[i]
+        return array
+
+cdef object cont0_fill_f(rk_state *state, rk_fill0_f func, object size,
+                         object lock):
+    cdef float *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+    cdef float rv
+
+    if size is None:
+        with lock, nogil:
+            func(1, &rv, state)
+        return np.float32(rv)
+    else:
+        array = <ndarray>np.empty(size, np.float32)
+        length = PyArray_SIZE(array)
+        array_data = <float *>PyArray_DATA(array)
+        with lock, nogil:
+            func(length, array_data, state)
+        return array
+
+cdef object cont1_array_sc_f(rk_state *state, rk_cont1_f func, object size,
+                             float a, object lock):
+    cdef float *array_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+    cdef npy_intp i
+    cdef float rv
+
+    if size is None:
+        with lock, nogil:
+            rv = func(state, a)
+        return np.float32(rv)
+    else:
+        array = <ndarray>np.empty(size, np.float32)
+        length = PyArray_SIZE(array)
+        array_data = <float *>PyArray_DATA(array)
+        with lock, nogil:
+            for i from 0 <= i < length:
+                array_data[i] = func(state, a)
+        return array
+
+cdef object cont1_array_f(rk_state *state, rk_cont1_f func, object size,
+                          ndarray oa, object lock):
+    cdef float *array_data
+    cdef float *oa_data
+    cdef ndarray array "arrayObject"
+    cdef npy_intp length
+    cdef npy_intp i
+    cdef flatiter itera
+    cdef broadcast multi
+
+    if size is None:
+        array = <ndarray>PyArray_SimpleNew(PyArray_NDIM(oa),
+                PyArray_DIMS(oa) , NPY_FLOAT)
+        length = PyArray_SIZE(array)
+        array_data = <float *>PyArray_DATA(array)
+        itera = <flatiter>PyArray_IterNew(<object>oa)
+        with lock, nogil:
+            for i from 0 <= i < length:
+                array_data[i] = func(state, (<float *>(itera.dataptr))[0])
+                PyArray_ITER_NEXT(itera)
+    else:
+        array = <ndarray>np.empty(size, np.float32)
+        array_data = <float *>PyArray_DATA(array)
+        multi = <broadcast>PyArray_MultiIterNew(2, <void *>array,
+                                                <void *>oa)
+        if (multi.size != PyArray_SIZE(array)):
+            raise ValueError("size is not compatible with inputs")
+        with lock, nogil:
+            for i from 0 <= i < multi.size:
+                oa_data = <float *>PyArray_MultiIter_DATA(multi, 1)
+                array_data[i] = func(state, oa_data[0])
+                PyArray_MultiIter_NEXTi(multi, 1)
+    return array
+
 cdef object cont2_array_sc(rk_state *state, rk_cont2 func, object size, double a,
                            double b, object lock):
     cdef double *array_data
@@ -592,9 +800,10 @@ _randint_type = {
 
 cdef class RandomState:
     """
-    RandomState(seed=None)
+    RandomState(seed=None, brng='MT19937')
 
-    Container for the Mersenne Twister pseudo-random number generator.
+    Container for a pseudo-random number generator, by default the Mersenne
+    Twister.
 
     `RandomState` exposes a number of methods for generating random numbers
     drawn from a variety of probability distributions. In addition to the
@@ -621,7 +830,21 @@ cdef class RandomState:
         sequence) of such integers, or ``None`` (the default).  If `seed` is
         ``None``, then `RandomState` will try to read data from
         ``/dev/urandom`` (or the Windows analogue) if available or seed from
-        the clock otherwise.
+        the clock otherwise. The bit generators other than 'MT19937' take
+        any non-negative integer or sequence of integers below 2**64.
+    brng : str, optional
+        The bit generator underlying all the distributions, one of
+
+        * 'MT19937', the Mersenne Twister (the default),
+        * 'PCG64', a 128 bit permuted congruential generator that can be
+          advanced by any number of steps,
+        * 'Philox4x64', a counter based generator; its streams are
+          independent for different seeds and can be advanced in constant
+          time,
+        * 'Xoroshiro128', xoroshiro128**, which can jump by 2**64 outputs,
+        * 'SFC64', a small, fast chaotic generator.
+
+        .. versionadded:: 1.13.0
 
     Notes
     -----
@@ -631,16 +854,30 @@ cdef class RandomState:
     NumPy-aware, has the advantage that it provides a much larger number
     of probability distributions to choose from.
 
+    Independent streams for parallel work are best made with the other bit
+    generators, either by seeding each with a distinct sequence such as
+    ``(seed, worker)``, or by `jump`-ing or `advance`-ing copies of one
+    generator, which guarantees that the streams do not overlap.
+
+    Examples
+    --------
+    >>> streams = [np.random.RandomState(1234, brng='Philox4x64')
+    ...            for i in range(4)]
+    >>> for i, rs in enumerate(streams):
+    ...     rs.jump(i)
+
     """
     cdef rk_state *internal_state
     cdef object lock
     cdef object state_address
+    cdef int brng_index
     poisson_lam_max = np.iinfo('l').max - np.sqrt(np.iinfo('l').max)*10
 
-    def __init__(self, seed=None):
+    def __init__(self, seed=None, brng='MT19937'):
         self.internal_state = <rk_state*>PyMem_Malloc(sizeof(rk_state))
         self.state_address = PyCapsule_New(self.internal_state, NULL, NULL)
         self.lock = Lock()
+        self.brng_index = _brng_index(brng)
         self.seed(seed)
 
     def __dealloc__(self):
@@ -661,7 +898,8 @@ cdef class RandomState:
         ----------
         seed : int or array_like, optional
             Seed for `RandomState`.
-            Must be convertible to 32 bit unsigned integers.
+            Must be convertible to 32 bit unsigned integers, or, for the bit
+            generators other than 'MT19937', 64 bit unsigned integers.
 
         See Also
         --------
@@ -670,6 +908,18 @@ cdef class RandomState:
         """
         cdef rk_error errcode
         cdef ndarray obj "arrayObject_obj"
+        if self.brng_index != RK_MT19937:
+            if seed is None:
+                with self.lock:
+                    rk_randomseed_brng(<rk_brng>self.brng_index,
+                                       self.internal_state)
+            else:
+                obj = <ndarray>_seed_words(seed)
+                with self.lock:
+                    rk_seed_brng(<rk_brng>self.brng_index,
+                                 <npy_uint64 *>PyArray_DATA(obj),
+                                 PyArray_DIM(obj, 0), self.internal_state)
+            return
         try:
             if seed is None:
                 with self.lock:
@@ -708,6 +958,10 @@ cdef class RandomState:
             4. an integer ``has_gauss``.
             5. a float ``cached_gaussian``.
 
+            For the other bit generators, the tuple is
+            ``(name, words, has_gauss, cached_gaussian)``, where `words` is
+            a 1-D uint64 array holding the state of the generator.
+
         See Also
         --------
         set_state
@@ -720,6 +974,15 @@ cdef class RandomState:
 
         """
         cdef ndarray state "arrayObject_state"
+        if self.brng_index != RK_MT19937:
+            state = <ndarray>np.empty(
+                rk_brng_state_size(<rk_brng>self.brng_index), np.uint64)
+            with self.lock:
+                rk_brng_get_state(self.internal_state,
+                                  <npy_uint64 *>PyArray_DATA(state))
+                has_gauss = self.internal_state.has_gauss
+                gauss = self.internal_state.gauss
+            return (_brng_names[self.brng_index], state, has_gauss, gauss)
         state = <ndarray>np.empty(624, np.uint)
         with self.lock:
             memcpy(<void*>PyArray_DATA(state), <void*>(self.internal_state.key), 624*sizeof(long))
@@ -768,6 +1031,9 @@ cdef class RandomState:
         also accepted although it is missing some information about the cached
         Gaussian value: ``state = ('MT19937', keys, pos)``.
 
+        The states of the other bit generators, as returned by `get_state`,
+        are accepted as well and switch the generator to their bit generator.
+
         References
         ----------
         .. [1] M. Matsumoto and T. Nishimura, "Mersenne Twister: A
@@ -777,10 +1043,27 @@ cdef class RandomState:
 
         """
         cdef ndarray obj "arrayObject_obj"
-        cdef int pos
+        cdef int pos, brng, err
         algorithm_name = state[0]
         if algorithm_name != 'MT19937':
-            raise ValueError("algorithm must be 'MT19937'")
+            brng = _brng_index(algorithm_name)
+            words, has_gauss, cached_gaussian = state[1:4]
+            obj = <ndarray>np.ascontiguousarray(words, dtype=np.uint64)
+            if (PyArray_NDIM(obj) != 1 or PyArray_DIM(obj, 0) !=
+                    rk_brng_state_size(<rk_brng>brng)):
+                raise ValueError("state must be %d uint64 words"
+                                 % rk_brng_state_size(<rk_brng>brng))
+            with self.lock:
+                err = rk_brng_set_state(<rk_brng>brng,
+                                        <npy_uint64 *>PyArray_DATA(obj),
+                                        self.internal_state)
+                if err == 0:
+                    self.brng_index = brng
+                    self.internal_state.has_gauss = has_gauss
+                    self.internal_state.gauss = cached_gaussian
+            if err < 0:
+                raise ValueError("invalid %s state" % algorithm_name)
+            return
         key, pos = state[1:3]
         if len(state) == 3:
             has_gauss = 0
@@ -799,6 +1082,87 @@ cdef class RandomState:
             self.internal_state.pos = pos
             self.internal_state.has_gauss = has_gauss
             self.internal_state.gauss = cached_gaussian
+            self.internal_state.brng = RK_MT19937
+            self.internal_state.has_uint32 = 0
+            self.brng_index = RK_MT19937
+
+    property brng:
+        """The name of the bit generator."""
+        def __get__(self):
+            return _brng_names[self.brng_index]
+
+    def jump(self, jumps=1):
+        """
+        jump(jumps=1)
+
+        Jump the bit generator ahead, `jumps` times.
+
+        Each jump skips 2**64 outputs of 'PCG64' and 'Xoroshiro128', and
+        2**128 blocks of four outputs of 'Philox4x64', so generators that
+        start from the same state and are jumped different numbers of times
+        give streams that do not overlap. Cached values are discarded.
+
+        .. versionadded:: 1.13.0
+
+        Parameters
+        ----------
+        jumps : int, optional
+            Number of jumps, 1 by default.
+
+        Raises
+        ------
+        ValueError
+            If the bit generator, 'MT19937' or 'SFC64', cannot jump.
+
+        """
+        cdef npy_intp i, n = operator.index(jumps)
+        cdef int err = 0
+        if n < 0:
+            raise ValueError("jumps must be non-negative")
+        with self.lock:
+            with nogil:
+                for i in range(n):
+                    err = rk_jump(self.internal_state)
+                    if err < 0:
+                        break
+        if err < 0:
+            raise ValueError("%s cannot jump" % self.brng)
+
+    def advance(self, delta):
+        """
+        advance(delta)
+
+        Advance the bit generator by `delta` steps, as if that many 64 bit
+        outputs of 'PCG64', or blocks of four outputs of 'Philox4x64', had
+        been drawn, in a time that does not depend on `delta`. Cached
+        values are discarded.
+
+        .. versionadded:: 1.13.0
+
+        Parameters
+        ----------
+        delta : int
+            Number of steps, between 0 and 2**128 - 1.
+
+        Raises
+        ------
+        ValueError
+            If the bit generator cannot be advanced.
+
+        """
+        cdef ndarray obj "arrayObject_obj"
+        cdef npy_uint64 *d
+        cdef int err
+        delta = operator.index(delta)
+        if delta < 0 or delta >> 128:
+            raise ValueError("delta must be between 0 and 2**128 - 1")
+        obj = <ndarray>np.array([delta >> 64, delta & 0xffffffffffffffff],
+                                dtype=np.uint64)
+        d = <npy_uint64 *>PyArray_DATA(obj)
+        with self.lock:
+            err = rk_advance(d[0], d[1], self.internal_state)
+        if err < 0:
+            raise ValueError("%s cannot be advanced" % self.brng)
 
     # Pickling support:
     def __getstate__(self):
@@ -853,7 +1217,7 @@ cdef class RandomState:
                [-1.23204345, -1.75224494]])
 
         """
-        return cont0_array(self.internal_state, rk_double, size, self.lock)
+        return cont0_fill(self.internal_state, rk_fill_double, size, self.lock)
 
     def tomaxint(self, size=None):
         """
@@ -1288,8 +1652,8 @@ cdef class RandomState:
             if not npy_isfinite(fscale):
                 raise OverflowError('Range exceeds valid bounds')
 
-            return cont2_array_sc(self.internal_state, rk_uniform, size, flow,
-                                  fscale, self.lock)
+            return cont2_fill_sc(self.internal_state, rk_fill_double, size,
+                                 flow, fscale, self.lock)
 
         temp = np.subtract(ohigh, olow)
         Py_INCREF(temp)  # needed to get around Pyrex's automatic reference-counting
@@ -1500,9 +1864,9 @@ cdef class RandomState:
 
 
     # Complicated, continuous distributions:
-    def standard_normal(self, size=None):
+    def standard_normal(self, size=None, method='legacy', dtype=np.float64):
         """
-        standard_normal(size=None)
+        standard_normal(size=None, method='legacy', dtype=np.float64)
 
         Draw samples from a standard Normal distribution (mean=0, stdev=1).
 
@@ -1512,6 +1876,19 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        method : {'legacy', 'zig'}, optional
+            Sampling algorithm.  'legacy' (default) is the polar Box-Muller
+            method and reproduces the streams of earlier versions.  'zig'
+            uses the ziggurat method of Marsaglia and Tsang, which is several
+            times faster but draws a different stream.
+
+            .. versionadded:: 1.13.0
+        dtype : {float64, float32}, optional
+            Output dtype, default float64.  With ``method='zig'`` float32
+            samples are drawn in single precision, otherwise float64 samples
+            are rounded.
+
+            .. versionadded:: 1.13.0
 
         Returns
         -------
@@ -1530,8 +1907,26 @@ cdef class RandomState:
         >>> s.shape
         (3, 4, 2)
 
+        Ziggurat samples in single precision:
+
+        >>> s = np.random.standard_normal(1000, method='zig', dtype=np.float32)
+        >>> s.dtype
+        dtype('float32')
+
         """
-        return cont0_array(self.internal_state, rk_gauss, size, self.lock)
+        cdef int zig = _use_ziggurat(method)
+
+        dtype = _float_dtype(dtype)
+        if zig:
+            if dtype == np.float32:
+                return cont0_fill_f(self.internal_state, rk_fill_gauss_zig_f,
+                                    size, self.lock)
+            return cont0_fill(self.internal_state, rk_fill_gauss_zig, size,
+                              self.lock)
+        out = cont0_fill(self.internal_state, rk_fill_gauss, size, self.lock)
+        if dtype == np.float32:
+            return np.float32(out)
+        return out
 
     def normal(self, loc=0.0, scale=1.0, size=None):
         """
@@ -1633,8 +2028,8 @@ cdef class RandomState:
             fscale = PyFloat_AsDouble(scale)
             if np.signbit(fscale):
                 raise ValueError("scale < 0")
-            return cont2_array_sc(self.internal_state, rk_normal, size, floc,
-                                  fscale, self.lock)
+            return cont2_fill_sc(self.internal_state, rk_fill_gauss, size,
+                                 floc, fscale, self.lock)
 
         if np.any(np.signbit(oscale)):
             raise ValueError("scale < 0")
@@ -1757,17 +2152,18 @@ cdef class RandomState:
             fscale = PyFloat_AsDouble(scale)
             if np.signbit(fscale):
                 raise ValueError("scale < 0")
-            return cont1_array_sc(self.internal_state, rk_exponential, size,
-                                  fscale, self.lock)
+            return cont2_fill_sc(self.internal_state,
+                                 rk_fill_standard_exponential, size, 0.0,
+                                 fscale, self.lock)
 
         if np.any(np.signbit(oscale)):
             raise ValueError("scale < 0")
         return cont1_array(self.internal_state, rk_exponential, size, oscale,
                            self.lock)
 
-    def standard_exponential(self, size=None):
+    def standard_exponential(self, size=None, method='legacy', dtype=np.float64):
         """
-        standard_exponential(size=None)
+        standard_exponential(size=None, method='legacy', dtype=np.float64)
 
         Draw samples from the standard exponential distribution.
 
@@ -1780,6 +2176,19 @@ cdef class RandomState:
             Output shape.  If the given shape is, e.g., ``(m, n, k)``, then
             ``m * n * k`` samples are drawn.  Default is None, in which case a
             single value is returned.
+        method : {'legacy', 'zig'}, optional
+            Sampling algorithm.  'legacy' (default) is inversion of the CDF
+            and reproduces the streams of earlier versions.  'zig' uses the
+            ziggurat method of Marsaglia and Tsang, which is several times
+            faster but draws a different stream.
+
+            .. versionadded:: 1.13.0
+        dtype : {float64, float32}, optional
+            Output dtype, default float64.  With ``method='zig'`` float32
+            samples are drawn in single precision, otherwise float64 samples
+            are rounded.
+
+            .. versionadded:: 1.13.0
 
         Returns
         -------
@@ -1793,12 +2202,26 @@ cdef class RandomState:
         >>> n = np.random.standard_exponential((3, 8000))
 
         """
-        return cont0_array(self.internal_state, rk_standard_exponential, size,
-                           self.lock)
-
-    def standard_gamma(self, shape, size=None):
+        cdef int zig = _use_ziggurat(method)
+
+        dtype = _float_dtype(dtype)
+        if zig:
+            if dtype == np.float32:
+                return cont0_fill_f(self.internal_state,
+                                    rk_fill_standard_exponential_zig_f, size,
+                                    self.lock)
+            return cont0_fill(self.internal_state,
+                              rk_fill_standard_exponential_zig, size,
+                              self.lock)
+        out = cont0_fill(self.internal_state, rk_fill_standard_exponential,
+                         size, self.lock)
+        if dtype == np.float32:
+            return np.float32(out)
+        return out
+
+    def standard_gamma(self, shape, size=None, method='legacy', dtype=np.float64):
         """
-        standard_gamma(shape, size=None)
+        standard_gamma(shape, size=None, method='legacy', dtype=np.float64)
 
         Draw samples from a standard Gamma distribution.
 
@@ -1814,6 +2237,20 @@ cdef class RandomState:
             ``m * n * k`` samples are drawn.  If size is ``None`` (default),
             a single value is returned if ``shape`` is a scalar.  Otherwise,
             ``np.array(shape).size`` samples are drawn.
+        method : {'legacy', 'zig'}, optional
+            Sampling algorithm.  'legacy' (default) reproduces the streams
+            of earlier versions.  'zig' draws the normal and exponential
+            variates the gamma method is built on with the ziggurat method
+            of Marsaglia and Tsang, which is faster but gives a different
+            stream.
+
+            .. versionadded:: 1.13.0
+        dtype : {float64, float32}, optional
+            Output dtype, default float64.  With ``method='zig'`` float32
+            samples are drawn in single precision, otherwise float64 samples
+            are rounded.
+
+            .. versionadded:: 1.13.0
 
         Returns
         -------
@@ -1867,20 +2304,40 @@ cdef class RandomState:
         """
         cdef ndarray oshape
         cdef double fshape
+        cdef int zig = _use_ziggurat(method)
+        cdef rk_cont1 func = rk_standard_gamma
 
-        oshape = <ndarray>PyArray_FROM_OTF(shape, NPY_DOUBLE, NPY_ARRAY_ALIGNED)
+        dtype = _float_dtype(dtype)
+        single = zig and dtype == np.float32
+        if zig:
+            func = rk_standard_gamma_zig
+
+        oshape = <ndarray>PyArray_FROM_OTF(shape,
+                                           NPY_FLOAT if single else NPY_DOUBLE,
+                                           NPY_ARRAY_ALIGNED)
 
         if oshape.shape == ():
             fshape = PyFloat_AsDouble(shape)
             if np.signbit(fshape):
                 raise ValueError("shape < 0")
-            return cont1_array_sc(self.internal_state, rk_standard_gamma,
-                                  size, fshape, self.lock)
-
-        if np.any(np.signbit(oshape)):
-            raise ValueError("shape < 0")
-        return cont1_array(self.internal_state, rk_standard_gamma, size,
-                           oshape, self.lock)
+            if single:
+                return cont1_array_sc_f(self.internal_state,
+                                        rk_standard_gamma_zig_f, size,
+                                        <float>fshape, self.lock)
+            out = cont1_array_sc(self.internal_state, func, size, fshape,
+                                 self.lock)
+        else:
+            if np.any(np.signbit(oshape)):
+                raise ValueError("shape < 0")
+            if single:
+                return cont1_array_f(self.internal_state,
+                                     rk_standard_gamma_zig_f, size, oshape,
+                                     self.lock)
+            out = cont1_array(self.internal_state, func, size, oshape,
+                              self.lock)
+        if dtype == np.float32:
+            return np.float32(out)
+        return out
 
     def gamma(self, shape, scale=1.0, size=None):
         """
@@ -120,6 +120,7 @@
  * Do not move this include. randomkit.h must be included
  * after windows timeb.h is included.
  */
+#include "npy_cpu_features.h"
 #include "randomkit.h"
 
 #ifndef RK_DEV_URANDOM
@@ -154,6 +155,8 @@ rk_seed(unsigned long seed, rk_state *state)
     state->gauss = 0;
     state->has_gauss = 0;
     state->has_binomial = 0;
+    state->brng = RK_MT19937;
+    state->has_uint32 = 0;
 }
 
 /* Thomas Wang 32 bits integer hash function */
@@ -186,6 +189,8 @@ rk_randomseed(rk_state *state)
         state->gauss = 0;
         state->has_gauss = 0;
         state->has_binomial = 0;
+        state->brng = RK_MT19937;
+        state->has_uint32 = 0;
 
         for (i = 0; i < 624; i++) {
             state->key[i] &= 0xffffffffUL;
@@ -213,51 +218,161 @@ rk_randomseed(rk_state *state)
 #define LOWER_MASK 0x7fffffffUL
 
 /*
- * Slightly optimised reference implementation of the Mersenne Twister
- * Note that regardless of the precision of long, only 32 bit random
- * integers are produced
+ * Regenerates the whole MT19937 state block.  The loops carry no dependency
+ * shorter than M - 1 elements, so the compiler vectorizes them as in the
+ * block generation of SFMT, while the outputs stay those of the reference
+ * implementation.
  */
-unsigned long
-rk_random(rk_state *state)
+static NPY_INLINE void
+rk_mt_next_state_loops(unsigned long *key)
 {
     unsigned long y;
+    int i;
 
-    if (state->pos == RK_STATE_LEN) {
-        int i;
-
-        for (i = 0; i < N - M; i++) {
-            y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
-            state->key[i] = state->key[i+M] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
-        }
-        for (; i < N - 1; i++) {
-            y = (state->key[i] & UPPER_MASK) | (state->key[i+1] & LOWER_MASK);
-            state->key[i] = state->key[i+(M-N)] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
-        }
-        y = (state->key[N - 1] & UPPER_MASK) | (state->key[0] & LOWER_MASK);
-        state->key[N - 1] = state->key[M - 1] ^ (y >> 1) ^ (-(y & 1) & MATRIX_A);
-
-        state->pos = 0;
+    for (i = 0; i < N - M; i++) {
+        y = (key[i] & UPPER_MASK) | (key[i+1] & LOWER_MASK);
+        key[i] = key[i+M] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
+    }
+    for (; i < N - 1; i++) {
+        y = (key[i] & UPPER_MASK) | (key[i+1] & LOWER_MASK);
+        key[i] = key[i+(M-N)] ^ (y>>1) ^ (-(y & 1) & MATRIX_A);
     }
-    y = state->key[state->pos++];
+    y = (key[N - 1] & UPPER_MASK) | (key[0] & LOWER_MASK);
+    key[N - 1] = key[M - 1] ^ (y >> 1) ^ (-(y & 1) & MATRIX_A);
+}
 
-    /* Tempering */
+static NPY_INLINE npy_uint32
+rk_mt_temper(unsigned long y)
+{
     y ^= (y >> 11);
     y ^= (y << 7) & 0x9d2c5680UL;
     y ^= (y << 15) & 0xefc60000UL;
     y ^= (y >> 18);
+    return (npy_uint32)y;
+}
+
+/* The doubles of rk_double from the n pairs of outputs in key */
+static NPY_INLINE void
+rk_mt_double_loop(const unsigned long *key, npy_intp n, double *out)
+{
+    npy_intp j;
 
-    return y;
+    for (j = 0; j < n; j++) {
+        const npy_int32 a = rk_mt_temper(key[2*j]) >> 5;
+        const npy_int32 b = rk_mt_temper(key[2*j + 1]) >> 6;
+
+        out[j] = (a * 67108864.0 + b) * (1.0 / 9007199254740992.0);
+    }
 }
 
+/*
+ * The loops above compiled once more for AVX2 and AVX512F, selected at
+ * runtime by npy_simd_isa.
+ */
+#ifdef NPY_HAVE_AVX2_INTRINSICS
+static NPY_GCC_TARGET_AVX2 void
+rk_mt_next_state_avx2(unsigned long *key)
+{
+    rk_mt_next_state_loops(key);
+}
+
+static NPY_GCC_TARGET_AVX2 void
+rk_mt_double_avx2(const unsigned long *key, npy_intp n, double *out)
+{
+    rk_mt_double_loop(key, n, out);
+}
+#endif
+
+#ifdef NPY_HAVE_AVX512F_INTRINSICS
+static NPY_GCC_TARGET_AVX512F void
+rk_mt_next_state_avx512f(unsigned long *key)
+{
+    rk_mt_next_state_loops(key);
+}
+
+static NPY_GCC_TARGET_AVX512F void
+rk_mt_double_avx512f(const unsigned long *key, npy_intp n, double *out)
+{
+    rk_mt_double_loop(key, n, out);
+}
+#endif
+
+static void
+rk_mt_next_state(rk_state *state)
+{
+#ifdef NPY_HAVE_AVX512F_INTRINSICS
+    if (npy_simd_isa >= NPY_SIMD_ISA_AVX512F) {
+        rk_mt_next_state_avx512f(state->key);
+    }
+    else
+#endif
+#ifdef NPY_HAVE_AVX2_INTRINSICS
+    if (npy_simd_isa >= NPY_SIMD_ISA_AVX2) {
+        rk_mt_next_state_avx2(state->key);
+    }
+    else
+#endif
+    {
+        rk_mt_next_state_loops(state->key);
+    }
+    state->pos = 0;
+}
+
+static void
+rk_mt_double(const unsigned long *key, npy_intp n, double *out)
+{
+#ifdef NPY_HAVE_AVX512F_INTRINSICS
+    if (npy_simd_isa >= NPY_SIMD_ISA_AVX512F) {
+        rk_mt_double_avx512f(key, n, out);
+        return;
+    }
+#endif
+#ifdef NPY_HAVE_AVX2_INTRINSICS
+    if (npy_simd_isa >= NPY_SIMD_ISA_AVX2) {
+        rk_mt_double_avx2(key, n, out);
+        return;
+    }
+#endif
+    rk_mt_double_loop(key, n, out);
+}
 
 /*
- * Returns an unsigned 64 bit random integer.
+ * Slightly optimised reference implementation of the Mersenne Twister
+ * Note that regardless of the precision of long, only 32 bit random
+ * integers are produced
  */
-NPY_INLINE static npy_uint64
-rk_uint64(rk_state *state)
+unsigned long
+rk_random(rk_state *state)
+{
+    if (state->brng != RK_MT19937) {
+        npy_uint64 r;
+
+        /* the other generators give 64 bits, return them in two halves */
+        if (state->has_uint32) {
+            state->has_uint32 = 0;
+            return state->uinteger;
+        }
+        r = rk_brng_next64(state);
+        state->has_uint32 = 1;
+        state->uinteger = (npy_uint32)(r >> 32);
+        return (unsigned long)(r & 0xffffffffUL);
+    }
+    if (state->pos == RK_STATE_LEN) {
+        rk_mt_next_state(state);
+    }
+    return rk_mt_temper(state->key[state->pos++]);
+}
+
+npy_uint64
+rk_random64(rk_state *state)
 {
-    npy_uint64 upper = (npy_uint64)rk_random(state) << 32;
-    npy_uint64 lower = (npy_uint64)rk_random(state);
+    npy_uint64 upper, lower;
+
+    if (state->brng != RK_MT19937) {
+        return rk_brng_next64(state);
+    }
+    upper = (npy_uint64)rk_random(state) << 32;
+    lower = (npy_uint64)rk_random(state);
     return upper | lower;
 }
 
@@ -303,7 +418,7 @@ rk_random_uint64(npy_uint64 off, npy_uint64 rng, npy_intp cnt,
             while ((val = (rk_uint32(state) & mask)) > rng);
         }
         else {
-            while ((val = (rk_uint64(state) & mask)) > rng);
+            while ((val = (rk_random64(state) & mask)) > rng);
         }
         out[i] =  off + val;
     }
@@ -474,7 +589,7 @@ rk_ulong(rk_state *state)
 #if ULONG_MAX <= 0xffffffffUL
     return rk_random(state);
 #else
-    return (rk_random(state) << 32) | (rk_random(state));
+    return rk_random64(state);
 #endif
 }
 
@@ -514,10 +629,53 @@ double
 rk_double(rk_state *state)
 {
     /* shifts : 67108864 = 0x4000000, 9007199254740992 = 0x20000000000000 */
-    long a = rk_random(state) >> 5, b = rk_random(state) >> 6;
+    long a, b;
+
+    if (state->brng != RK_MT19937) {
+        return (rk_brng_next64(state) >> 11) / 9007199254740992.0;
+    }
+    a = rk_random(state) >> 5;
+    b = rk_random(state) >> 6;
     return (a * 67108864.0 + b) / 9007199254740992.0;
 }
 
+/* Outputs of the bit generators converted per chunk by the fillers */
+#define RK_FILL_CHUNK 256
+
+void
+rk_fill_double(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i = 0, j, n;
+
+    if (state->brng != RK_MT19937) {
+        npy_uint64 buf[RK_FILL_CHUNK];
+
+        while (i < cnt) {
+            n = cnt - i < RK_FILL_CHUNK ? cnt - i : RK_FILL_CHUNK;
+            rk_brng_fill64(n, buf, state);
+            for (j = 0; j < n; j++) {
+                out[i + j] = (buf[j] >> 11) * (1.0 / 9007199254740992.0);
+            }
+            i += n;
+        }
+        return;
+    }
+    while (i < cnt) {
+        if (state->pos >= RK_STATE_LEN - 1) {
+            /* the pair straddles a regeneration of the state */
+            out[i++] = rk_double(state);
+            continue;
+        }
+        n = (RK_STATE_LEN - state->pos) / 2;
+        if (n > cnt - i) {
+            n = cnt - i;
+        }
+        rk_mt_double(state->key + state->pos, n, out + i);
+        state->pos += 2*n;
+        i += n;
+    }
+}
+
 void
 rk_fill(void *buffer, size_t size, rk_state *state)
 {
@@ -622,3 +780,33 @@ rk_gauss(rk_state *state)
         return f*x2;
     }
 }
+
+void
+rk_fill_gauss(npy_intp cnt, double *out, rk_state *state)
+{
+    npy_intp i = 0;
+
+    if (cnt > 0 && state->has_gauss) {
+        out[i++] = rk_gauss(state);
+    }
+    for (; i < cnt; i += 2) {
+        double f, x1, x2, r2;
+
+        do {
+            x1 = 2.0*rk_double(state) - 1.0;
+            x2 = 2.0*rk_double(state) - 1.0;
+            r2 = x1*x1 + x2*x2;
+        }
+        while (r2 >= 1.0 || r2 == 0.0);
+
+        f = sqrt(-2.0*log(r2)/r2);
+        out[i] = f*x2;
+        if (i + 1 < cnt) {
+            out[i + 1] = f*x1;
+        }
+        else {
+            state->gauss = f*x1;
+            state->has_gauss = 1;
+        }
+    }
+}
@@ -65,6 +65,45 @@
 
 #define RK_STATE_LEN 624
 
+/*
+ * The bit generators. MT19937 is the default and the only one the legacy
+ * seeding functions (rk_seed, rk_randomseed, init_by_array) produce; the
+ * others are selected and seeded with rk_seed_brng. PCG64 and Philox4x64
+ * can be advanced by any number of steps, Xoroshiro128 jumped by 2**64.
+ */
+typedef enum {
+    RK_MT19937 = 0,
+    RK_PCG64 = 1,
+    RK_PHILOX4X64 = 2,
+    RK_XOROSHIRO128 = 3,
+    RK_SFC64 = 4,
+    RK_BRNG_MAX = 5
+} rk_brng;
+
+/* PCG XSL RR 128/64, 128 bit numbers are stored as {high, low} */
+typedef struct {
+    npy_uint64 state[2];
+    npy_uint64 inc[2];
+} rk_pcg64_state;
+
+/* Philox4x64-10, ctr is the next block, buffer[pos:4] the unused outputs */
+typedef struct {
+    npy_uint64 ctr[4];
+    npy_uint64 key[2];
+    npy_uint64 buffer[4];
+    int pos;
+} rk_philox_state;
+
+/* xoroshiro128** */
+typedef struct {
+    npy_uint64 s[2];
+} rk_xoroshiro_state;
+
+/* Chris Doty-Humphrey's small fast chaotic generator */
+typedef struct {
+    npy_uint64 a, b, c, w;
+} rk_sfc64_state;
+
 typedef struct rk_state_
 {
     unsigned long key[RK_STATE_LEN];
@@ -96,6 +135,17 @@ typedef struct rk_state_
     double p3;
     double p4;
 
+    /* The bit generator, the MT19937 state is key and pos above */
+    int brng;
+    union {
+        rk_pcg64_state pcg64;
+        rk_philox_state philox;
+        rk_xoroshiro_state xoroshiro;
+        rk_sfc64_state sfc64;
+    } bits;
+    /* !=0: uinteger holds the upper half of a 64 bit output */
+    int has_uint32;
+    npy_uint32 uinteger;
 }
 rk_state;
 
@@ -130,11 +180,66 @@ extern void rk_seed(unsigned long seed, rk_state *state);
  */
 extern rk_error rk_randomseed(rk_state *state);
 
+/*
+ * Select the bit generator brng and seed it from n 64 bit words, all of
+ * which affect the state. Any seed gives a valid state.
+ */
+extern void rk_seed_brng(rk_brng brng, const npy_uint64 *seed, npy_intp n,
+                         rk_state *state);
+
+/*
+ * Select the bit generator brng and seed it from the random device, or
+ * the clock if it is unavailable. Returns the same as rk_randomseed.
+ */
+extern rk_error rk_randomseed_brng(rk_brng brng, rk_state *state);
+
+/*
+ * Advance the bit generator by delta = delta_hi * 2**64 + delta_lo steps,
+ * 64 bit outputs for PCG64 and blocks of four for Philox4x64. Buffered
+ * outputs and the cached gaussian are dropped. Returns -1 if the bit
+ * generator cannot be advanced.
+ */
+extern int rk_advance(npy_uint64 delta_hi, npy_uint64 delta_lo,
+                      rk_state *state);
+
+/*
+ * Jump ahead by 2**64 steps (PCG64, Xoroshiro128) or 2**128 blocks
+ * (Philox4x64), so that the outputs of up to 2**64 successive jumps
+ * never overlap. Returns -1 if the bit generator cannot jump.
+ */
+extern int rk_jump(rk_state *state);
+
+/*
+ * The state of the bit generator other than MT19937, including any
+ * buffered output, as rk_brng_state_size(brng) 64 bit words.
+ * rk_brng_set_state returns -1 if the words are not a valid state.
+ */
+extern npy_intp rk_brng_state_size(rk_brng brng);
+extern void rk_brng_get_state(rk_state *state, npy_uint64 *words);
+extern int rk_brng_set_state(rk_brng brng, const npy_uint64 *words,
+                             rk_state *state);
+
+/*
+ * Returns the next 64 bits of a bit generator other than MT19937.
+ */
+extern npy_uint64 rk_brng_next64(rk_state *state);
+
+/*
+ * Fills out with the next cnt outputs of a bit generator other than MT19937.
+ */
+extern void rk_brng_fill64(npy_intp cnt, npy_uint64 *out, rk_state *state);
+
 /*
  * Returns a random unsigned long between 0 and RK_MAX inclusive
  */
 extern unsigned long rk_random(rk_state *state);
 
+/*
+ * Returns a random 64 bit integer. For MT19937 these are two outputs of
+ * rk_random, the first one in the upper half.
+ */
+extern npy_uint64 rk_random64(rk_state *state);
+
 /*
  * Returns a random long between 0 and LONG_MAX inclusive
  */
@@ -190,6 +295,13 @@ extern void rk_random_bool(npy_bool off, npy_bool rng, npy_intp cnt,
  */
 extern double rk_double(rk_state *state);
 
+/*
+ * Fills out with cnt random doubles, the same values as cnt calls of
+ * rk_double.  MT19937 outputs are tempered and converted a state block at a
+ * time.
+ */
+extern void rk_fill_double(npy_intp cnt, double *out, rk_state *state);
+
 /*
  * fill the buffer with size random bytes
  */
@@ -219,6 +331,12 @@ extern rk_error rk_altfill(void *buffer, size_t size, int strong,
  */
 extern double rk_gauss(rk_state *state);
 
+/*
+ * Fills out with cnt gaussian deviates, the same values as cnt calls of
+ * rk_gauss, including the one kept for the next call.
+ */
+extern void rk_fill_gauss(npy_intp cnt, double *out, rk_state *state);
+
 #ifdef __cplusplus
 }
 #endif
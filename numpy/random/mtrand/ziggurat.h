@@ -0,0 +1,925 @@
+/*
+ * Tables of the ziggurat normal and exponential samplers.
+ *
+ * Generated by generate_ziggurat.py, do not edit.
+ */
+#ifndef _RK_ZIGGURAT_
+#define _RK_ZIGGURAT_
+
+#define ZIGGURAT_NOR_R 3.6541528853610088
+#define ZIGGURAT_NOR_INV_R 0.27366123732975828
+#define ZIGGURAT_EXP_R 7.6971174701310501
+
+static const npy_uint64 kn_double[256] = {
+    0x000ef33d8025ef64ULL, 0x0000000000000000ULL, 0x000c08be98fbc661ULL,
+    0x000da354fabd8128ULL, 0x000e51f67ec1eeddULL, 0x000eb255e9d3f776ULL,
+    0x000eef4b817ecab3ULL, 0x000f19470afa44a7ULL, 0x000f37ed61ffcb13ULL,
+    0x000f4f4695612558ULL, 0x000f61a5e41ba395ULL, 0x000f707a755396a3ULL,
+    0x000f7cb2ec284499ULL, 0x000f86f10c6357d1ULL, 0x000f8fa6578325ddULL,
+    0x000f9724c74dd0daULL, 0x000f9da907dbf507ULL, 0x000fa360f581fa71ULL,
+    0x000fa86fde5b4bf7ULL, 0x000facf160d354dbULL, 0x000fb0fb6718b90eULL,
+    0x000fb49f8d5374c5ULL, 0x000fb7ec2366fe77ULL, 0x000fbaece9a1e50cULL,
+    0x000fbdab9d040beeULL, 0x000fc03060ff6c57ULL, 0x000fc2821037a248ULL,
+    0x000fc4a67ae25bd1ULL, 0x000fc6a2977aee2fULL, 0x000fc87aa92896a4ULL,
+    0x000fca325e4bde85ULL, 0x000fcbcce902231aULL, 0x000fcd4d12f839c4ULL,
+    0x000fceb54d8fec99ULL, 0x000fd007bf1dc930ULL, 0x000fd1464dd6c4e5ULL,
+    0x000fd272a8e2f450ULL, 0x000fd38e4ff0c91eULL, 0x000fd49a9990b479ULL,
+    0x000fd598b8920f53ULL, 0x000fd689c08e99ecULL, 0x000fd76ea9c8e831ULL,
+    0x000fd848547b08e8ULL, 0x000fd9178bad2c8bULL, 0x000fd9dd07a7add2ULL,
+    0x000fda9970105e8bULL, 0x000fdb4d5dc02e1fULL, 0x000fdbf95c5bfcd1ULL,
+    0x000fdc9debb99a7dULL, 0x000fdd3b8118729dULL, 0x000fddd288342f90ULL,
+    0x000fde6364369f63ULL, 0x000fdeee708d514fULL, 0x000fdf7401a6b42eULL,
+    0x000fdff46599ed3fULL, 0x000fe06fe4bc24f2ULL, 0x000fe0e6c225a259ULL,
+    0x000fe1593c28b84cULL, 0x000fe1c78cbc3f99ULL, 0x000fe231e9db1ca9ULL,
+    0x000fe29885da1b92ULL, 0x000fe2fb8fb54186ULL, 0x000fe35b33558d4aULL,
+    0x000fe3b799d0002aULL, 0x000fe410e99ead7eULL, 0x000fe46746d47734ULL,
+    0x000fe4bad34c095bULL, 0x000fe50baed29524ULL, 0x000fe559f74ebc76ULL,
+    0x000fe5a5c8e41211ULL, 0x000fe5ef3e138689ULL, 0x000fe6366fd91078ULL,
+    0x000fe67b75c6d578ULL, 0x000fe6be661e11aaULL, 0x000fe6ff55e5f4f2ULL,
+    0x000fe73e5900a702ULL, 0x000fe77b823e9e39ULL, 0x000fe7b6e37070a1ULL,
+    0x000fe7f08d774243ULL, 0x000fe8289053f08cULL, 0x000fe85efb35173aULL,
+    0x000fe893dc840864ULL, 0x000fe8c741f0cebcULL, 0x000fe8f9387d4ef6ULL,
+    0x000fe929cc879b1dULL, 0x000fe95909d388ebULL, 0x000fe986fb939aa1ULL,
+    0x000fe9b3ac714865ULL, 0x000fe9df2694b6d5ULL, 0x000fea0973abe67bULL,
+    0x000fea329cf166a4ULL, 0x000fea5aab32952dULL, 0x000fea81a6d57419ULL,
+    0x000feaa797de1cefULL, 0x000feacc85f3d91fULL, 0x000feaf07865e63cULL,
+    0x000feb13762fec12ULL, 0x000feb3585fe2a4bULL, 0x000feb56ae3162b4ULL,
+    0x000feb76f4e284f9ULL, 0x000feb965fe62013ULL, 0x000febb4f4cf9d7cULL,
+    0x000febd2b8f449cfULL, 0x000febefb16e2e3dULL, 0x000fec0be31ebde8ULL,
+    0x000fec2752b15a14ULL, 0x000fec42049dafd3ULL, 0x000fec5bfd29f196ULL,
+    0x000fec75406ceef4ULL, 0x000fec8dd2500cb4ULL, 0x000feca5b6911f10ULL,
+    0x000fecbcf0c427feULL, 0x000fecd38454fb15ULL, 0x000fece97488c8b3ULL,
+    0x000fecfec47f91b7ULL, 0x000fed1377358528ULL, 0x000fed278f844903ULL,
+    0x000fed3b10242f4cULL, 0x000fed4dfbad586eULL, 0x000fed605498c3ddULL,
+    0x000fed721d414fe8ULL, 0x000fed8357e4a982ULL, 0x000fed9406a42cc8ULL,
+    0x000feda42b85b704ULL, 0x000fedb3c8746ab3ULL, 0x000fedc2df416652ULL,
+    0x000fedd171a46e52ULL, 0x000feddf813c8ad3ULL, 0x000feded0f90997fULL,
+    0x000fedfa1e0fd414ULL, 0x000fee06ae124bc4ULL, 0x000fee12c0d95a06ULL,
+    0x000fee1e579006e0ULL, 0x000fee29734b6524ULL, 0x000fee34150ae4bbULL,
+    0x000fee3e3db89b3cULL, 0x000fee47ee2982f3ULL, 0x000fee51271db086ULL,
+    0x000fee59e9407f41ULL, 0x000fee623528b42dULL, 0x000fee6a0b5897f1ULL,
+    0x000fee716c3e077aULL, 0x000fee7858327b81ULL, 0x000fee7ecf7b06b9ULL,
+    0x000fee84d2484ab2ULL, 0x000fee8a60b66343ULL, 0x000fee8f7accc851ULL,
+    0x000fee94207e25daULL, 0x000fee9851a829ebULL, 0x000fee9c0e13485bULL,
+    0x000fee9f557273f4ULL, 0x000feea22762ccaeULL, 0x000feea4836b42abULL,
+    0x000feea668fc2d70ULL, 0x000feea7d76ed6f9ULL, 0x000feea8ce04fa0aULL,
+    0x000feea94be8333cULL, 0x000feea95029640fULL, 0x000feea8d9c0075eULL,
+    0x000feea7e7897654ULL, 0x000feea678481d24ULL, 0x000feea48aa29e83ULL,
+    0x000feea21d22e4daULL, 0x000fee9f2e352025ULL, 0x000fee9bbc26af2eULL,
+    0x000fee97c524f2e3ULL, 0x000fee93473c0a39ULL, 0x000fee8e40557515ULL,
+    0x000fee88ae369c79ULL, 0x000fee828e7f3dfdULL, 0x000fee7bdea7b888ULL,
+    0x000fee749bff37ffULL, 0x000fee6cc3a9bd5eULL, 0x000fee64529e007fULL,
+    0x000fee5b45a32889ULL, 0x000fee51994e57b6ULL, 0x000fee474a0006cfULL,
+    0x000fee3c53e12c4fULL, 0x000fee30b2e02ad7ULL, 0x000fee2462ad8204ULL,
+    0x000fee175eb83c59ULL, 0x000fee09a22a1447ULL, 0x000fedfb27e349cbULL,
+    0x000fedebea76216cULL, 0x000feddbe422047dULL, 0x000fedcb0ece39d3ULL,
+    0x000fedb964042cf4ULL, 0x000feda6dce938c9ULL, 0x000fed937237e98dULL,
+    0x000fed7f1c38a836ULL, 0x000fed69d2b9c02bULL, 0x000fed538d06adffULL,
+    0x000fed3c41dea422ULL, 0x000fed23e76a2fd7ULL, 0x000fed0a732fe643ULL,
+    0x000fecefda07fe34ULL, 0x000fecd4100eb7b8ULL, 0x000fecb708956eb4ULL,
+    0x000fec98b61230c1ULL, 0x000fec790a0da978ULL, 0x000fec57f50f31fdULL,
+    0x000fec356686c961ULL, 0x000fec114cb4b334ULL, 0x000febeb948e6fd0ULL,
+    0x000febc429a0b691ULL, 0x000feb9af5ee0cdcULL, 0x000feb6fe1c98542ULL,
+    0x000feb42d3ad1f9eULL, 0x000feb13b00b2d4bULL, 0x000feae2591a02e9ULL,
+    0x000feaaeae992257ULL, 0x000fea788d8ee326ULL, 0x000fea3fcffd73e5ULL,
+    0x000fea044c8dd9f6ULL, 0x000fe9c5d62f563aULL, 0x000fe9843ba947a3ULL,
+    0x000fe93f471d4729ULL, 0x000fe8f6bd76c5d6ULL, 0x000fe8aa5dc4e8e6ULL,
+    0x000fe859e07ab1eaULL, 0x000fe804f690a940ULL, 0x000fe7ab488233bfULL,
+    0x000fe74c751f6aa6ULL, 0x000fe6e8102aa202ULL, 0x000fe67da0b6abd8ULL,
+    0x000fe60c9f38307eULL, 0x000fe5947338f742ULL, 0x000fe51470977280ULL,
+    0x000fe48bd436f458ULL, 0x000fe3f9bffd1e37ULL, 0x000fe35d35eeb19bULL,
+    0x000fe2b5122fe4fdULL, 0x000fe20003995557ULL, 0x000fe13c82788314ULL,
+    0x000fe068c4ee67afULL, 0x000fdf82b02b71a9ULL, 0x000fde87c57efeaaULL,
+    0x000fdd7509c63bfdULL, 0x000fdc46e529bf13ULL, 0x000fdaf8f82e0282ULL,
+    0x000fd985e1b2ba75ULL, 0x000fd7e6ef48cf03ULL, 0x000fd613adbd650bULL,
+    0x000fd40149e2f011ULL, 0x000fd1a1a7b4c7acULL, 0x000fcee204761f9eULL,
+    0x000fcba8d85e11b1ULL, 0x000fc7d26ecd2d23ULL, 0x000fc32b2f1e22edULL,
+    0x000fbd6581c0b83aULL, 0x000fb606c4005434ULL, 0x000fac40582a2873ULL,
+    0x000f9e971e014597ULL, 0x000f89fa48a41dfbULL, 0x000f66c5f7f0302cULL,
+    0x000f1a5a4b331c4aULL
+};
+
+static const double wn_double[256] = {
+    8.68362706080131701e-16, 4.77933017572754885e-17, 6.35435241740514521e-17,
+    7.45487048124761000e-17, 8.32936681579302947e-17, 9.06806040505942312e-17,
+    9.71486007656771254e-17, 1.02947503142409724e-16, 1.08234302884476445e-16,
+    1.13114701961089987e-16, 1.17663594570228891e-16, 1.21936172787143313e-16,
+    1.25974399146370607e-16, 1.29810998862640020e-16, 1.33472037368240932e-16,
+    1.36978648425711737e-16, 1.40348230012423574e-16, 1.43595294520569233e-16,
+    1.46732087423644022e-16, 1.49769046683910220e-16, 1.52715150035961856e-16,
+    1.55578181694607541e-16, 1.58364940092908755e-16, 1.61081401752749205e-16,
+    1.63732852039698433e-16, 1.66323990584208230e-16, 1.68859017086765841e-16,
+    1.71341701765596459e-16, 1.73775443658648495e-16, 1.76163319230009886e-16,
+    1.78508123169767199e-16, 1.80812402857991424e-16, 1.83078487648267428e-16,
+    1.85308513886180091e-16, 1.87504446393738743e-16, 1.89668097007747522e-16,
+    1.91801140648386124e-16, 1.93905129306250963e-16, 1.95981504266288145e-16,
+    1.98031606831281616e-16, 2.00056687762733177e-16, 2.02057915620716416e-16,
+    2.04036384154801995e-16, 2.05993118874036965e-16, 2.07929082904140074e-16,
+    2.09845182223703418e-16, 2.11742270357603345e-16, 2.13621152594498582e-16,
+    2.15482589785814482e-16, 2.17327301775643576e-16, 2.19155970504272610e-16,
+    2.20969242822353102e-16, 2.22767733047895436e-16, 2.24552025294143454e-16,
+    2.26322675592856688e-16, 2.28080213834501608e-16, 2.29825145544246691e-16,
+    2.31557953510407840e-16, 2.33279099280043364e-16, 2.34989024534709354e-16,
+    2.36688152357915791e-16, 2.38376888404542188e-16, 2.40055621981350381e-16,
+    2.41724727046750006e-16, 2.43384563137110089e-16, 2.45035476226149343e-16,
+    2.46677799523270350e-16, 2.48311854216108620e-16, 2.49937950162045193e-16,
+    2.51556386532965737e-16, 2.53167452417135778e-16, 2.54771427381694368e-16,
+    2.56368581998939585e-16, 2.57959178339286625e-16, 2.59543470433516922e-16,
+    2.61121704706701791e-16, 2.62694120385972417e-16, 2.64260949884118853e-16,
+    2.65822419160830582e-16, 2.67378748063236231e-16, 2.68930150647261493e-16,
+    2.70476835481199420e-16, 2.72019005932773108e-16, 2.73556860440867810e-16,
+    2.75090592773016566e-16, 2.76620392269638884e-16, 2.78146444075954262e-16,
+    2.79668929362422857e-16, 2.81188025534501926e-16, 2.82703906432447775e-16,
+    2.84216742521840459e-16, 2.85726701075459952e-16, 2.87233946347097797e-16,
+    2.88738639737847995e-16, 2.90240939955384036e-16, 2.91741003166694356e-16,
+    2.93238983144718016e-16, 2.94735031409293292e-16, 2.96229297362806451e-16,
+    2.97721928420902743e-16, 2.99213070138601159e-16, 3.00702866332132955e-16,
+    3.02191459196806053e-16, 3.03678989421180086e-16, 3.05165596297821824e-16,
+    3.06651417830895402e-16, 3.08136590840829668e-16, 3.09621251066292204e-16,
+    3.11105533263689248e-16, 3.12589571304399843e-16, 3.14073498269944617e-16,
+    3.15557446545280064e-16, 3.17041547910402853e-16, 3.18525933630440649e-16,
+    3.20010734544401138e-16, 3.21496081152744705e-16, 3.22982103703941558e-16,
+    3.24468932280169778e-16, 3.25956696882307838e-16, 3.27445527514370672e-16,
+    3.28935554267536968e-16, 3.30426907403912839e-16, 3.31919717440175234e-16,
+    3.33414115231237246e-16, 3.34910232054077845e-16, 3.36408199691876508e-16,
+    3.37908150518594980e-16, 3.39410217584148914e-16, 3.40914534700312604e-16,
+    3.42421236527501816e-16, 3.43930458662583134e-16, 3.45442337727858402e-16,
+    3.46957011461378353e-16, 3.48474618808741371e-16, 3.49995300016538100e-16,
+    3.51519196727607441e-16, 3.53046452078274009e-16, 3.54577210797743572e-16,
+    3.56111619309838843e-16, 3.57649825837265051e-16, 3.59191980508602995e-16,
+    3.60738235468235138e-16, 3.62288744989419152e-16, 3.63843665590734439e-16,
+    3.65403156156136996e-16, 3.66967378058870090e-16, 3.68536495289491352e-16,
+    3.70110674588289786e-16, 3.71690085582382199e-16, 3.73274900927794254e-16,
+    3.74865296456848721e-16, 3.76461451331202721e-16, 3.78063548200895890e-16,
+    3.79671773369794327e-16, 3.81286316967837640e-16, 3.82907373130524170e-16,
+    3.84535140186095759e-16, 3.86169820850914730e-16, 3.87811622433558475e-16,
+    3.89460757048192374e-16, 3.91117441837820296e-16, 3.92781899208053907e-16,
+    3.94454357072087416e-16, 3.96135049107613198e-16, 3.97824215026467914e-16,
+    3.99522100857856157e-16, 4.01228959246062612e-16, 4.02945049763632497e-16,
+    4.04670639241074699e-16, 4.06406002114224694e-16, 4.08151420790493479e-16,
+    4.09907186035326249e-16, 4.11673597380302126e-16, 4.13450963554423107e-16,
+    4.15239602940268292e-16, 4.17039844056831045e-16, 4.18852026071010687e-16,
+    4.20676499339901018e-16, 4.22513625986204444e-16, 4.24363780509307352e-16,
+    4.26227350434779415e-16, 4.28104737005311272e-16, 4.29996355916382885e-16,
+    4.31902638100262599e-16, 4.33824030562278785e-16, 4.35760997273684605e-16,
+    4.37714020125858451e-16, 4.39683599951051842e-16, 4.41670257615420053e-16,
+    4.43674535190656431e-16, 4.45696997211204011e-16, 4.47738232024753091e-16,
+    4.49798853244554672e-16, 4.51879501313005580e-16, 4.53980845187003105e-16,
+    4.56103584156741911e-16, 4.58248449810956371e-16, 4.60416208163114986e-16,
+    4.62607661954784272e-16, 4.64823653154320442e-16, 4.67065065671262862e-16,
+    4.69332828309332693e-16, 4.71627917983835031e-16, 4.73951363232586617e-16,
+    4.76304248053313639e-16, 4.78687716104872186e-16, 4.81102975314741622e-16,
+    4.83551302941152417e-16, 4.86034051145081097e-16, 4.88552653135360245e-16,
+    4.91108629959526857e-16, 4.93703598024033356e-16, 4.96339277440398627e-16,
+    4.99017501309182147e-16, 5.01740226071808946e-16, 5.04509543081872749e-16,
+    5.07327691573354108e-16, 5.10197073234156086e-16, 5.13120268630678275e-16,
+    5.16100055774322726e-16, 5.19139431175769761e-16, 5.22241633800023330e-16,
+    5.25410172417759535e-16, 5.28648856950494216e-16, 5.31961834533839742e-16,
+    5.35353631181649392e-16, 5.38829200133405024e-16, 5.42393978220170938e-16,
+    5.46053951907477745e-16, 5.49815735089281115e-16, 5.53686661246787305e-16,
+    5.57674893292657352e-16, 5.61789555355541370e-16, 5.66040892008242020e-16,
+    5.70440462129138711e-16, 5.75001376891989425e-16, 5.79738594572459266e-16,
+    5.84669289345547802e-16, 5.89813317647789844e-16, 5.95193814964144317e-16,
+    6.00837969627190734e-16, 6.06778040933344753e-16, 6.13052720872527962e-16,
+    6.19708989458162457e-16, 6.26804696330128242e-16, 6.34412240712750401e-16,
+    6.42623965954805442e-16, 6.51560331734499160e-16, 6.61382788509766218e-16,
+    6.72315046250558466e-16, 6.84680341756425679e-16, 6.98971833638761798e-16,
+    7.15999493483066224e-16, 7.37242430179879694e-16, 7.65893637080557177e-16,
+    8.11384933765648419e-16
+};
+
+static const double fn_double[256] = {
+    1.00000000000000000e+00, 9.77101701267673373e-01, 9.59879091800108109e-01,
+    9.45198953442300871e-01, 9.32060075959231571e-01, 9.19991505039348012e-01,
+    9.08726440052131768e-01, 8.98095921898344307e-01, 8.87984660755834154e-01,
+    8.78309655808918066e-01, 8.69008688036857713e-01, 8.60033621196332199e-01,
+    8.51346258458678617e-01, 8.42915653112204843e-01, 8.34716292986884101e-01,
+    8.26726833946222039e-01, 8.18929191603702922e-01, 8.11307874312656718e-01,
+    8.03849483170964718e-01, 7.96542330422959299e-01, 7.89376143566024924e-01,
+    7.82341832654802727e-01, 7.75431304981187397e-01, 7.68637315798486487e-01,
+    7.61953346836795498e-01, 7.55373506507096448e-01, 7.48892447219157154e-01,
+    7.42505296340151388e-01, 7.36207598126862983e-01, 7.29995264561476453e-01,
+    7.23864533468630444e-01, 7.17811932630722183e-01, 7.11834248878248643e-01,
+    7.05928501332754532e-01, 7.00091918136511837e-01, 6.94321916126116934e-01,
+    6.88616083004672030e-01, 6.82972161644995079e-01, 6.77388036218773748e-01,
+    6.71861719897082432e-01, 6.66391343908750433e-01, 6.60975147776663441e-01,
+    6.55611470579697597e-01, 6.50298743110817035e-01, 6.45035480820822626e-01,
+    6.39820277453056807e-01, 6.34651799287623830e-01, 6.29528779924836912e-01,
+    6.24450015547026727e-01, 6.19414360605834546e-01, 6.14420723888914111e-01,
+    6.09468064925773656e-01, 6.04555390697467998e-01, 5.99681752619125596e-01,
+    5.94846243767987670e-01, 5.90047996332826230e-01, 5.85286179263371786e-01,
+    5.80559996100791453e-01, 5.75868682972354273e-01, 5.71211506735253782e-01,
+    5.66587763256165000e-01, 5.61996775814525118e-01, 5.57437893618766611e-01,
+    5.52910490425832957e-01, 5.48413963255266368e-01, 5.43947731190026706e-01,
+    5.39511234256952577e-01, 5.35103932380457947e-01, 5.30725304403662279e-01,
+    5.26374847171684590e-01, 5.22052074672321953e-01, 5.17756517229756463e-01,
+    5.13487720747327181e-01, 5.09245245995748164e-01, 5.05028667943468457e-01,
+    5.00837575126149126e-01, 4.96671569052490103e-01, 4.92530263643868815e-01,
+    4.88413284705458306e-01, 4.84320269426683603e-01, 4.80250865909047031e-01,
+    4.76204732719506141e-01, 4.72181538467730422e-01, 4.68180961405693874e-01,
+    4.64202689048174633e-01, 4.60246417812843200e-01, 4.56311852678716767e-01,
+    4.52398706861848965e-01, 4.48506701507203398e-01, 4.44635565395739785e-01,
+    4.40785034665804376e-01, 4.36954852547985995e-01, 4.33144769112652761e-01,
+    4.29354541029441927e-01, 4.25583931338022414e-01, 4.21832709229496339e-01,
+    4.18100649837848615e-01, 4.14387534040891625e-01, 4.10693148270188657e-01,
+    4.07017284329473761e-01, 4.03359739221114844e-01, 3.99720314980197555e-01,
+    3.96098818515832729e-01, 3.92495061459315842e-01, 3.88908860018788938e-01,
+    3.85340034840077450e-01, 3.81788410873393769e-01, 3.78253817245619295e-01,
+    3.74736087137891249e-01, 3.71235057668239554e-01, 3.67750569779032588e-01,
+    3.64282468129004056e-01, 3.60830600989648032e-01, 3.57394820145780501e-01,
+    3.53974980800076777e-01, 3.50570941481406106e-01, 3.47182563956793644e-01,
+    3.43809713146850715e-01, 3.40452257044521867e-01, 3.37110066637006045e-01,
+    3.33783015830718455e-01, 3.30470981379163586e-01, 3.27173842813601401e-01,
+    3.23891482376391093e-01, 3.20623784956905356e-01, 3.17370638029913610e-01,
+    3.14131931596337177e-01, 3.10907558126286510e-01, 3.07697412504292056e-01,
+    3.04501391976649993e-01, 3.01319396100803050e-01, 2.98151326696685481e-01,
+    2.94997087799961810e-01, 2.91856585617095210e-01, 2.88729728482182924e-01,
+    2.85616426815501756e-01, 2.82516593083707579e-01, 2.79430141761637940e-01,
+    2.76356989295668320e-01, 2.73297054068577072e-01, 2.70250256365875463e-01,
+    2.67216518343561471e-01, 2.64195763997261190e-01, 2.61187919132721214e-01,
+    2.58192911337619235e-01, 2.55210669954661962e-01, 2.52241126055942233e-01,
+    2.49284212418528578e-01, 2.46339863501263995e-01, 2.43408015422750479e-01,
+    2.40488605940500838e-01, 2.37581574431238340e-01, 2.34686861872330260e-01,
+    2.31804410824338891e-01, 2.28934165414680535e-01, 2.26076071322380528e-01,
+    2.23230075763917818e-01, 2.20396127480152332e-01, 2.17574176724331519e-01,
+    2.14764175251174000e-01, 2.11966076307030599e-01, 2.09179834621125493e-01,
+    2.06405406397881241e-01, 2.03642749310335436e-01, 2.00891822494657174e-01,
+    1.98152586545775666e-01, 1.95425003514134804e-01, 1.92709036903589648e-01,
+    1.90004651670465458e-01, 1.87311814223800804e-01, 1.84630492426799853e-01,
+    1.81960655599523125e-01, 1.79302274522848221e-01, 1.76655321443735552e-01,
+    1.74019770081839359e-01, 1.71395595637506504e-01, 1.68782774801212093e-01,
+    1.66181285764482628e-01, 1.63591108232366278e-01, 1.61012223437511648e-01,
+    1.58444614155924840e-01, 1.55888264724479753e-01, 1.53343161060263300e-01,
+    1.50809290681846148e-01, 1.48286642732574941e-01, 1.45775208005994417e-01,
+    1.43274978973513822e-01, 1.40785949814445061e-01, 1.38308116448551094e-01,
+    1.35841476571254116e-01, 1.33386029691669517e-01, 1.30941777173644719e-01,
+    1.28508722279999904e-01, 1.26086870220186276e-01, 1.23676228201596905e-01,
+    1.21276805484790626e-01, 1.18888613442910379e-01, 1.16511665625611230e-01,
+    1.14145977827838779e-01, 1.11791568163838437e-01, 1.09448457146812048e-01,
+    1.07116667774683996e-01, 1.04796225622487207e-01, 1.02487158941935344e-01,
+    1.00189498768810101e-01, 9.79032790388625895e-02, 9.56285367130090824e-02,
+    9.33653119126910958e-02, 9.11136480663738285e-02, 8.88735920682759695e-02,
+    8.66451944505581412e-02, 8.44285095703535410e-02, 8.22235958132029876e-02,
+    8.00305158146631529e-02, 7.78493367020961224e-02, 7.56801303589271779e-02,
+    7.35229737139813794e-02, 7.13779490588904719e-02, 6.92451443970068248e-02,
+    6.71246538277885663e-02, 6.50165779712429531e-02, 6.29210244377582245e-02,
+    6.08381083495400168e-02, 5.87679529209339246e-02, 5.67106901062030822e-02,
+    5.46664613248890943e-02, 5.26354182767923770e-02, 5.06177238609479413e-02,
+    4.86135532158686948e-02, 4.66230949019305271e-02, 4.46465522512946023e-02,
+    4.26841449164746117e-02, 4.07361106559410852e-02, 3.88027074045262377e-02,
+    3.68842156885674025e-02, 3.49809414617161737e-02, 3.30932194585786196e-02,
+    3.12214171919203282e-02, 2.93659397581333866e-02, 2.75272356696031478e-02,
+    2.57058040085489450e-02, 2.39022033057959098e-02, 2.21170627073088988e-02,
+    2.03510962300445380e-02, 1.86051212757246710e-02, 1.68800831525431870e-02,
+    1.51770883079353370e-02, 1.34974506017398899e-02, 1.18427578579079103e-02,
+    1.02149714397014868e-02, 8.61658276939874894e-03, 7.05087547137324151e-03,
+    5.52240329925101064e-03, 4.03797259336303744e-03, 2.60907274610216403e-03,
+    1.26028593049859797e-03
+};
+
+static const npy_uint32 kn_float[256] = {
+    0x007799ecUL, 0x00000000UL, 0x006045f4UL, 0x006d1aa7UL, 0x00728fb3UL,
+    0x007592afUL, 0x00777a5cUL, 0x0078ca38UL, 0x0079bf6bUL, 0x007a7a34UL,
+    0x007b0d2fUL, 0x007b83d3UL, 0x007be597UL, 0x007c3788UL, 0x007c7d32UL,
+    0x007cb926UL, 0x007ced48UL, 0x007d1b07UL, 0x007d437eUL, 0x007d678bUL,
+    0x007d87dbUL, 0x007da4fcUL, 0x007dbf61UL, 0x007dd767UL, 0x007ded5cUL,
+    0x007e0183UL, 0x007e1410UL, 0x007e2533UL, 0x007e3514UL, 0x007e43d5UL,
+    0x007e5192UL, 0x007e5e67UL, 0x007e6a68UL, 0x007e75aaUL, 0x007e803dUL,
+    0x007e8a32UL, 0x007e9395UL, 0x007e9c72UL, 0x007ea4d4UL, 0x007eacc5UL,
+    0x007eb44eUL, 0x007ebb75UL, 0x007ec242UL, 0x007ec8bcUL, 0x007ecee8UL,
+    0x007ed4cbUL, 0x007eda6aUL, 0x007edfcaUL, 0x007ee4efUL, 0x007ee9dcUL,
+    0x007eee94UL, 0x007ef31bUL, 0x007ef773UL, 0x007efba0UL, 0x007effa3UL,
+    0x007f037fUL, 0x007f0736UL, 0x007f0ac9UL, 0x007f0e3cUL, 0x007f118fUL,
+    0x007f14c4UL, 0x007f17dcUL, 0x007f1ad9UL, 0x007f1dbcUL, 0x007f2087UL,
+    0x007f233aUL, 0x007f25d6UL, 0x007f285dUL, 0x007f2acfUL, 0x007f2d2eUL,
+    0x007f2f79UL, 0x007f31b3UL, 0x007f33dbUL, 0x007f35f3UL, 0x007f37faUL,
+    0x007f39f2UL, 0x007f3bdcUL, 0x007f3db7UL, 0x007f3f84UL, 0x007f4144UL,
+    0x007f42f7UL, 0x007f449eUL, 0x007f463aUL, 0x007f47c9UL, 0x007f494eUL,
+    0x007f4ac8UL, 0x007f4c37UL, 0x007f4d9dUL, 0x007f4ef9UL, 0x007f504bUL,
+    0x007f5194UL, 0x007f52d5UL, 0x007f540dUL, 0x007f553cUL, 0x007f5664UL,
+    0x007f5783UL, 0x007f589bUL, 0x007f59acUL, 0x007f5ab5UL, 0x007f5bb7UL,
+    0x007f5cb2UL, 0x007f5da7UL, 0x007f5e95UL, 0x007f5f7dUL, 0x007f605fUL,
+    0x007f613aUL, 0x007f6210UL, 0x007f62dfUL, 0x007f63aaUL, 0x007f646eUL,
+    0x007f652dUL, 0x007f65e7UL, 0x007f669cUL, 0x007f674bUL, 0x007f67f6UL,
+    0x007f689bUL, 0x007f693cUL, 0x007f69d8UL, 0x007f6a6fUL, 0x007f6b02UL,
+    0x007f6b90UL, 0x007f6c1aUL, 0x007f6ca0UL, 0x007f6d21UL, 0x007f6d9eUL,
+    0x007f6e16UL, 0x007f6e8bUL, 0x007f6efcUL, 0x007f6f68UL, 0x007f6fd0UL,
+    0x007f7035UL, 0x007f7096UL, 0x007f70f2UL, 0x007f714bUL, 0x007f71a0UL,
+    0x007f71f1UL, 0x007f723fUL, 0x007f7289UL, 0x007f72cfUL, 0x007f7311UL,
+    0x007f7350UL, 0x007f738bUL, 0x007f73c2UL, 0x007f73f6UL, 0x007f7426UL,
+    0x007f7453UL, 0x007f747bUL, 0x007f74a1UL, 0x007f74c2UL, 0x007f74e0UL,
+    0x007f74faUL, 0x007f7511UL, 0x007f7524UL, 0x007f7533UL, 0x007f753eUL,
+    0x007f7546UL, 0x007f754aUL, 0x007f754aUL, 0x007f7546UL, 0x007f753fUL,
+    0x007f7533UL, 0x007f7524UL, 0x007f7510UL, 0x007f74f9UL, 0x007f74ddUL,
+    0x007f74beUL, 0x007f749aUL, 0x007f7472UL, 0x007f7445UL, 0x007f7414UL,
+    0x007f73deUL, 0x007f73a4UL, 0x007f7366UL, 0x007f7322UL, 0x007f72daUL,
+    0x007f728cUL, 0x007f723aUL, 0x007f71e2UL, 0x007f7185UL, 0x007f7123UL,
+    0x007f70baUL, 0x007f704dUL, 0x007f6fd9UL, 0x007f6f5fUL, 0x007f6edfUL,
+    0x007f6e58UL, 0x007f6dcbUL, 0x007f6d36UL, 0x007f6c9bUL, 0x007f6bf8UL,
+    0x007f6b4eUL, 0x007f6a9cUL, 0x007f69e2UL, 0x007f691fUL, 0x007f6853UL,
+    0x007f677eUL, 0x007f66a0UL, 0x007f65b8UL, 0x007f64c5UL, 0x007f63c8UL,
+    0x007f62bfUL, 0x007f61abUL, 0x007f608aUL, 0x007f5f5cUL, 0x007f5e21UL,
+    0x007f5cd7UL, 0x007f5b7fUL, 0x007f5a16UL, 0x007f589dUL, 0x007f5712UL,
+    0x007f5575UL, 0x007f53c4UL, 0x007f51feUL, 0x007f5022UL, 0x007f4e2eUL,
+    0x007f4c21UL, 0x007f49faUL, 0x007f47b5UL, 0x007f4552UL, 0x007f42cfUL,
+    0x007f4027UL, 0x007f3d5aUL, 0x007f3a63UL, 0x007f3740UL, 0x007f33edUL,
+    0x007f3064UL, 0x007f2ca3UL, 0x007f28a3UL, 0x007f245eUL, 0x007f1fcdUL,
+    0x007f1ae9UL, 0x007f15a8UL, 0x007f1000UL, 0x007f09e4UL, 0x007f0346UL,
+    0x007efc15UL, 0x007ef43eUL, 0x007eeba8UL, 0x007ee237UL, 0x007ed7c7UL,
+    0x007ecc2fUL, 0x007ebf37UL, 0x007eb09dUL, 0x007ea00aUL, 0x007e8d0dUL,
+    0x007e7710UL, 0x007e5d46UL, 0x007e3e93UL, 0x007e1959UL, 0x007deb2cUL,
+    0x007db036UL, 0x007d6202UL, 0x007cf4b8UL, 0x007c4fd2UL, 0x007b362fUL,
+    0x0078d2d2UL
+};
+
+static const float wn_float[256] = {
+    4.661986780e-07f, 2.565883350e-08f, 3.411466978e-08f, 4.002303114e-08f,
+    4.471794759e-08f, 4.868377860e-08f, 5.215625789e-08f, 5.526951990e-08f,
+    5.810784890e-08f, 6.072799320e-08f, 6.317016133e-08f, 6.546398429e-08f,
+    6.763199056e-08f, 6.969174935e-08f, 7.165725443e-08f, 7.353985190e-08f,
+    7.534888224e-08f, 7.709213673e-08f, 7.877618959e-08f, 8.040664468e-08f,
+    8.198832188e-08f, 8.352540029e-08f, 8.502152982e-08f, 8.647991907e-08f,
+    8.790340560e-08f, 8.929451251e-08f, 9.065549450e-08f, 9.198837569e-08f,
+    9.329498092e-08f, 9.457696186e-08f, 9.583581889e-08f, 9.707291962e-08f,
+    9.828951463e-08f, 9.948675085e-08f, 1.006656831e-07f, 1.018272842e-07f,
+    1.029724533e-07f, 1.041020236e-07f, 1.052167689e-07f, 1.063174094e-07f,
+    1.074046164e-07f, 1.084790174e-07f, 1.095411996e-07f, 1.105917136e-07f,
+    1.116310764e-07f, 1.126597744e-07f, 1.136782658e-07f, 1.146869830e-07f,
+    1.156863345e-07f, 1.166767067e-07f, 1.176584658e-07f, 1.186319589e-07f,
+    1.195975160e-07f, 1.205554506e-07f, 1.215060613e-07f, 1.224496324e-07f,
+    1.233864355e-07f, 1.243167297e-07f, 1.252407628e-07f, 1.261587719e-07f,
+    1.270709842e-07f, 1.279776175e-07f, 1.288788807e-07f, 1.297749747e-07f,
+    1.306660924e-07f, 1.315524196e-07f, 1.324341352e-07f, 1.333114116e-07f,
+    1.341844152e-07f, 1.350533067e-07f, 1.359182411e-07f, 1.367793686e-07f,
+    1.376368344e-07f, 1.384907793e-07f, 1.393413397e-07f, 1.401886477e-07f,
+    1.410328320e-07f, 1.418740172e-07f, 1.427123246e-07f, 1.435478723e-07f,
+    1.443807752e-07f, 1.452111453e-07f, 1.460390918e-07f, 1.468647211e-07f,
+    1.476881374e-07f, 1.485094423e-07f, 1.493287351e-07f, 1.501461132e-07f,
+    1.509616717e-07f, 1.517755041e-07f, 1.525877018e-07f, 1.533983546e-07f,
+    1.542075507e-07f, 1.550153768e-07f, 1.558219181e-07f, 1.566272584e-07f,
+    1.574314803e-07f, 1.582346651e-07f, 1.590368930e-07f, 1.598382432e-07f,
+    1.606387938e-07f, 1.614386221e-07f, 1.622378043e-07f, 1.630364160e-07f,
+    1.638345320e-07f, 1.646322264e-07f, 1.654295725e-07f, 1.662266434e-07f,
+    1.670235114e-07f, 1.678202482e-07f, 1.686169255e-07f, 1.694136141e-07f,
+    1.702103850e-07f, 1.710073085e-07f, 1.718044549e-07f, 1.726018943e-07f,
+    1.733996966e-07f, 1.741979316e-07f, 1.749966691e-07f, 1.757959790e-07f,
+    1.765959310e-07f, 1.773965951e-07f, 1.781980414e-07f, 1.790003401e-07f,
+    1.798035617e-07f, 1.806077770e-07f, 1.814130569e-07f, 1.822194731e-07f,
+    1.830270972e-07f, 1.838360015e-07f, 1.846462590e-07f, 1.854579429e-07f,
+    1.862711272e-07f, 1.870858864e-07f, 1.879022959e-07f, 1.887204317e-07f,
+    1.895403707e-07f, 1.903621905e-07f, 1.911859698e-07f, 1.920117882e-07f,
+    1.928397262e-07f, 1.936698655e-07f, 1.945022889e-07f, 1.953370806e-07f,
+    1.961743257e-07f, 1.970141109e-07f, 1.978565243e-07f, 1.987016554e-07f,
+    1.995495952e-07f, 2.004004365e-07f, 2.012542736e-07f, 2.021112027e-07f,
+    2.029713219e-07f, 2.038347312e-07f, 2.047015327e-07f, 2.055718306e-07f,
+    2.064457314e-07f, 2.073233439e-07f, 2.082047794e-07f, 2.090901518e-07f,
+    2.099795777e-07f, 2.108731764e-07f, 2.117710704e-07f, 2.126733851e-07f,
+    2.135802491e-07f, 2.144917947e-07f, 2.154081573e-07f, 2.163294764e-07f,
+    2.172558951e-07f, 2.181875610e-07f, 2.191246255e-07f, 2.200672448e-07f,
+    2.210155797e-07f, 2.219697959e-07f, 2.229300643e-07f, 2.238965614e-07f,
+    2.248694692e-07f, 2.258489759e-07f, 2.268352757e-07f, 2.278285699e-07f,
+    2.288290663e-07f, 2.298369806e-07f, 2.308525358e-07f, 2.318759632e-07f,
+    2.329075029e-07f, 2.339474040e-07f, 2.349959252e-07f, 2.360533353e-07f,
+    2.371199140e-07f, 2.381959523e-07f, 2.392817534e-07f, 2.403776330e-07f,
+    2.414839206e-07f, 2.426009600e-07f, 2.437291104e-07f, 2.448687472e-07f,
+    2.460202632e-07f, 2.471840696e-07f, 2.483605974e-07f, 2.495502986e-07f,
+    2.507536478e-07f, 2.519711436e-07f, 2.532033105e-07f, 2.544507006e-07f,
+    2.557138960e-07f, 2.569935107e-07f, 2.582901931e-07f, 2.596046290e-07f,
+    2.609375443e-07f, 2.622897084e-07f, 2.636619381e-07f, 2.650551009e-07f,
+    2.664701205e-07f, 2.679079810e-07f, 2.693697328e-07f, 2.708564985e-07f,
+    2.723694805e-07f, 2.739099680e-07f, 2.754793466e-07f, 2.770791076e-07f,
+    2.787108599e-07f, 2.803763422e-07f, 2.820774384e-07f, 2.838161940e-07f,
+    2.855948353e-07f, 2.874157922e-07f, 2.892817241e-07f, 2.911955498e-07f,
+    2.931604832e-07f, 2.951800751e-07f, 2.972582628e-07f, 2.993994286e-07f,
+    3.016084709e-07f, 3.038908899e-07f, 3.062528911e-07f, 3.087015136e-07f,
+    3.112447880e-07f, 3.138919346e-07f, 3.166536138e-07f, 3.195422463e-07f,
+    3.225724287e-07f, 3.257614802e-07f, 3.291301734e-07f, 3.327037303e-07f,
+    3.365132090e-07f, 3.405974783e-07f, 3.450061147e-07f, 3.498037895e-07f,
+    3.550771808e-07f, 3.609463920e-07f, 3.675849595e-07f, 3.752576458e-07f,
+    3.843993011e-07f, 3.958040159e-07f, 4.111860154e-07f, 4.356089694e-07f
+};
+
+static const float fn_float[256] = {
+    1.000000000e+00f, 9.771017013e-01f, 9.598790918e-01f, 9.451989534e-01f,
+    9.320600760e-01f, 9.199915050e-01f, 9.087264401e-01f, 8.980959219e-01f,
+    8.879846608e-01f, 8.783096558e-01f, 8.690086880e-01f, 8.600336212e-01f,
+    8.513462585e-01f, 8.429156531e-01f, 8.347162930e-01f, 8.267268339e-01f,
+    8.189291916e-01f, 8.113078743e-01f, 8.038494832e-01f, 7.965423304e-01f,
+    7.893761436e-01f, 7.823418327e-01f, 7.754313050e-01f, 7.686373158e-01f,
+    7.619533468e-01f, 7.553735065e-01f, 7.488924472e-01f, 7.425052963e-01f,
+    7.362075981e-01f, 7.299952646e-01f, 7.238645335e-01f, 7.178119326e-01f,
+    7.118342489e-01f, 7.059285013e-01f, 7.000919181e-01f, 6.943219161e-01f,
+    6.886160830e-01f, 6.829721616e-01f, 6.773880362e-01f, 6.718617199e-01f,
+    6.663913439e-01f, 6.609751478e-01f, 6.556114706e-01f, 6.502987431e-01f,
+    6.450354808e-01f, 6.398202775e-01f, 6.346517993e-01f, 6.295287799e-01f,
+    6.244500155e-01f, 6.194143606e-01f, 6.144207239e-01f, 6.094680649e-01f,
+    6.045553907e-01f, 5.996817526e-01f, 5.948462438e-01f, 5.900479963e-01f,
+    5.852861793e-01f, 5.805599961e-01f, 5.758686830e-01f, 5.712115067e-01f,
+    5.665877633e-01f, 5.619967758e-01f, 5.574378936e-01f, 5.529104904e-01f,
+    5.484139633e-01f, 5.439477312e-01f, 5.395112343e-01f, 5.351039324e-01f,
+    5.307253044e-01f, 5.263748472e-01f, 5.220520747e-01f, 5.177565172e-01f,
+    5.134877207e-01f, 5.092452460e-01f, 5.050286679e-01f, 5.008375751e-01f,
+    4.966715691e-01f, 4.925302636e-01f, 4.884132847e-01f, 4.843202694e-01f,
+    4.802508659e-01f, 4.762047327e-01f, 4.721815385e-01f, 4.681809614e-01f,
+    4.642026890e-01f, 4.602464178e-01f, 4.563118527e-01f, 4.523987069e-01f,
+    4.485067015e-01f, 4.446355654e-01f, 4.407850347e-01f, 4.369548525e-01f,
+    4.331447691e-01f, 4.293545410e-01f, 4.255839313e-01f, 4.218327092e-01f,
+    4.181006498e-01f, 4.143875340e-01f, 4.106931483e-01f, 4.070172843e-01f,
+    4.033597392e-01f, 3.997203150e-01f, 3.960988185e-01f, 3.924950615e-01f,
+    3.889088600e-01f, 3.853400348e-01f, 3.817884109e-01f, 3.782538172e-01f,
+    3.747360871e-01f, 3.712350577e-01f, 3.677505698e-01f, 3.642824681e-01f,
+    3.608306010e-01f, 3.573948201e-01f, 3.539749808e-01f, 3.505709415e-01f,
+    3.471825640e-01f, 3.438097131e-01f, 3.404522570e-01f, 3.371100666e-01f,
+    3.337830158e-01f, 3.304709814e-01f, 3.271738428e-01f, 3.238914824e-01f,
+    3.206237850e-01f, 3.173706380e-01f, 3.141319316e-01f, 3.109075581e-01f,
+    3.076974125e-01f, 3.045013920e-01f, 3.013193961e-01f, 2.981513267e-01f,
+    2.949970878e-01f, 2.918565856e-01f, 2.887297285e-01f, 2.856164268e-01f,
+    2.825165931e-01f, 2.794301418e-01f, 2.763569893e-01f, 2.732970541e-01f,
+    2.702502564e-01f, 2.672165183e-01f, 2.641957640e-01f, 2.611879191e-01f,
+    2.581929113e-01f, 2.552106700e-01f, 2.522411261e-01f, 2.492842124e-01f,
+    2.463398635e-01f, 2.434080154e-01f, 2.404886059e-01f, 2.375815744e-01f,
+    2.346868619e-01f, 2.318044108e-01f, 2.289341654e-01f, 2.260760713e-01f,
+    2.232300758e-01f, 2.203961275e-01f, 2.175741767e-01f, 2.147641753e-01f,
+    2.119660763e-01f, 2.091798346e-01f, 2.064054064e-01f, 2.036427493e-01f,
+    2.008918225e-01f, 1.981525865e-01f, 1.954250035e-01f, 1.927090369e-01f,
+    1.900046517e-01f, 1.873118142e-01f, 1.846304924e-01f, 1.819606556e-01f,
+    1.793022745e-01f, 1.766553214e-01f, 1.740197701e-01f, 1.713955956e-01f,
+    1.687827748e-01f, 1.661812858e-01f, 1.635911082e-01f, 1.610122234e-01f,
+    1.584446142e-01f, 1.558882647e-01f, 1.533431611e-01f, 1.508092907e-01f,
+    1.482866427e-01f, 1.457752080e-01f, 1.432749790e-01f, 1.407859498e-01f,
+    1.383081164e-01f, 1.358414766e-01f, 1.333860297e-01f, 1.309417772e-01f,
+    1.285087223e-01f, 1.260868702e-01f, 1.236762282e-01f, 1.212768055e-01f,
+    1.188886134e-01f, 1.165116656e-01f, 1.141459778e-01f, 1.117915682e-01f,
+    1.094484571e-01f, 1.071166678e-01f, 1.047962256e-01f, 1.024871589e-01f,
+    1.001894988e-01f, 9.790327904e-02f, 9.562853671e-02f, 9.336531191e-02f,
+    9.111364807e-02f, 8.887359207e-02f, 8.664519445e-02f, 8.442850957e-02f,
+    8.222359581e-02f, 8.003051581e-02f, 7.784933670e-02f, 7.568013036e-02f,
+    7.352297371e-02f, 7.137794906e-02f, 6.924514440e-02f, 6.712465383e-02f,
+    6.501657797e-02f, 6.292102444e-02f, 6.083810835e-02f, 5.876795292e-02f,
+    5.671069011e-02f, 5.466646132e-02f, 5.263541828e-02f, 5.061772386e-02f,
+    4.861355322e-02f, 4.662309490e-02f, 4.464655225e-02f, 4.268414492e-02f,
+    4.073611066e-02f, 3.880270740e-02f, 3.688421569e-02f, 3.498094146e-02f,
+    3.309321946e-02f, 3.122141719e-02f, 2.936593976e-02f, 2.752723567e-02f,
+    2.570580401e-02f, 2.390220331e-02f, 2.211706271e-02f, 2.035109623e-02f,
+    1.860512128e-02f, 1.688008315e-02f, 1.517708831e-02f, 1.349745060e-02f,
+    1.184275786e-02f, 1.021497144e-02f, 8.616582769e-03f, 7.050875471e-03f,
+    5.522403299e-03f, 4.037972593e-03f, 2.609072746e-03f, 1.260285930e-03f
+};
+
+static const npy_uint64 ke_double[256] = {
+    0x001c5214272497c7ULL, 0x0000000000000000ULL, 0x00137d5bd79c3243ULL,
+    0x00186ef58e3f3c5bULL, 0x001a9bb7320eb0d6ULL, 0x001bd127f7194492ULL,
+    0x001c951d0f886528ULL, 0x001d1bfe2d5c397cULL, 0x001d7e5bd56b18bcULL,
+    0x001dc934dd172c77ULL, 0x001e0409dfac9dd0ULL, 0x001e337b71d4783cULL,
+    0x001e5a8b177cb7a6ULL, 0x001e7b42096f046eULL, 0x001e970daf08ae42ULL,
+    0x001eaef5b14ef09fULL, 0x001ec3bd07b4655cULL, 0x001ed5f6f08799cfULL,
+    0x001ee614ae6e5689ULL, 0x001ef46eca361cd0ULL, 0x001f014b76ddd4a8ULL,
+    0x001f0ce313a796b9ULL, 0x001f176369f1f77dULL, 0x001f20f20c452571ULL,
+    0x001f29ae1951a876ULL, 0x001f31b18fb95533ULL, 0x001f39125157c107ULL,
+    0x001f3fe2eb6e694eULL, 0x001f463332d788faULL, 0x001f4c10bf1d3a11ULL,
+    0x001f51874c5c3324ULL, 0x001f56a109c3ecc0ULL, 0x001f5b66d9099998ULL,
+    0x001f5fe08210d08dULL, 0x001f6414dd445771ULL, 0x001f6809f685967aULL,
+    0x001f6bc52a2b02e8ULL, 0x001f6f4b3d32e4f5ULL, 0x001f72a07190f13bULL,
+    0x001f75c8974d09d8ULL, 0x001f78c71b045cc1ULL, 0x001f7b9f12413ff7ULL,
+    0x001f7e5346079f8aULL, 0x001f80e63be21138ULL, 0x001f835a3dad9162ULL,
+    0x001f85b16056b915ULL, 0x001f87ed89b24262ULL, 0x001f8a10759374fcULL,
+    0x001f8c1bba3d39adULL, 0x001f8e10cc45d04aULL, 0x001f8ff102013e17ULL,
+    0x001f91bd968358e1ULL, 0x001f9377ac47afd9ULL, 0x001f95204f8b64dcULL,
+    0x001f96b878633893ULL, 0x001f98410c968891ULL, 0x001f99bae146ba82ULL,
+    0x001f9b26bc697f00ULL, 0x001f9c85561b717bULL, 0x001f9dd759cfd804ULL,
+    0x001f9f1d6761a1cfULL, 0x001fa058140936c1ULL, 0x001fa187eb3a333aULL,
+    0x001fa2ad6f6bc4fcULL, 0x001fa3c91ace0684ULL, 0x001fa4db5fee6aa3ULL,
+    0x001fa5e4aa4d097eULL, 0x001fa6e55ee46784ULL, 0x001fa7dddca51ec5ULL,
+    0x001fa8ce7ce6a876ULL, 0x001fa9b793ce5ff0ULL, 0x001faa9970adb85aULL,
+    0x001fab745e588233ULL, 0x001fac48a3740585ULL, 0x001fad1682bf9febULL,
+    0x001fadde3b5782c1ULL, 0x001faea008f21d6eULL, 0x001faf5c2418b07eULL,
+    0x001fb012c25b7a15ULL, 0x001fb0c41681dff5ULL, 0x001fb17050b6f1fcULL,
+    0x001fb2179eb2963bULL, 0x001fb2ba2bdfa84bULL, 0x001fb358217f4e19ULL,
+    0x001fb3f1a6c9be0dULL, 0x001fb486e10cacd7ULL, 0x001fb517f3c793fcULL,
+    0x001fb5a500c5fdaaULL, 0x001fb62e2837fe59ULL, 0x001fb6b388c9010cULL,
+    0x001fb7353fb5079aULL, 0x001fb7b368dc7da9ULL, 0x001fb82e1ed6ba0aULL,
+    0x001fb8a57b0347f6ULL, 0x001fb919959a0f74ULL, 0x001fb98a85ba7204ULL,
+    0x001fb9f861796f26ULL, 0x001fba633deee287ULL, 0x001fbacb2f41ec17ULL,
+    0x001fbb3048b49145ULL, 0x001fbb929caea4e4ULL, 0x001fbbf23cc8029eULL,
+    0x001fbc4f39d22996ULL, 0x001fbca9a3e140d5ULL, 0x001fbd018a548fa0ULL,
+    0x001fbd56fbde729dULL, 0x001fbdaa068bd66cULL, 0x001fbdfab7cb3f42ULL,
+    0x001fbe491c7364dfULL, 0x001fbe9540c96960ULL, 0x001fbedf3086b129ULL,
+    0x001fbf26f6de6175ULL, 0x001fbf6c9e828ae3ULL, 0x001fbfb031a904c4ULL,
+    0x001fbff1ba0ffdb2ULL, 0x001fc03141024589ULL, 0x001fc06ecf5b54b4ULL,
+    0x001fc0aa6d8b1428ULL, 0x001fc0e42399698bULL, 0x001fc11bf9298a65ULL,
+    0x001fc151f57d1943ULL, 0x001fc1861f770f4cULL, 0x001fc1b87d9e74b4ULL,
+    0x001fc1e91620ea43ULL, 0x001fc217eed505dfULL, 0x001fc2450d3c8400ULL,
+    0x001fc27076864fc2ULL, 0x001fc29a2f906310ULL, 0x001fc2c23ce98046ULL,
+    0x001fc2e8a2d2c6b5ULL, 0x001fc30d654122eeULL, 0x001fc33087de9c0fULL,
+    0x001fc3520e0b7ec8ULL, 0x001fc371fadf66f8ULL, 0x001fc390512a2887ULL,
+    0x001fc3ad137497faULL, 0x001fc3c844013349ULL, 0x001fc3e1e4ccab40ULL,
+    0x001fc3f9f78e4da9ULL, 0x001fc4107db85061ULL, 0x001fc4257877fd68ULL,
+    0x001fc438e8b5bfc7ULL, 0x001fc44acf15112bULL, 0x001fc45b2bf447e9ULL,
+    0x001fc469ff6c4505ULL, 0x001fc477495001b2ULL, 0x001fc483092bfbbaULL,
+    0x001fc48d3e457ff7ULL, 0x001fc495e799d21cULL, 0x001fc49d03dd30b1ULL,
+    0x001fc4a29179b434ULL, 0x001fc4a68e8e07fcULL, 0x001fc4a8f8ebfb8dULL,
+    0x001fc4a9ce16ea9fULL, 0x001fc4a90b41fa36ULL, 0x001fc4a6ad4e28a1ULL,
+    0x001fc4a2b0c82e76ULL, 0x001fc49d11e62de3ULL, 0x001fc495cc852df4ULL,
+    0x001fc48cdc265ec1ULL, 0x001fc4823bec237aULL, 0x001fc475e696dee7ULL,
+    0x001fc467d6817e83ULL, 0x001fc458059dc038ULL, 0x001fc4466d702e22ULL,
+    0x001fc433070bcb9aULL, 0x001fc41dcb0d6e0eULL, 0x001fc406b196bbf7ULL,
+    0x001fc3edb248cb62ULL, 0x001fc3d2c43e593eULL, 0x001fc3b5de0591b5ULL,
+    0x001fc396f599614dULL, 0x001fc376005a4594ULL, 0x001fc352f3069372ULL,
+    0x001fc32dc1b2281bULL, 0x001fc3065fbd7888ULL, 0x001fc2dcbfcbf264ULL,
+    0x001fc2b0d3b99fa0ULL, 0x001fc2828c8ffcf0ULL, 0x001fc251da79f164ULL,
+    0x001fc21eacb6d39eULL, 0x001fc1e8f18c6757ULL, 0x001fc1b09637bb3dULL,
+    0x001fc17586dccd0fULL, 0x001fc137ae74d6b8ULL, 0x001fc0f6f6bb2416ULL,
+    0x001fc0b348184da4ULL, 0x001fc06c898baff1ULL, 0x001fc022a092f365ULL,
+    0x001fbfd5710f72baULL, 0x001fbf84dd294890ULL, 0x001fbf30c52fc60dULL,
+    0x001fbed907770cc6ULL, 0x001fbe7d80327ddcULL, 0x001fbe1e094ba615ULL,
+    0x001fbdba7a354408ULL, 0x001fbd52a7b9f826ULL, 0x001fbce663c6201bULL,
+    0x001fbc757d2c4de5ULL, 0x001fbbffbf63b7aaULL, 0x001fbb84f23fe6a2ULL,
+    0x001fbb04d9a0d18eULL, 0x001fba7f351a70adULL, 0x001fb9f3bf92b61aULL,
+    0x001fb9622ed4abfcULL, 0x001fb8ca33174a18ULL, 0x001fb82b76765b54ULL,
+    0x001fb7859c5b895dULL, 0x001fb6d840d55594ULL, 0x001fb622f7d96943ULL,
+    0x001fb5654c6f37e2ULL, 0x001fb49ebfbf69d3ULL, 0x001fb3cec803e747ULL,
+    0x001fb2f4cf539c40ULL, 0x001fb21032442854ULL, 0x001fb1203e5a9605ULL,
+    0x001fb0243042e1c3ULL, 0x001faf1b31c479a7ULL, 0x001fae045767e106ULL,
+    0x001facde9dbf2d73ULL, 0x001faba8e640060bULL, 0x001faa61f399ff29ULL,
+    0x001fa908656f66a2ULL, 0x001fa79ab3508d3dULL, 0x001fa61726d1f213ULL,
+    0x001fa47bd48bea00ULL, 0x001fa2c693c5c095ULL, 0x001fa0f4f47df316ULL,
+    0x001f9f04336bbe0bULL, 0x001f9cf12b79f9bdULL, 0x001f9ab84415abc5ULL,
+    0x001f98555b782fb9ULL, 0x001f95c3abd03f7aULL, 0x001f92fda9cef1f3ULL,
+    0x001f8ffcda9ae41dULL, 0x001f8cb99e7385f8ULL, 0x001f892aec479608ULL,
+    0x001f8545f904db90ULL, 0x001f80fdc336039bULL, 0x001f7c427839e926ULL,
+    0x001f7700a3582aceULL, 0x001f71200f1a241dULL, 0x001f6a8234b7352cULL,
+    0x001f630000a8e267ULL, 0x001f5a66904fe3c6ULL, 0x001f50724ece1173ULL,
+    0x001f44c7665c6fdbULL, 0x001f36e5a38a59a4ULL, 0x001f261434503409ULL,
+    0x001f113e047b0414ULL, 0x001ef6aefa57cbe7ULL, 0x001ed38ca188151eULL,
+    0x001ea2a61e122db2ULL, 0x001e5961c78b267dULL, 0x001dddf62bac0bb1ULL,
+    0x001cdb4dd9e4e8c0ULL
+};
+
+static const double we_double[256] = {
+    9.65574006320918495e-16, 7.08901424395587193e-18, 1.16394124966915612e-17,
+    1.52439151235324344e-17, 1.83328488572376734e-17, 2.10896510946450758e-17,
+    2.36112807784315792e-17, 2.59559577231091306e-17, 2.81617355419777021e-17,
+    3.02550413032139959e-17, 3.22550825483639130e-17, 3.41763234018504244e-17,
+    3.60299697873446790e-17, 3.78249077686966446e-17, 3.95683219809756741e-17,
+    4.12661177817596122e-17, 4.29232180844253857e-17, 4.45437774328238498e-17,
+    4.61313398148320011e-17, 4.76889572526465011e-17, 4.92192804372797579e-17,
+    5.07246290450315872e-17, 5.22070470279268283e-17, 5.36683466171820389e-17,
+    5.51101437283510581e-17, 5.65338867323967823e-17, 5.79408800485277771e-17,
+    5.93323036520895294e-17, 6.07092293284719067e-17, 6.20726343116320335e-17,
+    6.34234128030308637e-17, 6.47623857595615198e-17, 6.60903092576941510e-17,
+    6.74078816787273210e-17, 6.87157499118382354e-17, 7.00145147340394071e-17,
+    7.13047354966065327e-17, 7.25869342241465821e-17, 7.38615992138180063e-17,
+    7.51291882072373672e-17, 7.63901311955083442e-17, 7.76448329079785673e-17,
+    7.88936750272979918e-17, 8.01370181667546429e-17, 8.13752036404177207e-17,
+    8.26085550521004680e-17, 8.38373797253914924e-17, 8.50619699938533176e-17,
+    8.62826043678412162e-17, 8.74995485921619237e-17, 8.87130566069026214e-17,
+    8.99233714221536693e-17, 9.11307259159791903e-17, 9.23353435638179675e-17,
+    9.35374391064913757e-17, 9.47372191631295943e-17, 9.59348827945800718e-17,
+    9.71306220222153107e-17, 9.83246223064951999e-17, 9.95170629891508051e-17,
+    1.00708117702429579e-16, 1.01897954748469494e-16, 1.03086737451542282e-16,
+    1.04274624485618954e-16, 1.05461770179457727e-16, 1.06648324801191569e-16,
+    1.07834434824194948e-16, 1.09020243175835134e-16, 1.10205889470557897e-16,
+    1.11391510228619824e-16, 1.12577239081656823e-16, 1.13763206966168520e-16,
+    1.14949542305900979e-16, 1.16136371184021880e-16, 1.17323817505904628e-16,
+    1.18512003153267017e-16, 1.19701048130346565e-16, 1.20891070702738626e-16,
+    1.22082187529470664e-16, 1.23274513788841569e-16, 1.24468163298511302e-16,
+    1.25663248630289901e-16, 1.26859881220039828e-16, 1.28058171473075012e-16,
+    1.29258228865412005e-16, 1.30460162041202959e-16, 1.31664078906657332e-16,
+    1.32870086720738188e-16, 1.34078292182900042e-16, 1.35288801518117620e-16,
+    1.36501720559439851e-16, 1.37717154828288170e-16, 1.38935209612706441e-16,
+    1.40155990043757203e-16, 1.41379601170248568e-16, 1.42606148031966594e-16,
+    1.43835735731579092e-16, 1.45068469505368842e-16, 1.46304454792947646e-16,
+    1.47543797306095237e-16, 1.48786603096862656e-16, 1.50032978625073744e-16,
+    1.51283030825353992e-16, 1.52536867173812629e-16, 1.53794595754499743e-16,
+    1.55056325325757764e-16, 1.56322165386583800e-16, 1.57592226243117663e-16,
+    1.58866619075368440e-16, 1.60145456004291698e-16, 1.61428850159327891e-16,
+    1.62716915746513075e-16, 1.64009768117271844e-16, 1.65307523838003740e-16,
+    1.66610300760574231e-16, 1.67918218093822911e-16, 1.69231396476202251e-16,
+    1.70549958049663008e-16, 1.71874026534903190e-16, 1.73203727308100862e-16,
+    1.74539187479253422e-16, 1.75880535972249163e-16, 1.77227903606800674e-16,
+    1.78581423182373287e-16, 1.79941229564246397e-16, 1.81307459771850181e-16,
+    1.82680253069525251e-16, 1.84059751059858807e-16, 1.85446097779756971e-16,
+    1.86839439799419293e-16, 1.88239926324389230e-16, 1.89647709300861697e-16,
+    1.91062943524437678e-16, 1.92485786752524431e-16, 1.93916399820589991e-16,
+    1.95354946762490963e-16, 1.96801594935103812e-16, 1.98256515147501979e-16,
+    1.99719881794934257e-16, 2.01191872997873516e-16, 2.02672670746419903e-16,
+    2.04162461050358951e-16, 2.05661434095191837e-16, 2.07169784404473753e-16,
+    2.08687711008816021e-16, 2.10215417621929328e-16, 2.11753112824107641e-16,
+    2.13301010253577958e-16, 2.14859328806166356e-16, 2.16428292843760522e-16,
+    2.18008132412078427e-16, 2.19599083468287097e-16, 2.21201388119049619e-16,
+    2.22815294869618104e-16, 2.24441058884630859e-16, 2.26078942261317374e-16,
+    2.27729214315862104e-16, 2.29392151883731135e-16, 2.31068039634821381e-16,
+    2.32757170404353511e-16, 2.34459845540495835e-16, 2.36176375269777449e-16,
+    2.37907079081427719e-16, 2.39652286131862401e-16, 2.41412335670629328e-16,
+    2.43187577489225596e-16, 2.44978372394307071e-16, 2.46785092706928923e-16,
+    2.48608122789585221e-16, 2.50447859602955704e-16, 2.52304713294421701e-16,
+    2.54179107820581223e-16, 2.56071481606177076e-16, 2.57982288242053090e-16,
+    2.59911997224974642e-16, 2.61861094742392422e-16, 2.63830084505494233e-16,
+    2.65819488634184463e-16, 2.67829848597952517e-16, 2.69861726216948893e-16,
+    2.71915704727981850e-16, 2.73992389920581482e-16, 2.76092411348761663e-16,
+    2.78216423624643608e-16, 2.80365107800698346e-16, 2.82539172848025318e-16,
+    2.84739357238817409e-16, 2.86966430641981768e-16, 2.89221195741799560e-16,
+    2.91504490190529318e-16, 2.93817188707002814e-16, 2.96160205334546519e-16,
+    2.98534495873004478e-16, 3.00941060501261765e-16, 3.03380946608500243e-16,
+    3.05855251854485989e-16, 3.08365127481530951e-16, 3.10911781903426585e-16,
+    3.13496484599666312e-16, 3.16120570346710573e-16, 3.18785443821971312e-16,
+    3.21492584620679736e-16, 3.24243552730945164e-16, 3.27039994518224044e-16,
+    3.29883649277228315e-16, 3.32776356417167141e-16, 3.35720063355324408e-16,
+    3.38716834204550467e-16, 3.41768859352563650e-16, 3.44878466045342389e-16,
+    3.48048130103744179e-16, 3.51280488922297892e-16, 3.54578355922479137e-16,
+    3.57944736660427605e-16, 3.61382846821906010e-16, 3.64896132376454205e-16,
+    3.68488292209562034e-16, 3.72163303608020680e-16, 3.75925451041625555e-16,
+    3.79779358766887389e-16, 3.83730027878921319e-16, 3.87782878560789480e-16,
+    3.91943798431142837e-16, 3.96219198078677450e-16, 4.00616075105654169e-16,
+    4.05142088295657318e-16, 4.09805643890306251e-16, 4.14615996429090458e-16,
+    4.19583367207339893e-16, 4.24719084182438505e-16, 4.30035748166747070e-16,
+    4.35547431469395201e-16, 4.41269916903607040e-16, 4.47220987425993228e-16,
+    4.53420779856583448e-16, 4.59892220490593247e-16, 4.66661566471147578e-16,
+    4.73759085326249203e-16, 4.81219917282923793e-16, 4.89085182739220990e-16,
+    4.97403423619193975e-16, 5.06232507214415970e-16, 5.15642182887808295e-16,
+    5.25717580202227484e-16, 5.36564097711202063e-16, 5.48314403425870293e-16,
+    5.61138745467515864e-16, 5.75260648150333070e-16, 5.90981764165210201e-16,
+    6.08723141618090767e-16, 6.29097903487755705e-16, 6.53049205356404080e-16,
+    6.82139307902892863e-16, 7.19244496608936156e-16, 7.70609535003209675e-16,
+    8.54551703858402742e-16
+};
+
+static const double fe_double[256] = {
+    1.00000000000000000e+00, 9.38143680862170815e-01, 9.00469929925743706e-01,
+    8.71704332381201485e-01, 8.47785500623987831e-01, 8.26993296643048770e-01,
+    8.08421651523006934e-01, 7.91527636972494286e-01, 7.75956852040114331e-01,
+    7.61463388849895062e-01, 7.47868621985193993e-01, 7.35038092431422485e-01,
+    7.22867659593571021e-01, 7.11274760805075013e-01, 7.00192655082787274e-01,
+    6.89566496117077099e-01, 6.79350572264764585e-01, 6.69506316731923956e-01,
+    6.60000841078998923e-01, 6.50805833414570212e-01, 6.41896716427265313e-01,
+    6.33251994214365399e-01, 6.24852738703665311e-01, 6.16682180915206990e-01,
+    6.08725382079621458e-01, 6.00968966365231672e-01, 5.93400901691732874e-01,
+    5.86010318477267478e-01, 5.78787358602844471e-01, 5.71723048664825262e-01,
+    5.64809192912399727e-01, 5.58038282262587004e-01, 5.51403416540640845e-01,
+    5.44898237672439167e-01, 5.38516872002861358e-01, 5.32253880263042767e-01,
+    5.26104213983619284e-01, 5.20063177368233154e-01, 5.14126393814748117e-01,
+    5.08289776410642435e-01, 5.02549501841347279e-01, 4.96901987241549159e-01,
+    4.91343869594032145e-01, 4.85871987341884526e-01, 4.80483363930453822e-01,
+    4.75175193037376986e-01, 4.69944825283959589e-01, 4.64789756250425790e-01,
+    4.59707615642137302e-01, 4.54696157474615115e-01, 4.49753251162754608e-01,
+    4.44876873414548124e-01, 4.40065100842353507e-01, 4.35316103215636241e-01,
+    4.30628137288458501e-01, 4.25999541143034011e-01, 4.21428728997616242e-01,
+    4.16914186433002543e-01, 4.12454465997160846e-01, 4.08048183152032062e-01,
+    4.03694012530529944e-01, 3.99390684475230739e-01, 3.95136981833289824e-01,
+    3.90931736984796774e-01, 3.86773829084137377e-01, 3.82662181496009501e-01,
+    3.78595759409580512e-01, 3.74573567615901881e-01, 3.70594648435145724e-01,
+    3.66658079781513879e-01, 3.62762973354817497e-01, 3.58908472948749557e-01,
+    3.55093752866787293e-01, 3.51318016437483172e-01, 3.47580494621636815e-01,
+    3.43880444704502242e-01, 3.40217149066779856e-01, 3.36589914028677384e-01,
+    3.32998068761808763e-01, 3.29440964264136160e-01, 3.25917972393556021e-01,
+    3.22428484956089001e-01, 3.18971912844957017e-01, 3.15547685227128727e-01,
+    3.12155248774179384e-01, 3.08794066934559963e-01, 3.05463619244590034e-01,
+    3.02163400675693306e-01, 2.98892921015581514e-01, 2.95651704281260974e-01,
+    2.92439288161892408e-01, 2.89255223489677582e-01, 2.86099073737076715e-01,
+    2.82970414538780635e-01, 2.79868833236972758e-01, 2.76793928448517190e-01,
+    2.73745309652802804e-01, 2.70722596799059856e-01, 2.67725419932044628e-01,
+    2.64753418835062038e-01, 2.61806242689362811e-01, 2.58883549749016062e-01,
+    2.55985007030415268e-01, 2.53110290015629347e-01, 2.50259082368862185e-01,
+    2.47431075665327543e-01, 2.44625969131892024e-01, 2.41843469398877131e-01,
+    2.39083290262449094e-01, 2.36345152457059560e-01, 2.33628783437433291e-01,
+    2.30933917169627356e-01, 2.28260293930716618e-01, 2.25607660116683956e-01,
+    2.22975768058120111e-01, 2.20364375843359439e-01, 2.17773247148700472e-01,
+    2.15202151075378628e-01, 2.12650861992978224e-01, 2.10119159388988230e-01,
+    2.07606827724221982e-01, 2.05113656293837654e-01, 2.02639439093708962e-01,
+    2.00183974691911210e-01, 1.97747066105098818e-01, 1.95328520679563189e-01,
+    1.92928149976771296e-01, 1.90545769663195363e-01, 1.88181199404254262e-01,
+    1.85834262762197083e-01, 1.83504787097767436e-01, 1.81192603475496261e-01,
+    1.78897546572478278e-01, 1.76619454590494829e-01, 1.74358169171353411e-01,
+    1.72113535315319977e-01, 1.69885401302527550e-01, 1.67673618617250081e-01,
+    1.65478041874935922e-01, 1.63298528751901734e-01, 1.61134939917591952e-01,
+    1.58987138969314129e-01, 1.56854992369365148e-01, 1.54738369384468027e-01,
+    1.52637142027442801e-01, 1.50551185001039839e-01, 1.48480375643866735e-01,
+    1.46424593878344889e-01, 1.44383722160634720e-01, 1.42357645432472146e-01,
+    1.40346251074862399e-01, 1.38349428863580176e-01, 1.36367070926428829e-01,
+    1.34399071702213602e-01, 1.32445327901387494e-01, 1.30505738468330773e-01,
+    1.28580204545228199e-01, 1.26668629437510671e-01, 1.24770918580830933e-01,
+    1.22886979509545108e-01, 1.21016721826674792e-01, 1.19160057175327641e-01,
+    1.17316899211555525e-01, 1.15487163578633506e-01, 1.13670767882744286e-01,
+    1.11867631670056283e-01, 1.10077676405185357e-01, 1.08300825451033755e-01,
+    1.06537004050001632e-01, 1.04786139306570159e-01, 1.03048160171257702e-01,
+    1.01322997425953631e-01, 9.96105836706371317e-02, 9.79108533114922130e-02,
+    9.62237425504328253e-02, 9.45491893760558727e-02, 9.28871335560435690e-02,
+    9.12375166310401969e-02, 8.96002819100328862e-02, 8.79753744672702315e-02,
+    8.63627411407569268e-02, 8.47623305323681464e-02, 8.31740930096323966e-02,
+    8.15979807092374193e-02, 8.00339475423199054e-02, 7.84819492016064352e-02,
+    7.69419431704805173e-02, 7.54138887340584096e-02, 7.38977469923647462e-02,
+    7.23934808757087517e-02, 7.09010551623718427e-02, 6.94204364987287825e-02,
+    6.79515934219366430e-02, 6.64944963853398158e-02, 6.50491177867538045e-02,
+    6.36154319998073758e-02, 6.21934154085410362e-02, 6.07830464454796604e-02,
+    5.93843056334202798e-02, 5.79971756312006592e-02, 5.66216412837428698e-02,
+    5.52576896766970305e-02, 5.39053101960460801e-02, 5.25644945930716853e-02,
+    5.12352370551262815e-02, 4.99175342827063787e-02, 4.86113855733795036e-02,
+    4.73167929131815615e-02, 4.60337610761751836e-02, 4.47622977329432889e-02,
+    4.35024135688881972e-02, 4.22541224133162543e-02, 4.10174413804148402e-02,
+    3.97923910233741393e-02, 3.85789955030748713e-02, 3.73772827729593818e-02,
+    3.61872847819314433e-02, 3.50090376973974313e-02, 3.38425821508743577e-02,
+    3.26879635089595555e-02, 3.15452321728936225e-02, 3.04144439104666216e-02,
+    2.92956602246374105e-02, 2.81889487639786461e-02, 2.70943837809558032e-02,
+    2.60120466451342208e-02, 2.49420264197317866e-02, 2.38844205115581742e-02,
+    2.28393354063852402e-02, 2.18068875042835807e-02, 2.07872040725781138e-02,
+    1.97804243380097396e-02, 1.87867007446960235e-02, 1.78062004109113547e-02,
+    1.68391068260399408e-02, 1.58856218399731561e-02, 1.49459680116911485e-02,
+    1.40203914031819428e-02, 1.31091649312549911e-02, 1.22125924262553778e-02,
+    1.13310135978346004e-02, 1.04648101810299807e-02, 9.61441364250221163e-03,
+    8.78031498580897699e-03, 7.96307743801704347e-03, 7.16335318363499080e-03,
+    6.38190593731918342e-03, 5.61964220720548909e-03, 4.87765598354239580e-03,
+    4.15729512083379705e-03, 3.46026477783690405e-03, 2.78879879357407569e-03,
+    2.14596774371890713e-03, 1.53629978030157257e-03, 9.67269282327174319e-04,
+    4.54134353841496603e-04
+};
+
+static const npy_uint32 ke_float[256] = {
+    0x00714850UL, 0x00000000UL, 0x004df56fUL, 0x0061bbd6UL, 0x006a6edcUL,
+    0x006f449fUL, 0x00725474UL, 0x00746ff8UL, 0x0075f96fUL, 0x007724d3UL,
+    0x00781027UL, 0x0078cdedUL, 0x00796a2cUL, 0x0079ed08UL, 0x007a5c36UL,
+    0x007abbd6UL, 0x007b0ef4UL, 0x007b57dbUL, 0x007b9852UL, 0x007bd1bbUL,
+    0x007c052dUL, 0x007c338cUL, 0x007c5d8dUL, 0x007c83c8UL, 0x007ca6b8UL,
+    0x007cc6c6UL, 0x007ce449UL, 0x007cff8bUL, 0x007d18ccUL, 0x007d3042UL,
+    0x007d461dUL, 0x007d5a84UL, 0x007d6d9bUL, 0x007d7f82UL, 0x007d9053UL,
+    0x007da027UL, 0x007daf14UL, 0x007dbd2cUL, 0x007dca81UL, 0x007dd722UL,
+    0x007de31cUL, 0x007dee7cUL, 0x007df94dUL, 0x007e0398UL, 0x007e0d68UL,
+    0x007e16c5UL, 0x007e1fb6UL, 0x007e2841UL, 0x007e306eUL, 0x007e3843UL,
+    0x007e3fc4UL, 0x007e46f6UL, 0x007e4ddeUL, 0x007e5481UL, 0x007e5ae1UL,
+    0x007e6104UL, 0x007e66ebUL, 0x007e6c9aUL, 0x007e7215UL, 0x007e775dUL,
+    0x007e7c75UL, 0x007e8160UL, 0x007e861fUL, 0x007e8ab5UL, 0x007e8f24UL,
+    0x007e936dUL, 0x007e9792UL, 0x007e9b95UL, 0x007e9f77UL, 0x007ea339UL,
+    0x007ea6deUL, 0x007eaa65UL, 0x007eadd1UL, 0x007eb122UL, 0x007eb45aUL,
+    0x007eb778UL, 0x007eba80UL, 0x007ebd70UL, 0x007ec04bUL, 0x007ec310UL,
+    0x007ec5c1UL, 0x007ec85eUL, 0x007ecae8UL, 0x007ecd60UL, 0x007ecfc6UL,
+    0x007ed21bUL, 0x007ed45fUL, 0x007ed694UL, 0x007ed8b8UL, 0x007edaceUL,
+    0x007edcd4UL, 0x007edecdUL, 0x007ee0b8UL, 0x007ee295UL, 0x007ee466UL,
+    0x007ee62aUL, 0x007ee7e1UL, 0x007ee98cUL, 0x007eeb2cUL, 0x007eecc1UL,
+    0x007eee4aUL, 0x007eefc8UL, 0x007ef13cUL, 0x007ef2a6UL, 0x007ef406UL,
+    0x007ef55bUL, 0x007ef6a8UL, 0x007ef7eaUL, 0x007ef924UL, 0x007efa55UL,
+    0x007efb7cUL, 0x007efc9bUL, 0x007efdb2UL, 0x007efec0UL, 0x007effc6UL,
+    0x007f00c5UL, 0x007f01bbUL, 0x007f02a9UL, 0x007f0390UL, 0x007f046fUL,
+    0x007f0547UL, 0x007f0618UL, 0x007f06e1UL, 0x007f07a4UL, 0x007f085fUL,
+    0x007f0914UL, 0x007f09c1UL, 0x007f0a68UL, 0x007f0b08UL, 0x007f0ba2UL,
+    0x007f0c35UL, 0x007f0cc2UL, 0x007f0d48UL, 0x007f0dc7UL, 0x007f0e41UL,
+    0x007f0eb4UL, 0x007f0f21UL, 0x007f0f87UL, 0x007f0fe7UL, 0x007f1041UL,
+    0x007f1095UL, 0x007f10e3UL, 0x007f112bUL, 0x007f116cUL, 0x007f11a7UL,
+    0x007f11ddUL, 0x007f120cUL, 0x007f1234UL, 0x007f1257UL, 0x007f1274UL,
+    0x007f128aUL, 0x007f129aUL, 0x007f12a3UL, 0x007f12a7UL, 0x007f12a4UL,
+    0x007f129aUL, 0x007f128aUL, 0x007f1274UL, 0x007f1257UL, 0x007f1233UL,
+    0x007f1208UL, 0x007f11d7UL, 0x007f119fUL, 0x007f1160UL, 0x007f1119UL,
+    0x007f10ccUL, 0x007f1077UL, 0x007f101aUL, 0x007f0fb6UL, 0x007f0f4bUL,
+    0x007f0ed7UL, 0x007f0e5bUL, 0x007f0dd8UL, 0x007f0d4bUL, 0x007f0cb7UL,
+    0x007f0c19UL, 0x007f0b72UL, 0x007f0ac3UL, 0x007f0a0aUL, 0x007f0947UL,
+    0x007f087aUL, 0x007f07a3UL, 0x007f06c2UL, 0x007f05d6UL, 0x007f04deUL,
+    0x007f03dbUL, 0x007f02cdUL, 0x007f01b2UL, 0x007f008aUL, 0x007eff55UL,
+    0x007efe13UL, 0x007efcc3UL, 0x007efb64UL, 0x007ef9f6UL, 0x007ef878UL,
+    0x007ef6e9UL, 0x007ef54aUL, 0x007ef399UL, 0x007ef1d5UL, 0x007eeffeUL,
+    0x007eee13UL, 0x007eec13UL, 0x007ee9fcUL, 0x007ee7ceUL, 0x007ee588UL,
+    0x007ee328UL, 0x007ee0adUL, 0x007ede16UL, 0x007edb61UL, 0x007ed88bUL,
+    0x007ed595UL, 0x007ed27aUL, 0x007ecf3bUL, 0x007ecbd3UL, 0x007ec840UL,
+    0x007ec480UL, 0x007ec090UL, 0x007ebc6cUL, 0x007eb811UL, 0x007eb37aUL,
+    0x007eaea3UL, 0x007ea987UL, 0x007ea421UL, 0x007e9e6aUL, 0x007e985cUL,
+    0x007e91efUL, 0x007e8b1aUL, 0x007e83d3UL, 0x007e7c10UL, 0x007e73c4UL,
+    0x007e6ae1UL, 0x007e6155UL, 0x007e570eUL, 0x007e4bf6UL, 0x007e3ff3UL,
+    0x007e32e6UL, 0x007e24abUL, 0x007e1517UL, 0x007e03f7UL, 0x007df109UL,
+    0x007ddc02UL, 0x007dc480UL, 0x007daa08UL, 0x007d8c00UL, 0x007d699aUL,
+    0x007d41c9UL, 0x007d131dUL, 0x007cdb96UL, 0x007c9850UL, 0x007c44f8UL,
+    0x007bdabbUL, 0x007b4e32UL, 0x007a8a98UL, 0x00796587UL, 0x007777d8UL,
+    0x00736d37UL
+};
+
+static const float we_float[256] = {
+    1.036777195e-06f, 7.611771085e-09f, 1.249772400e-08f, 1.636802923e-08f,
+    1.968474657e-08f, 2.264484043e-08f, 2.535241969e-08f, 2.786999739e-08f,
+    3.023843329e-08f, 3.248610323e-08f, 3.463363117e-08f, 3.669654783e-08f,
+    3.868688548e-08f, 4.061418546e-08f, 4.248616222e-08f, 4.430915658e-08f,
+    4.608845448e-08f, 4.782851683e-08f, 4.953314896e-08f, 5.120562795e-08f,
+    5.284879995e-08f, 5.446515571e-08f, 5.605688990e-08f, 5.762594839e-08f,
+    5.917406625e-08f, 6.070279866e-08f, 6.221354623e-08f, 6.370757595e-08f,
+    6.518603863e-08f, 6.664998359e-08f, 6.810037095e-08f, 6.953808221e-08f,
+    7.096392921e-08f, 7.237866183e-08f, 7.378297465e-08f, 7.517751276e-08f,
+    7.656287675e-08f, 7.793962715e-08f, 7.930828826e-08f, 8.066935158e-08f,
+    8.202327881e-08f, 8.337050451e-08f, 8.471143853e-08f, 8.604646806e-08f,
+    8.737595959e-08f, 8.870026058e-08f, 9.001970103e-08f, 9.133459481e-08f,
+    9.264524099e-08f, 9.395192490e-08f, 9.525491921e-08f, 9.655448485e-08f,
+    9.785087187e-08f, 9.914432022e-08f, 1.004350605e-07f, 1.017233145e-07f,
+    1.030092960e-07f, 1.042932113e-07f, 1.055752593e-07f, 1.068556327e-07f,
+    1.081345180e-07f, 1.094120958e-07f, 1.106885415e-07f, 1.119640255e-07f,
+    1.132387135e-07f, 1.145127668e-07f, 1.157863427e-07f, 1.170595948e-07f,
+    1.183326728e-07f, 1.196057234e-07f, 1.208788900e-07f, 1.221523134e-07f,
+    1.234261312e-07f, 1.247004790e-07f, 1.259754898e-07f, 1.272512944e-07f,
+    1.285280218e-07f, 1.298057988e-07f, 1.310847507e-07f, 1.323650013e-07f,
+    1.336466727e-07f, 1.349298858e-07f, 1.362147603e-07f, 1.375014146e-07f,
+    1.387899664e-07f, 1.400805323e-07f, 1.413732282e-07f, 1.426681693e-07f,
+    1.439654700e-07f, 1.452652445e-07f, 1.465676064e-07f, 1.478726690e-07f,
+    1.491805454e-07f, 1.504913484e-07f, 1.518051908e-07f, 1.531221855e-07f,
+    1.544424452e-07f, 1.557660831e-07f, 1.570932121e-07f, 1.584239460e-07f,
+    1.597583986e-07f, 1.610966841e-07f, 1.624389175e-07f, 1.637852140e-07f,
+    1.651356898e-07f, 1.664904616e-07f, 1.678496470e-07f, 1.692133645e-07f,
+    1.705817333e-07f, 1.719548740e-07f, 1.733329080e-07f, 1.747159579e-07f,
+    1.761041476e-07f, 1.774976022e-07f, 1.788964482e-07f, 1.803008138e-07f,
+    1.817108283e-07f, 1.831266230e-07f, 1.845483307e-07f, 1.859760861e-07f,
+    1.874100255e-07f, 1.888502875e-07f, 1.902970125e-07f, 1.917503431e-07f,
+    1.932104240e-07f, 1.946774026e-07f, 1.961514281e-07f, 1.976326528e-07f,
+    1.991212313e-07f, 2.006173209e-07f, 2.021210818e-07f, 2.036326773e-07f,
+    2.051522735e-07f, 2.066800398e-07f, 2.082161488e-07f, 2.097607769e-07f,
+    2.113141035e-07f, 2.128763122e-07f, 2.144475902e-07f, 2.160281287e-07f,
+    2.176181232e-07f, 2.192177733e-07f, 2.208272834e-07f, 2.224468622e-07f,
+    2.240767235e-07f, 2.257170860e-07f, 2.273681736e-07f, 2.290302158e-07f,
+    2.307034476e-07f, 2.323881099e-07f, 2.340844497e-07f, 2.357927204e-07f,
+    2.375131820e-07f, 2.392461011e-07f, 2.409917519e-07f, 2.427504158e-07f,
+    2.445223820e-07f, 2.463079476e-07f, 2.481074183e-07f, 2.499211087e-07f,
+    2.517493422e-07f, 2.535924520e-07f, 2.554507810e-07f, 2.573246828e-07f,
+    2.592145216e-07f, 2.611206730e-07f, 2.630435244e-07f, 2.649834756e-07f,
+    2.669409392e-07f, 2.689163416e-07f, 2.709101231e-07f, 2.729227389e-07f,
+    2.749546597e-07f, 2.770063727e-07f, 2.790783820e-07f, 2.811712095e-07f,
+    2.832853962e-07f, 2.854215026e-07f, 2.875801102e-07f, 2.897618221e-07f,
+    2.919672648e-07f, 2.941970885e-07f, 2.964519694e-07f, 2.987326102e-07f,
+    3.010397422e-07f, 3.033741268e-07f, 3.057365568e-07f, 3.081278587e-07f,
+    3.105488943e-07f, 3.130005630e-07f, 3.154838041e-07f, 3.179995991e-07f,
+    3.205489741e-07f, 3.231330032e-07f, 3.257528110e-07f, 3.284095760e-07f,
+    3.311045344e-07f, 3.338389838e-07f, 3.366142872e-07f, 3.394318778e-07f,
+    3.422932639e-07f, 3.452000342e-07f, 3.481538637e-07f, 3.511565202e-07f,
+    3.542098713e-07f, 3.573158919e-07f, 3.604766732e-07f, 3.636944314e-07f,
+    3.669715184e-07f, 3.703104332e-07f, 3.737138341e-07f, 3.771845529e-07f,
+    3.807256106e-07f, 3.843402344e-07f, 3.880318771e-07f, 3.918042387e-07f,
+    3.956612910e-07f, 3.996073044e-07f, 4.036468795e-07f, 4.077849814e-07f,
+    4.120269801e-07f, 4.163786953e-07f, 4.208464490e-07f, 4.254371244e-07f,
+    4.301582352e-07f, 4.350180049e-07f, 4.400254596e-07f, 4.451905363e-07f,
+    4.505242100e-07f, 4.560386441e-07f, 4.617473686e-07f, 4.676654935e-07f,
+    4.738099655e-07f, 4.801998788e-07f, 4.868568552e-07f, 4.938055117e-07f,
+    5.010740416e-07f, 5.086949444e-07f, 5.167059517e-07f, 5.251512162e-07f,
+    5.340828593e-07f, 5.435630157e-07f, 5.536665780e-07f, 5.644849535e-07f,
+    5.761313130e-07f, 5.887481077e-07f, 6.025181401e-07f, 6.176814176e-07f,
+    6.345618374e-07f, 6.536114964e-07f, 6.754887304e-07f, 7.012062449e-07f,
+    7.324415047e-07f, 7.722828977e-07f, 8.274356877e-07f, 9.175679052e-07f
+};
+
+static const float fe_float[256] = {
+    1.000000000e+00f, 9.381436809e-01f, 9.004699299e-01f, 8.717043324e-01f,
+    8.477855006e-01f, 8.269932966e-01f, 8.084216515e-01f, 7.915276370e-01f,
+    7.759568520e-01f, 7.614633888e-01f, 7.478686220e-01f, 7.350380924e-01f,
+    7.228676596e-01f, 7.112747608e-01f, 7.001926551e-01f, 6.895664961e-01f,
+    6.793505723e-01f, 6.695063167e-01f, 6.600008411e-01f, 6.508058334e-01f,
+    6.418967164e-01f, 6.332519942e-01f, 6.248527387e-01f, 6.166821809e-01f,
+    6.087253821e-01f, 6.009689664e-01f, 5.934009017e-01f, 5.860103185e-01f,
+    5.787873586e-01f, 5.717230487e-01f, 5.648091929e-01f, 5.580382823e-01f,
+    5.514034165e-01f, 5.448982377e-01f, 5.385168720e-01f, 5.322538803e-01f,
+    5.261042140e-01f, 5.200631774e-01f, 5.141263938e-01f, 5.082897764e-01f,
+    5.025495018e-01f, 4.969019872e-01f, 4.913438696e-01f, 4.858719873e-01f,
+    4.804833639e-01f, 4.751751930e-01f, 4.699448253e-01f, 4.647897563e-01f,
+    4.597076156e-01f, 4.546961575e-01f, 4.497532512e-01f, 4.448768734e-01f,
+    4.400651008e-01f, 4.353161032e-01f, 4.306281373e-01f, 4.259995411e-01f,
+    4.214287290e-01f, 4.169141864e-01f, 4.124544660e-01f, 4.080481832e-01f,
+    4.036940125e-01f, 3.993906845e-01f, 3.951369818e-01f, 3.909317370e-01f,
+    3.867738291e-01f, 3.826621815e-01f, 3.785957594e-01f, 3.745735676e-01f,
+    3.705946484e-01f, 3.666580798e-01f, 3.627629734e-01f, 3.589084729e-01f,
+    3.550937529e-01f, 3.513180164e-01f, 3.475804946e-01f, 3.438804447e-01f,
+    3.402171491e-01f, 3.365899140e-01f, 3.329980688e-01f, 3.294409643e-01f,
+    3.259179724e-01f, 3.224284850e-01f, 3.189719128e-01f, 3.155476852e-01f,
+    3.121552488e-01f, 3.087940669e-01f, 3.054636192e-01f, 3.021634007e-01f,
+    2.988929210e-01f, 2.956517043e-01f, 2.924392882e-01f, 2.892552235e-01f,
+    2.860990737e-01f, 2.829704145e-01f, 2.798688332e-01f, 2.767939284e-01f,
+    2.737453097e-01f, 2.707225968e-01f, 2.677254199e-01f, 2.647534188e-01f,
+    2.618062427e-01f, 2.588835497e-01f, 2.559850070e-01f, 2.531102900e-01f,
+    2.502590824e-01f, 2.474310757e-01f, 2.446259691e-01f, 2.418434694e-01f,
+    2.390832903e-01f, 2.363451525e-01f, 2.336287834e-01f, 2.309339172e-01f,
+    2.282602939e-01f, 2.256076601e-01f, 2.229757681e-01f, 2.203643758e-01f,
+    2.177732471e-01f, 2.152021511e-01f, 2.126508620e-01f, 2.101191594e-01f,
+    2.076068277e-01f, 2.051136563e-01f, 2.026394391e-01f, 2.001839747e-01f,
+    1.977470661e-01f, 1.953285207e-01f, 1.929281500e-01f, 1.905457697e-01f,
+    1.881811994e-01f, 1.858342628e-01f, 1.835047871e-01f, 1.811926035e-01f,
+    1.788975466e-01f, 1.766194546e-01f, 1.743581692e-01f, 1.721135353e-01f,
+    1.698854013e-01f, 1.676736186e-01f, 1.654780419e-01f, 1.632985288e-01f,
+    1.611349399e-01f, 1.589871390e-01f, 1.568549924e-01f, 1.547383694e-01f,
+    1.526371420e-01f, 1.505511850e-01f, 1.484803756e-01f, 1.464245939e-01f,
+    1.443837222e-01f, 1.423576454e-01f, 1.403462511e-01f, 1.383494289e-01f,
+    1.363670709e-01f, 1.343990717e-01f, 1.324453279e-01f, 1.305057385e-01f,
+    1.285802045e-01f, 1.266686294e-01f, 1.247709186e-01f, 1.228869795e-01f,
+    1.210167218e-01f, 1.191600572e-01f, 1.173168992e-01f, 1.154871636e-01f,
+    1.136707679e-01f, 1.118676317e-01f, 1.100776764e-01f, 1.083008255e-01f,
+    1.065370041e-01f, 1.047861393e-01f, 1.030481602e-01f, 1.013229974e-01f,
+    9.961058367e-02f, 9.791085331e-02f, 9.622374255e-02f, 9.454918938e-02f,
+    9.288713356e-02f, 9.123751663e-02f, 8.960028191e-02f, 8.797537447e-02f,
+    8.636274114e-02f, 8.476233053e-02f, 8.317409301e-02f, 8.159798071e-02f,
+    8.003394754e-02f, 7.848194920e-02f, 7.694194317e-02f, 7.541388873e-02f,
+    7.389774699e-02f, 7.239348088e-02f, 7.090105516e-02f, 6.942043650e-02f,
+    6.795159342e-02f, 6.649449639e-02f, 6.504911779e-02f, 6.361543200e-02f,
+    6.219341541e-02f, 6.078304645e-02f, 5.938430563e-02f, 5.799717563e-02f,
+    5.662164128e-02f, 5.525768968e-02f, 5.390531020e-02f, 5.256449459e-02f,
+    5.123523706e-02f, 4.991753428e-02f, 4.861138557e-02f, 4.731679291e-02f,
+    4.603376108e-02f, 4.476229773e-02f, 4.350241357e-02f, 4.225412241e-02f,
+    4.101744138e-02f, 3.979239102e-02f, 3.857899550e-02f, 3.737728277e-02f,
+    3.618728478e-02f, 3.500903770e-02f, 3.384258215e-02f, 3.268796351e-02f,
+    3.154523217e-02f, 3.041444391e-02f, 2.929566022e-02f, 2.818894876e-02f,
+    2.709438378e-02f, 2.601204665e-02f, 2.494202642e-02f, 2.388442051e-02f,
+    2.283933541e-02f, 2.180688750e-02f, 2.078720407e-02f, 1.978042434e-02f,
+    1.878670074e-02f, 1.780620041e-02f, 1.683910683e-02f, 1.588562184e-02f,
+    1.494596801e-02f, 1.402039140e-02f, 1.310916493e-02f, 1.221259243e-02f,
+    1.133101360e-02f, 1.046481018e-02f, 9.614413643e-03f, 8.780314986e-03f,
+    7.963077438e-03f, 7.163353184e-03f, 6.381905937e-03f, 5.619642207e-03f,
+    4.877655984e-03f, 4.157295121e-03f, 3.460264778e-03f, 2.788798794e-03f,
+    2.145967744e-03f, 1.536299780e-03f, 9.672692823e-04f, 4.541343538e-04f
+};
+
+#endif
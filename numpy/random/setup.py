@@ -41,15 +41,20 @@ def configuration(parent_package='',top_path=None):
         defs.append(("NPY_NEEDS_MINGW_TIME_WORKAROUND", None))
 
     libs = []
-    # Configure mtrand
+    # Configure mtrand, with its own copy of the cpu feature detection of
+    # numpy.core for the simd Mersenne Twister loops
+    private_dir = join('..', 'core', 'src', 'private')
     config.add_extension('mtrand',
                          sources=[join('mtrand', x) for x in
-                                  ['mtrand.c', 'randomkit.c', 'initarray.c',
-                                   'distributions.c']]+[generate_libraries],
+                                  ['mtrand.c', 'randomkit.c', 'bitgen.c',
+                                   'initarray.c', 'distributions.c']]+
+                                 [join(private_dir, 'npy_cpu_features.c'),
+                                  generate_libraries],
                          libraries=libs,
                          depends=[join('mtrand', '*.h'),
                                   join('mtrand', '*.pyx'),
-                                  join('mtrand', '*.pxi'),],
+                                  join('mtrand', '*.pxi'),
+                                  join(private_dir, 'npy_cpu_features.h')],
                          define_macros=defs,
                          )
 
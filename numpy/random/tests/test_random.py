@@ -133,6 +133,95 @@ class TestSetState(TestCase):
         self.prng.negative_binomial(0.5, 0.5)
 
 
+class TestBitGenerators(TestCase):
+    brngs = ['PCG64', 'Philox4x64', 'Xoroshiro128', 'SFC64']
+
+    def raw(self, prng, n):
+        return prng.randint(0, 2**64, size=n, dtype=np.uint64)
+
+    def test_known_values(self):
+        # Random123 and PCG reference outputs
+        prng = random.RandomState(brng='Philox4x64')
+        prng.set_state(('Philox4x64', [0] * 10 + [4, 0, 0], 0, 0.0))
+        assert_array_equal(self.raw(prng, 4),
+                           [0x16554d9eca36314c, 0xdb20fe9d672d0fdc,
+                            0xd7e772cee186176b, 0x7e68b68aec7ba23b])
+        # pcg64_srandom_r(42, 54)
+        state = [0xde2bce05be013be3, 0xd3f6c45a41e54320, 0, 109, 0, 0]
+        prng = random.RandomState(brng='PCG64')
+        prng.set_state(('PCG64', state, 0, 0.0))
+        assert_array_equal(self.raw(prng, 3),
+                           [0x86b1da1d72062b68, 0x1304aa46c9853d39,
+                            0xa3670e9e0dd50358])
+
+    def test_seed_and_state(self):
+        for brng in self.brngs:
+            prng = random.RandomState([1, 2], brng=brng)
+            assert_equal(prng.brng, brng)
+            x = prng.random_sample(10)
+            prng.seed([1, 2])
+            assert_array_equal(x, prng.random_sample(10))
+            prng.standard_normal()
+            state = prng.get_state()
+            x = prng.standard_normal(5)
+            other = random.RandomState(0)
+            other.set_state(state)
+            assert_equal(other.brng, brng)
+            assert_array_equal(x, other.standard_normal(5))
+            other.set_state(random.RandomState(0).get_state())
+            assert_equal(other.brng, 'MT19937')
+            assert_(not np.all(x == random.RandomState([1, 3], brng=brng)
+                                         .standard_normal(5)))
+
+    def test_uniform_moments(self):
+        for brng in self.brngs:
+            x = random.RandomState(0, brng=brng).random_sample(10000)
+            assert_(abs(x.mean() - 0.5) < 0.01)
+            assert_(abs(x.var() - 1 / 12) < 0.002)
+
+    def test_advance(self):
+        for brng, block in [('PCG64', 1), ('Philox4x64', 4)]:
+            prng = random.RandomState(3, brng=brng)
+            x = self.raw(prng, 12 * block)
+            prng.seed(3)
+            prng.advance(5)
+            assert_array_equal(x[5 * block:], self.raw(prng, 7 * block))
+            prng.advance(2**128 - 1)
+            assert_raises(ValueError, prng.advance, 2**128)
+            assert_raises(ValueError, prng.advance, -1)
+
+    def test_jump(self):
+        for brng in ['PCG64', 'Philox4x64', 'Xoroshiro128']:
+            a = random.RandomState(7, brng=brng)
+            b = random.RandomState(7, brng=brng)
+            a.jump(2)
+            b.jump()
+            b.jump()
+            assert_array_equal(self.raw(a, 10), self.raw(b, 10))
+        prng = random.RandomState(0, brng='PCG64')
+        x = self.raw(prng, 3)
+        prng.seed(0)
+        prng.advance(2**64)
+        y = self.raw(prng, 3)
+        prng.seed(0)
+        prng.jump()
+        assert_array_equal(y, self.raw(prng, 3))
+        assert_(not np.all(x == y))
+
+    def test_unsupported(self):
+        assert_raises(ValueError, random.RandomState, 0, 'LCG')
+        assert_raises(ValueError, random.RandomState(0).jump)
+        assert_raises(ValueError, random.RandomState(0).advance, 1)
+        prng = random.RandomState(0, brng='SFC64')
+        assert_raises(ValueError, prng.jump)
+        prng = random.RandomState(0, brng='Xoroshiro128')
+        assert_raises(ValueError, prng.advance, 1)
+        assert_raises(ValueError, prng.set_state,
+                      ('Xoroshiro128', [0, 0, 0, 0], 0, 0.0))
+        assert_raises(ValueError, prng.set_state, ('PCG64', [1, 2], 0, 0.0))
+        assert_raises(ValueError, prng.seed, -1)
+
+
 class TestRandint(TestCase):
 
     rfunc = np.random.randint
@@ -781,6 +870,97 @@ class TestRandomDist(TestCase):
                             [2.031033998682787, 2.17032494605655257]])
         assert_array_almost_equal(actual, desired, decimal=15)
 
+    def test_standard_normal_zig(self):
+        np.random.seed(self.seed)
+        actual = np.random.standard_normal(size=(3, 2), method='zig')
+        desired = np.array([[-3.472754000610961, -0.10893856422914248],
+                            [-0.24596575339641125, -0.7041015502617002],
+                            [0.3601024871163556, 0.1278321017723667]])
+        assert_array_almost_equal(actual, desired, decimal=14)
+
+        np.random.seed(self.seed)
+        actual = np.random.standard_normal(size=(3, 2), method='zig',
+                                           dtype=np.float32)
+        desired = np.array([[-0.95846659, -1.24427128],
+                            [-0.8051697, 0.14337730],
+                            [1.43758500, -0.23131227]])
+        assert_equal(actual.dtype, np.float32)
+        assert_array_almost_equal(actual, desired, decimal=5)
+
+    def test_standard_exponential_zig(self):
+        np.random.seed(self.seed)
+        actual = np.random.standard_exponential(size=(3, 2), method='zig')
+        desired = np.array([[4.76293603146487, 1.025732100548132],
+                            [3.4422427215228586, 1.3697399971865734],
+                            [0.3096375449960187, 2.417354949147255]])
+        assert_array_almost_equal(actual, desired, decimal=14)
+
+        np.random.seed(self.seed)
+        actual = np.random.standard_exponential(size=(3, 2), method='zig',
+                                                dtype=np.float32)
+        desired = np.array([[1.67732728, 2.62093639],
+                            [1.43805838, 0.07204177],
+                            [0.90113014, 0.46648946]])
+        assert_equal(actual.dtype, np.float32)
+        assert_array_almost_equal(actual, desired, decimal=5)
+
+    def test_standard_gamma_zig(self):
+        np.random.seed(self.seed)
+        actual = np.random.standard_gamma(shape=3, size=(3, 2), method='zig')
+        desired = np.array([[2.284835155696452, 3.2989952496782413],
+                            [11.124922989026441, 2.167844172972766],
+                            [0.921218136909098, 1.1285355232847019]])
+        assert_array_almost_equal(actual, desired, decimal=14)
+
+        np.random.seed(self.seed)
+        actual = np.random.standard_gamma(shape=0.5, size=(3, 2),
+                                          method='zig', dtype=np.float32)
+        desired = np.array([[0.40403196, 1.56529009],
+                            [1.59932125, 0.20936798],
+                            [0.82154125, 0.07132304]])
+        assert_equal(actual.dtype, np.float32)
+        assert_array_almost_equal(actual, desired, decimal=5)
+
+    def test_bulk_matches_scalar(self):
+        # the array fillers give the stream of repeated scalar draws, also
+        # across the state blocks of MT19937 and the kept gaussian
+        for brng in ['MT19937', 'PCG64']:
+            for name, args, kwargs in [
+                    ('random_sample', (), {}),
+                    ('standard_normal', (), {}),
+                    ('normal', (1., 2.), {}),
+                    ('uniform', (-1., 3.), {}),
+                    ('exponential', (2.,), {}),
+                    ('standard_exponential', (), {}),
+                    ('standard_normal', (), {'method': 'zig'}),
+                    ('standard_exponential', (), {'method': 'zig'})]:
+                rs = np.random.RandomState(self.seed, brng=brng)
+                rs.random_sample(3)
+                desired = [getattr(rs, name)(*args, **kwargs)
+                           for i in range(627)]
+                rs = np.random.RandomState(self.seed, brng=brng)
+                rs.random_sample(3)
+                actual = getattr(rs, name)(*args, size=627, **kwargs)
+                assert_equal(actual, desired, err_msg=name)
+
+    def test_zig_arguments(self):
+        # the legacy method rounds its float64 stream
+        np.random.seed(self.seed)
+        desired = np.random.standard_normal(size=(3, 2)).astype(np.float32)
+        np.random.seed(self.seed)
+        actual = np.random.standard_normal(size=(3, 2), dtype=np.float32)
+        assert_equal(actual, desired)
+
+        assert_equal(type(np.random.standard_exponential(
+            method='zig', dtype=np.float32)), np.float32)
+        assert_equal(np.random.standard_gamma(
+            shape=0, method='zig', dtype=np.float32), 0)
+        assert_raises(ValueError, np.random.standard_gamma, shape=-0.,
+                      method='zig')
+        assert_raises(ValueError, np.random.standard_normal, method='polar')
+        assert_raises(TypeError, np.random.standard_exponential,
+                      dtype=np.int64)
+
     def test_standard_t(self):
         np.random.seed(self.seed)
         actual = np.random.standard_t(df=10, size=(3, 2))